@@ -0,0 +1,91 @@
+/**
+ * @file bench_activation.c
+ * @brief Benchmark dan pengukuran error aktivasi exact (libm) vs fast (polinomial)
+ *
+ * Untuk sigmoid dan tanh, mengukur throughput activation_apply_array pada
+ * kedua presisi serta error maksimum terhadap referensi double pada [-20, 20].
+ * Build dengan -DCMAKE_BUILD_TYPE=Release agar angka yang didapat bermakna.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SAMPLE_COUNT ((size_t)1 << 22)
+
+/**
+ * @brief Mengisi input dengan titik berjarak sama pada [-20, 20]
+ */
+static void
+fill_inputs(float *values, size_t count)
+{
+    for (size_t idx = 0; idx < count; ++idx)
+        values[idx] = -20.0f + 40.0f * (float)idx / (float)(count - 1);
+}
+
+/**
+ * @brief Nilai referensi presisi double
+ */
+static double
+reference_activation(double input_value, enum ActivationType activation_type)
+{
+    return activation_type == ACTIVATION_TANH ? tanh(input_value) : 1.0 / (1.0 + exp(-input_value));
+}
+
+int
+main(void)
+{
+    float *inputs = malloc(sizeof(float) * SAMPLE_COUNT);
+    float *values = malloc(sizeof(float) * SAMPLE_COUNT);
+    enum ActivationType activation_types[] = { ACTIVATION_SIGMOID, ACTIVATION_TANH };
+    const char *activation_names[] = { "sigmoid", "tanh" };
+    enum ActivationPrecision precisions[] = { ACTIVATION_PRECISION_EXACT, ACTIVATION_PRECISION_FAST };
+    const char *precision_names[] = { "exact", "fast" };
+
+    fill_inputs(inputs, SAMPLE_COUNT);
+
+    printf("Kernel ISA: %s\n", matrix_get_kernel_isa_name());
+    printf("%-8s %-6s %12s %12s %12s\n", "function", "mode", "Melem/s", "max abs err", "max rel err");
+
+    for (size_t type_idx = 0; type_idx < 2; ++type_idx) {
+        for (size_t precision_idx = 0; precision_idx < 2; ++precision_idx) {
+            activation_set_precision(precisions[precision_idx]);
+
+            // Ukur throughput
+            size_t repetitions = 0;
+            double start_time = benchmark_now_seconds();
+            double elapsed_time = 0.0;
+            do {
+                memcpy(values, inputs, sizeof(float) * SAMPLE_COUNT);
+                activation_apply_array(values, SAMPLE_COUNT, activation_types[type_idx]);
+                ++repetitions;
+                elapsed_time = benchmark_now_seconds() - start_time;
+            } while (elapsed_time < 0.5);
+
+            // Ukur error terhadap referensi double
+            double max_absolute_error = 0.0, max_relative_error = 0.0;
+            for (size_t idx = 0; idx < SAMPLE_COUNT; ++idx) {
+                double reference = reference_activation(inputs[idx], activation_types[type_idx]);
+                double absolute_error = fabs(values[idx] - reference);
+
+                if (absolute_error > max_absolute_error) max_absolute_error = absolute_error;
+                if (reference != 0.0 && absolute_error / fabs(reference) > max_relative_error)
+                    max_relative_error = absolute_error / fabs(reference);
+            }
+
+            printf("%-8s %-6s %12.1f %12.2e %12.2e\n",
+                   activation_names[type_idx], precision_names[precision_idx],
+                   SAMPLE_COUNT * repetitions / elapsed_time * 1e-6,
+                   max_absolute_error, max_relative_error);
+        }
+    }
+
+    free(inputs);
+    free(values);
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
@@ -0,0 +1,28 @@
+/**
+ * @file bench_common.h
+ * @brief Utilitas bersama untuk program benchmark
+ *
+ * Hanya di-include oleh file bench_*.c; setiap benchmark adalah executable
+ * tersendiri sehingga fungsi di sini didefinisikan static.
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <time.h>
+
+/**
+ * @brief Mengambil waktu saat ini dalam detik
+ * @return Waktu dalam detik
+ */
+static inline double
+benchmark_now_seconds(void)
+{
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+#endif
+
+/* vim: set ts=4 sw=4 sts=4 et */
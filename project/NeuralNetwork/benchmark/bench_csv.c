@@ -0,0 +1,144 @@
+/**
+ * @file bench_csv.c
+ * @brief Benchmark pemuatan CSV: fgets + sscanf, chunked, dan paralel (mmap)
+ *
+ * Membuat file CSV sintetis (fitur float + label class di kolom terakhir),
+ * lalu mengukur throughput pemuatan dalam baris/detik dan MB/detik. Jumlah
+ * thread loader paralel mengikuti OMP_NUM_THREADS. Build dengan
+ * -DCMAKE_BUILD_TYPE=Release.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    ROW_COUNT = 200000,
+    FEATURE_COUNT = 64,
+    CLASS_COUNT = 10,
+    MAX_LINE_LENGTH = 16384
+};
+
+/**
+ * @brief Menulis file CSV sintetis dengan satu baris header
+ * @param csv_filename Path file tujuan
+ */
+static void
+benchmark_write_csv(const char *csv_filename)
+{
+    FILE *csv_file = fopen(csv_filename, "w");
+    if (csv_file == NULL) {
+        perror(csv_filename);
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t column_idx = 0; column_idx < FEATURE_COUNT; ++column_idx)
+        fprintf(csv_file, "f%zu,", column_idx);
+    fprintf(csv_file, "label\n");
+
+    srand(42);
+    for (size_t row_idx = 0; row_idx < ROW_COUNT; ++row_idx) {
+        for (size_t column_idx = 0; column_idx < FEATURE_COUNT; ++column_idx)
+            fprintf(csv_file, "%.6g,", (double)rand() / RAND_MAX * 200.0 - 100.0);
+        fprintf(csv_file, "%d\n", rand() % CLASS_COUNT);
+    }
+
+    fclose(csv_file);
+}
+
+/**
+ * @brief Parser referensi: fgets per baris dan sscanf per field
+ * @param csv_filename Path file CSV
+ * @param dataset Matrix tujuan (ROW_COUNT x FEATURE_COUNT + 1)
+ * @return Jumlah baris yang dimuat
+ */
+static size_t
+benchmark_load_sscanf(const char *csv_filename, struct Matrix dataset)
+{
+    static char line[MAX_LINE_LENGTH];
+    FILE *csv_file = fopen(csv_filename, "r");
+    size_t row_count = 0;
+
+    if (!fgets(line, sizeof(line), csv_file)) {
+        fclose(csv_file);
+        return 0;
+    }
+
+    while (row_count < dataset.num_rows && fgets(line, sizeof(line), csv_file)) {
+        const char *cursor = line;
+        for (size_t column_idx = 0; column_idx < dataset.num_columns; ++column_idx) {
+            int consumed = 0;
+            if (sscanf(cursor, "%f%n", &matrix_at(dataset, row_count, column_idx), &consumed) != 1)
+                break;
+            cursor += consumed + 1;
+        }
+        ++row_count;
+    }
+
+    fclose(csv_file);
+    return row_count;
+}
+
+int
+main(void)
+{
+    const char *csv_filename = "bench_csv_data.csv";
+
+    printf("Generating %d rows x %d columns...\n", ROW_COUNT, FEATURE_COUNT + 1);
+    benchmark_write_csv(csv_filename);
+
+    struct MemoryArena arena = arena_create(sizeof(float) * ROW_COUNT * (FEATURE_COUNT + 1) * 3 + 1024 * 1024);
+
+    struct CsvLoadStatistics statistics;
+    struct Matrix fast_dataset = dataset_load_csv_matrix(&arena, csv_filename, 1, false, &statistics);
+
+    struct CsvLoadStatistics parallel_statistics;
+    struct Matrix parallel_dataset = dataset_load_csv_matrix_parallel(&arena, csv_filename, 1, false,
+                                                                      &parallel_statistics);
+
+    struct Matrix reference_dataset = matrix_allocate(&arena, ROW_COUNT, FEATURE_COUNT + 1);
+    double start_time = benchmark_now_seconds();
+    size_t reference_rows = benchmark_load_sscanf(csv_filename, reference_dataset);
+    double reference_seconds = benchmark_now_seconds() - start_time;
+
+    float max_difference = 0.0f;
+    if (parallel_dataset.num_rows != fast_dataset.num_rows) max_difference = INFINITY;
+    for (size_t row_idx = 0; row_idx < fast_dataset.num_rows && row_idx < reference_rows; ++row_idx) {
+        for (size_t column_idx = 0; column_idx < fast_dataset.num_columns; ++column_idx) {
+            float difference = fabsf(matrix_at(fast_dataset, row_idx, column_idx)
+                                     - matrix_at(reference_dataset, row_idx, column_idx));
+            if (difference > max_difference) max_difference = difference;
+
+            difference = fabsf(matrix_at(fast_dataset, row_idx, column_idx)
+                               - matrix_at(parallel_dataset, row_idx, column_idx));
+            if (difference > max_difference) max_difference = difference;
+        }
+    }
+
+    double megabytes = (double)statistics.file_bytes / (1024.0 * 1024.0);
+
+    printf("File: %.1f MB, %zu rows, %zu columns, %zu skipped\n",
+           megabytes, statistics.row_count, statistics.column_count, statistics.skipped_row_count);
+    printf("fgets + sscanf     : %8.3f s | %10.0f rows/s | %7.1f MB/s\n",
+           reference_seconds, reference_rows / reference_seconds, megabytes / reference_seconds);
+    printf("chunked fast parse : %8.3f s | %10.0f rows/s | %7.1f MB/s\n",
+           statistics.elapsed_seconds, statistics.row_count / statistics.elapsed_seconds,
+           megabytes / statistics.elapsed_seconds);
+    printf("parallel mmap parse: %8.3f s | %10.0f rows/s | %7.1f MB/s\n",
+           parallel_statistics.elapsed_seconds, parallel_statistics.row_count / parallel_statistics.elapsed_seconds,
+           megabytes / parallel_statistics.elapsed_seconds);
+    printf("Speedup vs sscanf: chunked %.2fx, parallel %.2fx, max |difference|: %g\n",
+           reference_seconds / statistics.elapsed_seconds, reference_seconds / parallel_statistics.elapsed_seconds,
+           max_difference);
+
+    remove(csv_filename);
+    arena_destroy(&arena);
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
@@ -0,0 +1,96 @@
+/**
+ * @file bench_half_precision.c
+ * @brief Benchmark prediksi dengan weights fp32 vs fp16 vs bf16
+ *
+ * Weights 16-bit dilebarkan ke fp32 saat packing GEMM, sehingga yang
+ * berubah hanya ukuran dan traffic memori weights. Dicetak throughput,
+ * ukuran weights, selisih skor maksimum terhadap fp32, dan persentase label
+ * yang sama. Jumlah thread mengikuti OMP_NUM_THREADS.
+ * Build dengan -DCMAKE_BUILD_TYPE=Release.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+enum {
+    SAMPLE_COUNT = 16384,
+    INPUT_SIZE = 1024,
+    HIDDEN_SIZE = 2048,
+    OUTPUT_SIZE = 16,
+    REPEAT_COUNT = 3
+};
+
+int
+main(void)
+{
+    size_t arch[] = { INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE };
+    size_t arch_count = sizeof(arch) / sizeof(arch[0]);
+    const char *mode_names[] = { "fp32", "fp16", "bf16" };
+
+    struct MemoryArena arena = arena_create(0);
+
+    random_set_global_seed(42);
+    struct Matrix inputs = matrix_allocate(&arena, SAMPLE_COUNT, INPUT_SIZE);
+    struct Matrix reference_scores = matrix_allocate(&arena, SAMPLE_COUNT, OUTPUT_SIZE);
+    struct Matrix scores = matrix_allocate(&arena, SAMPLE_COUNT, OUTPUT_SIZE);
+    size_t *reference_labels = arena_allocate_memory(&arena, sizeof(*reference_labels) * SAMPLE_COUNT);
+    size_t *labels = arena_allocate_memory(&arena, sizeof(*labels) * SAMPLE_COUNT);
+    matrix_fill_random(inputs, 0.0f, 1.0f);
+
+    struct NeuralNetwork network = neural_network_allocate(&arena, arch, arch_count);
+    neural_network_randomize_weights(network, -0.05f, 0.05f);
+    network.activation_types[arch_count - 1] = ACTIVATION_NONE;
+
+    struct HalfPrecisionNeuralNetwork half_networks[2] = {
+        neural_network_convert_half_precision(&arena, network, HALF_PRECISION_FP16),
+        neural_network_convert_half_precision(&arena, network, HALF_PRECISION_BF16)
+    };
+
+    size_t weight_count = 0;
+    for (size_t layer_idx = 0; layer_idx < arch_count - 1; ++layer_idx)
+        weight_count += arch[layer_idx] * arch[layer_idx + 1];
+
+    printf("Kernel ISA: %s\n", matrix_get_kernel_isa_name());
+    printf("Model %d-%d-%d-%d, %d rows\n", INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE, SAMPLE_COUNT);
+    printf("%-6s %12s %12s %12s %12s\n", "mode", "weights MB", "rows/s", "max |diff|", "agreement");
+
+    for (int mode_idx = 0; mode_idx < 3; ++mode_idx) {
+        struct Matrix mode_scores = mode_idx == 0 ? reference_scores : scores;
+        size_t *mode_labels = mode_idx == 0 ? reference_labels : labels;
+        double best_seconds = 1e30;
+
+        for (size_t repeat_idx = 0; repeat_idx < REPEAT_COUNT; ++repeat_idx) {
+            double start_time = benchmark_now_seconds();
+            if (mode_idx == 0)
+                neural_network_predict_batch(network, inputs, mode_scores, mode_labels);
+            else
+                half_precision_network_predict_batch(half_networks[mode_idx - 1], inputs, mode_scores, mode_labels);
+            double elapsed_time = benchmark_now_seconds() - start_time;
+            if (elapsed_time < best_seconds) best_seconds = elapsed_time;
+        }
+
+        float max_difference = 0.0f;
+        size_t matching_labels = 0;
+        for (size_t sample_idx = 0; sample_idx < SAMPLE_COUNT; ++sample_idx) {
+            matching_labels += mode_labels[sample_idx] == reference_labels[sample_idx];
+            for (size_t output_idx = 0; output_idx < OUTPUT_SIZE; ++output_idx) {
+                float difference = fabsf(matrix_at(mode_scores, sample_idx, output_idx)
+                                         - matrix_at(reference_scores, sample_idx, output_idx));
+                if (difference > max_difference) max_difference = difference;
+            }
+        }
+
+        printf("%-6s %12.1f %12.0f %12.3e %11.2f%%\n", mode_names[mode_idx],
+               weight_count * (mode_idx == 0 ? sizeof(float) : sizeof(uint16_t)) / 1048576.0,
+               SAMPLE_COUNT / best_seconds, max_difference, 100.0 * matching_labels / SAMPLE_COUNT);
+    }
+
+    arena_destroy(&arena);
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
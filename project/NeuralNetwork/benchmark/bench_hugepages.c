@@ -0,0 +1,115 @@
+/**
+ * @file bench_hugepages.c
+ * @brief Benchmark arena malloc vs arena huge page untuk model dengan layer besar
+ *
+ * Dataset, parameter, state Adam, dan workspace training dialokasikan dari
+ * arena yang sama; kedua mode memakai seed yang sama sehingga pekerjaannya
+ * identik. Selain training, diukur juga shuffle baris dataset besar yang
+ * aksesnya acak dan paling sensitif terhadap TLB miss. Backend yang benar-benar
+ * dipakai (hugetlb, thp, atau malloc) dicetak per mode. Build dengan
+ * -DCMAKE_BUILD_TYPE=Release.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+enum {
+    SAMPLE_COUNT = 4096,
+    INPUT_SIZE = 1024,
+    HIDDEN_SIZE = 2048,
+    OUTPUT_SIZE = 16,
+    BATCH_SIZE = 128,
+    EPOCH_COUNT = 2,
+    SHUFFLE_ROW_COUNT = 4194304,
+    SHUFFLE_COLUMN_COUNT = 8
+};
+
+/**
+ * @brief Membuat dataset sintetis berlabel dari teacher network acak
+ * @param arena_ptr Arena untuk dataset dan buffer sementara
+ * @return Dataset (INPUT_SIZE kolom input + OUTPUT_SIZE kolom one-hot)
+ */
+static struct Matrix
+benchmark_create_dataset(struct MemoryArena *arena_ptr)
+{
+    size_t teacher_arch[] = { INPUT_SIZE, 64, OUTPUT_SIZE };
+    size_t arch_count = sizeof(teacher_arch) / sizeof(teacher_arch[0]);
+
+    struct Matrix dataset = matrix_allocate(arena_ptr, SAMPLE_COUNT, INPUT_SIZE + OUTPUT_SIZE);
+    struct Matrix scores = matrix_allocate(arena_ptr, SAMPLE_COUNT, OUTPUT_SIZE);
+    size_t *labels = arena_allocate_memory(arena_ptr, sizeof(*labels) * SAMPLE_COUNT);
+
+    matrix_fill_random(dataset, 0.0f, 1.0f);
+
+    struct NeuralNetwork teacher = neural_network_allocate(arena_ptr, teacher_arch, arch_count);
+    neural_network_randomize_weights(teacher, -1.0f, 1.0f);
+    teacher.activation_types[arch_count - 1] = ACTIVATION_NONE;
+    neural_network_predict_batch(teacher, dataset, scores, labels);
+
+    for (size_t sample_idx = 0; sample_idx < SAMPLE_COUNT; ++sample_idx) {
+        for (size_t output_idx = 0; output_idx < OUTPUT_SIZE; ++output_idx)
+            matrix_at(dataset, sample_idx, INPUT_SIZE + output_idx) = output_idx == labels[sample_idx] ? 1.0f : 0.0f;
+    }
+
+    return dataset;
+}
+
+int
+main(void)
+{
+    size_t arch[] = { INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE };
+    size_t arch_count = sizeof(arch) / sizeof(arch[0]);
+
+    printf("Kernel ISA: %s\n", matrix_get_kernel_isa_name());
+    printf("Model %d-%d-%d-%d, %d samples, batch %d, %d epochs; shuffle %d x %d\n",
+           INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE, SAMPLE_COUNT, BATCH_SIZE, EPOCH_COUNT,
+           SHUFFLE_ROW_COUNT, SHUFFLE_COLUMN_COUNT);
+    printf("%-12s %10s %14s %12s %10s   %s\n", "arena", "train (s)", "samples/s", "shuffle (s)", "accuracy",
+           "chunks (malloc/hugetlb/thp)");
+
+    for (int mode_idx = 0; mode_idx < 2; ++mode_idx) {
+        size_t chunk_counts_before[ARENA_BACKEND_COUNT];
+        for (int backend = 0; backend < ARENA_BACKEND_COUNT; ++backend)
+            chunk_counts_before[backend] = arena_get_backend_chunk_count((enum ArenaBackend)backend);
+
+        struct MemoryArena arena = mode_idx == 0 ? arena_create(0) : arena_create_huge_pages(0);
+
+        random_set_global_seed(42);
+        struct Matrix dataset = benchmark_create_dataset(&arena);
+
+        struct NeuralNetwork network = neural_network_allocate(&arena, arch, arch_count);
+        neural_network_randomize_weights(network, -0.05f, 0.05f);
+
+        struct TrainingWorkspace training_workspace = training_workspace_allocate(&arena, network, BATCH_SIZE);
+        struct Optimizer optimizer = optimizer_create(&arena, network, OPTIMIZER_ADAM, 0.001f);
+        struct BatchSampler sampler = batch_sampler_create(&arena, dataset, BATCH_SIZE);
+
+        double start_time = benchmark_now_seconds();
+        for (size_t epoch_idx = 0; epoch_idx < EPOCH_COUNT; ++epoch_idx)
+            batch_process_training_epoch_sampled(training_workspace, &optimizer, &sampler, network, dataset);
+        double training_seconds = benchmark_now_seconds() - start_time;
+
+        struct Matrix shuffle_data = matrix_allocate(&arena, SHUFFLE_ROW_COUNT, SHUFFLE_COLUMN_COUNT);
+        start_time = benchmark_now_seconds();
+        matrix_shuffle_rows(shuffle_data);
+        double shuffle_seconds = benchmark_now_seconds() - start_time;
+
+        printf("%-12s %10.3f %14.0f %12.3f %9.2f%%   %zu/%zu/%zu\n",
+               mode_idx == 0 ? "malloc" : "huge pages", training_seconds,
+               (double)SAMPLE_COUNT * EPOCH_COUNT / training_seconds, shuffle_seconds,
+               100.0f * neural_network_calculate_accuracy(network, dataset),
+               arena_get_backend_chunk_count(ARENA_BACKEND_MALLOC) - chunk_counts_before[ARENA_BACKEND_MALLOC],
+               arena_get_backend_chunk_count(ARENA_BACKEND_HUGETLB) - chunk_counts_before[ARENA_BACKEND_HUGETLB],
+               arena_get_backend_chunk_count(ARENA_BACKEND_TRANSPARENT_HUGE_PAGES)
+                   - chunk_counts_before[ARENA_BACKEND_TRANSPARENT_HUGE_PAGES]);
+
+        arena_destroy(&arena);
+    }
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
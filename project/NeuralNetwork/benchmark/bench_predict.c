@@ -0,0 +1,84 @@
+/**
+ * @file bench_predict.c
+ * @brief Benchmark neural_network_predict_batch vs forward pass per baris
+ *
+ * Mengukur throughput (baris/detik) scoring dataset besar. Jumlah thread
+ * mengikuti OMP_NUM_THREADS. Build dengan -DCMAKE_BUILD_TYPE=Release.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+enum {
+    SAMPLE_COUNT = 200000,
+    INPUT_SIZE = 64,
+    HIDDEN_SIZE = 256,
+    OUTPUT_SIZE = 10
+};
+
+int
+main(void)
+{
+    size_t arch[] = { INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE };
+    size_t arch_count = sizeof(arch) / sizeof(arch[0]);
+
+    struct MemoryArena arena = arena_create(sizeof(float) * SAMPLE_COUNT * (INPUT_SIZE + 2 * OUTPUT_SIZE)
+                                            + sizeof(size_t) * SAMPLE_COUNT + 4 * 1024 * 1024);
+
+    random_set_global_seed(42);
+    struct Matrix inputs = matrix_allocate(&arena, SAMPLE_COUNT, INPUT_SIZE);
+    struct Matrix batch_scores = matrix_allocate(&arena, SAMPLE_COUNT, OUTPUT_SIZE);
+    struct Matrix row_scores = matrix_allocate(&arena, SAMPLE_COUNT, OUTPUT_SIZE);
+    size_t *labels = arena_allocate_memory(&arena, sizeof(*labels) * SAMPLE_COUNT);
+    matrix_fill_random(inputs, 0.0f, 1.0f);
+
+    struct NeuralNetwork network = neural_network_allocate(&arena, arch, arch_count);
+    struct NeuralNetworkContext context = neural_network_allocate_context(&arena, network);
+    neural_network_randomize_weights(network, -0.2f, 0.2f);
+
+#if defined(_OPENMP)
+    int thread_count = omp_get_max_threads();
+#else
+    int thread_count = 1;
+#endif
+
+    printf("Kernel ISA: %s, threads: %d\n", matrix_get_kernel_isa_name(), thread_count);
+    printf("Model %d-%d-%d-%d, %d rows\n", INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE, SAMPLE_COUNT);
+
+    // Forward pass per baris (cara lama)
+    double start_time = benchmark_now_seconds();
+    for (size_t sample_idx = 0; sample_idx < SAMPLE_COUNT; ++sample_idx) {
+        row_copy_data(context.activation_vectors[0], matrix_get_row(inputs, sample_idx));
+        neural_network_forward_pass(network, context);
+        row_copy_data(matrix_get_row(row_scores, sample_idx), context.activation_vectors[arch_count - 1]);
+    }
+    double row_seconds = benchmark_now_seconds() - start_time;
+
+    start_time = benchmark_now_seconds();
+    neural_network_predict_batch(network, inputs, batch_scores, labels);
+    double batch_seconds = benchmark_now_seconds() - start_time;
+
+    float max_difference = 0.0f;
+    for (size_t element_idx = 0; element_idx < (size_t)SAMPLE_COUNT * OUTPUT_SIZE; ++element_idx) {
+        float difference = fabsf(row_scores.element[element_idx] - batch_scores.element[element_idx]);
+        if (difference > max_difference) max_difference = difference;
+    }
+
+    printf("%-14s %12s\n", "mode", "rows/s");
+    printf("%-14s %12.0f\n", "per-row", SAMPLE_COUNT / row_seconds);
+    printf("%-14s %12.0f\n", "predict_batch", SAMPLE_COUNT / batch_seconds);
+    printf("speedup %.1fx, max |diff| %.2e\n", row_seconds / batch_seconds, max_difference);
+
+    arena_destroy(&arena);
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
@@ -0,0 +1,98 @@
+/**
+ * @file bench_quantized.c
+ * @brief Benchmark prediksi float vs int8 terkuantisasi untuk model besar
+ *
+ * Network acak dengan layer lebar (weights tidak muat di cache) dipakai
+ * untuk scoring; versi int8 dibuat dengan neural_network_quantize.
+ * Dicetak throughput, ukuran weights, selisih skor maksimum, dan persentase
+ * label yang sama dengan model float. Jumlah thread mengikuti
+ * OMP_NUM_THREADS. Build dengan -DCMAKE_BUILD_TYPE=Release.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+enum {
+    SAMPLE_COUNT = 16384,
+    INPUT_SIZE = 1024,
+    HIDDEN_SIZE = 2048,
+    OUTPUT_SIZE = 16,
+    REPEAT_COUNT = 3
+};
+
+int
+main(void)
+{
+    size_t arch[] = { INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE };
+    size_t arch_count = sizeof(arch) / sizeof(arch[0]);
+
+    struct MemoryArena arena = arena_create(0);
+
+    random_set_global_seed(42);
+    struct Matrix inputs = matrix_allocate(&arena, SAMPLE_COUNT, INPUT_SIZE);
+    struct Matrix float_scores = matrix_allocate(&arena, SAMPLE_COUNT, OUTPUT_SIZE);
+    struct Matrix int8_scores = matrix_allocate(&arena, SAMPLE_COUNT, OUTPUT_SIZE);
+    size_t *float_labels = arena_allocate_memory(&arena, sizeof(*float_labels) * SAMPLE_COUNT);
+    size_t *int8_labels = arena_allocate_memory(&arena, sizeof(*int8_labels) * SAMPLE_COUNT);
+    matrix_fill_random(inputs, 0.0f, 1.0f);
+
+    struct NeuralNetwork network = neural_network_allocate(&arena, arch, arch_count);
+    neural_network_randomize_weights(network, -0.05f, 0.05f);
+    for (size_t layer_idx = 1; layer_idx < arch_count; ++layer_idx)
+        network.activation_types[layer_idx] = ACTIVATION_RELU;
+    network.activation_types[arch_count - 1] = ACTIVATION_NONE;
+
+    double start_time = benchmark_now_seconds();
+    struct QuantizedNeuralNetwork quantized_network = neural_network_quantize(&arena, network);
+    double quantize_seconds = benchmark_now_seconds() - start_time;
+
+    size_t float_weight_bytes = 0;
+    for (size_t layer_idx = 0; layer_idx < arch_count - 1; ++layer_idx)
+        float_weight_bytes += sizeof(float) * arch[layer_idx] * arch[layer_idx + 1];
+
+    printf("Kernel ISA: %s\n", matrix_get_kernel_isa_name());
+    printf("Model %d-%d-%d-%d, %d rows, weights %.1f MB float / %.1f MB int8, quantize %.3f s\n",
+           INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE, SAMPLE_COUNT,
+           float_weight_bytes / 1048576.0, quantized_network.weight_bytes / 1048576.0, quantize_seconds);
+
+    double float_seconds = 1e30;
+    double int8_seconds = 1e30;
+    for (size_t repeat_idx = 0; repeat_idx < REPEAT_COUNT; ++repeat_idx) {
+        start_time = benchmark_now_seconds();
+        neural_network_predict_batch(network, inputs, float_scores, float_labels);
+        double elapsed_time = benchmark_now_seconds() - start_time;
+        if (elapsed_time < float_seconds) float_seconds = elapsed_time;
+
+        start_time = benchmark_now_seconds();
+        quantized_network_predict_batch(quantized_network, inputs, int8_scores, int8_labels);
+        elapsed_time = benchmark_now_seconds() - start_time;
+        if (elapsed_time < int8_seconds) int8_seconds = elapsed_time;
+    }
+
+    float max_difference = 0.0f;
+    float max_score = 0.0f;
+    for (size_t element_idx = 0; element_idx < (size_t)SAMPLE_COUNT * OUTPUT_SIZE; ++element_idx) {
+        float difference = fabsf(float_scores.element[element_idx] - int8_scores.element[element_idx]);
+        if (difference > max_difference) max_difference = difference;
+        if (fabsf(float_scores.element[element_idx]) > max_score) max_score = fabsf(float_scores.element[element_idx]);
+    }
+
+    size_t matching_labels = 0;
+    for (size_t sample_idx = 0; sample_idx < SAMPLE_COUNT; ++sample_idx)
+        matching_labels += float_labels[sample_idx] == int8_labels[sample_idx];
+
+    printf("%-8s %12s\n", "mode", "rows/s");
+    printf("%-8s %12.0f\n", "float", SAMPLE_COUNT / float_seconds);
+    printf("%-8s %12.0f\n", "int8", SAMPLE_COUNT / int8_seconds);
+    printf("speedup %.2fx, max |diff| %.3e (max |score| %.3e), label agreement %.2f%%\n",
+           float_seconds / int8_seconds, max_difference, max_score, 100.0 * matching_labels / SAMPLE_COUNT);
+
+    arena_destroy(&arena);
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
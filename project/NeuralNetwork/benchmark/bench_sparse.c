@@ -0,0 +1,174 @@
+/**
+ * @file bench_sparse.c
+ * @brief Benchmark GEMM dense vs kernel CSR untuk weights hasil magnitude pruning
+ *
+ * Bagian pertama membandingkan satu layer HIDDEN_SIZE x HIDDEN_SIZE pada
+ * berbagai density; titik impas keduanya menjadi dasar
+ * SPARSE_KERNEL_MAX_DENSITY. Bagian kedua memangkas seluruh network ke
+ * beberapa target sparsity lalu membandingkan prediksi network dense (weights
+ * yang sama, berisi nol) dengan network sparse yang memilih kernel per layer.
+ * Jumlah thread mengikuti OMP_NUM_THREADS.
+ * Build dengan -DCMAKE_BUILD_TYPE=Release.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+enum {
+    SAMPLE_COUNT = 16384,
+    LAYER_BATCH_ROWS = 256,
+    INPUT_SIZE = 1024,
+    HIDDEN_SIZE = 2048,
+    OUTPUT_SIZE = 16,
+    REPEAT_COUNT = 3
+};
+
+/**
+ * @brief Mencari selisih elemen terbesar antara dua matrix berukuran sama
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua
+ * @return Selisih absolut terbesar
+ */
+static float
+benchmark_max_difference(struct Matrix matrix_a, struct Matrix matrix_b)
+{
+    float max_difference = 0.0f;
+    for (size_t element_idx = 0; element_idx < matrix_a.num_rows * matrix_a.num_columns; ++element_idx) {
+        float difference = fabsf(matrix_a.element[element_idx] - matrix_b.element[element_idx]);
+        if (difference > max_difference) max_difference = difference;
+    }
+    return max_difference;
+}
+
+/**
+ * @brief Mengukur GEMM dense vs CSR untuk satu layer pada berbagai density
+ * @param arena_ptr Arena untuk alokasi
+ */
+static void
+benchmark_single_layer(struct MemoryArena *arena_ptr)
+{
+    const float densities[] = { 1.0f, 0.5f, 0.4f, 0.3f, 0.2f, 0.1f, 0.05f };
+    size_t density_count = sizeof(densities) / sizeof(densities[0]);
+
+    struct Matrix inputs = matrix_allocate(arena_ptr, LAYER_BATCH_ROWS, HIDDEN_SIZE);
+    struct Matrix dense_output = matrix_allocate(arena_ptr, LAYER_BATCH_ROWS, HIDDEN_SIZE);
+    struct Matrix sparse_output = matrix_allocate(arena_ptr, LAYER_BATCH_ROWS, HIDDEN_SIZE);
+    struct Matrix weights = matrix_allocate(arena_ptr, HIDDEN_SIZE, HIDDEN_SIZE);
+    struct Matrix random_values = matrix_allocate(arena_ptr, HIDDEN_SIZE, HIDDEN_SIZE);
+    struct Row biases = matrix_get_row(matrix_allocate(arena_ptr, 1, HIDDEN_SIZE), 0);
+
+    matrix_fill_random(inputs, 0.0f, 1.0f);
+    matrix_fill_random(random_values, 0.0f, 1.0f);
+
+    printf("Layer %d x %d, batch %d rows\n", HIDDEN_SIZE, HIDDEN_SIZE, LAYER_BATCH_ROWS);
+    printf("%-8s %12s %12s %10s %12s\n", "density", "dense (ms)", "csr (ms)", "speedup", "max |diff|");
+
+    for (size_t density_idx = 0; density_idx < density_count; ++density_idx) {
+        float density = densities[density_idx];
+
+        // Pola nonzero acak (tidak terstruktur), seperti hasil magnitude pruning
+        for (size_t element_idx = 0; element_idx < (size_t)HIDDEN_SIZE * HIDDEN_SIZE; ++element_idx) {
+            float value = random_values.element[element_idx];
+            weights.element[element_idx] = value < density ? value / density - 0.5f : 0.0f;
+        }
+
+        struct ArenaMarker marker = arena_save(arena_ptr);
+        struct SparseMatrix sparse_weights = sparse_matrix_create_transposed(arena_ptr, weights);
+        double best_seconds[2] = { 1e30, 1e30 };
+
+        for (size_t repeat_idx = 0; repeat_idx < REPEAT_COUNT; ++repeat_idx) {
+            double start_time = benchmark_now_seconds();
+            matrix_multiply_bias_activation(dense_output, inputs, weights, biases, ACTIVATION_RELU);
+            double elapsed_time = benchmark_now_seconds() - start_time;
+            if (elapsed_time < best_seconds[0]) best_seconds[0] = elapsed_time;
+
+            start_time = benchmark_now_seconds();
+            sparse_matrix_multiply_bias_activation(sparse_output, inputs, sparse_weights, biases, ACTIVATION_RELU);
+            elapsed_time = benchmark_now_seconds() - start_time;
+            if (elapsed_time < best_seconds[1]) best_seconds[1] = elapsed_time;
+        }
+
+        printf("%-8.2f %12.3f %12.3f %9.2fx %12.3e\n", density, best_seconds[0] * 1e3, best_seconds[1] * 1e3,
+               best_seconds[0] / best_seconds[1], benchmark_max_difference(dense_output, sparse_output));
+
+        arena_restore(arena_ptr, marker);
+    }
+}
+
+int
+main(void)
+{
+    size_t arch[] = { INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE };
+    size_t arch_count = sizeof(arch) / sizeof(arch[0]);
+    const float sparsities[] = { 0.5f, 0.8f, 0.9f, 0.95f };
+    size_t sparsity_count = sizeof(sparsities) / sizeof(sparsities[0]);
+
+    struct MemoryArena arena = arena_create(0);
+
+    random_set_global_seed(42);
+    printf("Kernel ISA: %s\n", matrix_get_kernel_isa_name());
+    benchmark_single_layer(&arena);
+
+    struct Matrix inputs = matrix_allocate(&arena, SAMPLE_COUNT, INPUT_SIZE);
+    struct Matrix dense_scores = matrix_allocate(&arena, SAMPLE_COUNT, OUTPUT_SIZE);
+    struct Matrix sparse_scores = matrix_allocate(&arena, SAMPLE_COUNT, OUTPUT_SIZE);
+    size_t *dense_labels = arena_allocate_memory(&arena, sizeof(*dense_labels) * SAMPLE_COUNT);
+    size_t *sparse_labels = arena_allocate_memory(&arena, sizeof(*sparse_labels) * SAMPLE_COUNT);
+    matrix_fill_random(inputs, 0.0f, 1.0f);
+
+    struct NeuralNetwork initial_network = neural_network_allocate(&arena, arch, arch_count);
+    struct NeuralNetwork network = neural_network_allocate(&arena, arch, arch_count);
+    neural_network_randomize_weights(initial_network, -0.05f, 0.05f);
+    initial_network.activation_types[arch_count - 1] = ACTIVATION_NONE;
+    network.activation_types[arch_count - 1] = ACTIVATION_NONE;
+
+    printf("\nModel %d-%d-%d-%d, %d rows\n", INPUT_SIZE, HIDDEN_SIZE, HIDDEN_SIZE, OUTPUT_SIZE, SAMPLE_COUNT);
+    printf("%9s %8s %12s %12s %12s %10s %12s %11s\n", "sparsity", "csr", "dense MB", "sparse MB",
+           "dense rows/s", "csr rows/s", "max |diff|", "agreement");
+
+    for (size_t sparsity_idx = 0; sparsity_idx < sparsity_count; ++sparsity_idx) {
+        struct ArenaMarker marker = arena_save(&arena);
+
+        neural_network_copy_parameters(network, initial_network);
+        neural_network_prune_magnitude(&arena, network, sparsities[sparsity_idx]);
+        struct SparseNeuralNetwork sparse_network = neural_network_create_sparse(&arena, network);
+
+        size_t sparse_layer_count = 0;
+        for (size_t layer_idx = 0; layer_idx < arch_count - 1; ++layer_idx)
+            sparse_layer_count += sparse_network.layers[layer_idx].use_sparse_kernel;
+
+        double best_seconds[2] = { 1e30, 1e30 };
+        for (size_t repeat_idx = 0; repeat_idx < REPEAT_COUNT; ++repeat_idx) {
+            double start_time = benchmark_now_seconds();
+            neural_network_predict_batch(network, inputs, dense_scores, dense_labels);
+            double elapsed_time = benchmark_now_seconds() - start_time;
+            if (elapsed_time < best_seconds[0]) best_seconds[0] = elapsed_time;
+
+            start_time = benchmark_now_seconds();
+            sparse_network_predict_batch(sparse_network, inputs, sparse_scores, sparse_labels);
+            elapsed_time = benchmark_now_seconds() - start_time;
+            if (elapsed_time < best_seconds[1]) best_seconds[1] = elapsed_time;
+        }
+
+        size_t matching_labels = 0;
+        for (size_t sample_idx = 0; sample_idx < SAMPLE_COUNT; ++sample_idx)
+            matching_labels += dense_labels[sample_idx] == sparse_labels[sample_idx];
+
+        printf("%8.1f%% %6zu/%zu %12.1f %12.1f %12.0f %10.0f %12.3e %10.2f%%\n",
+               100.0f * neural_network_get_weight_sparsity(network), sparse_layer_count, arch_count - 1,
+               sizeof(float) * network.parameter_count / 1048576.0, sparse_network.weight_bytes / 1048576.0,
+               SAMPLE_COUNT / best_seconds[0], SAMPLE_COUNT / best_seconds[1],
+               benchmark_max_difference(dense_scores, sparse_scores), 100.0 * matching_labels / SAMPLE_COUNT);
+
+        arena_restore(&arena, marker);
+    }
+
+    arena_destroy(&arena);
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
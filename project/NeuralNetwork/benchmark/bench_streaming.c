@@ -0,0 +1,142 @@
+/**
+ * @file bench_streaming.c
+ * @brief Benchmark training in-memory vs streaming out-of-core dengan prefetch
+ *
+ * Dataset sintetis (label dari "teacher" network acak) disimpan sebagai
+ * dataset biner. Mode in-memory memuat seluruh file dan mengacak lewat
+ * BatchSampler setiap epoch; mode streaming membaca chunk lewat thread
+ * loader dengan shuffle buffer terbatas. Kedua mode mulai dari weights yang
+ * identik.
+ * Build dengan -DCMAKE_BUILD_TYPE=Release.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+enum {
+    SAMPLE_COUNT = 65536,
+    INPUT_SIZE = 128,
+    HIDDEN_SIZE = 256,
+    OUTPUT_SIZE = 10,
+    BATCH_SIZE = 256,
+    EPOCH_COUNT = 3,
+    CHUNK_ROWS = 4096,
+    CHUNK_BUFFER_COUNT = 3,
+    SHUFFLE_BUFFER_ROWS = 16384
+};
+
+/**
+ * @brief Membuat dataset sintetis dan menyimpannya sebagai dataset biner
+ * @param arena_ptr Arena untuk dataset sementara
+ * @param dataset_filename Path file tujuan
+ */
+static void
+benchmark_write_dataset(struct MemoryArena *arena_ptr, const char *dataset_filename)
+{
+    size_t teacher_arch[] = { INPUT_SIZE, 64, OUTPUT_SIZE };
+    size_t arch_count = sizeof(teacher_arch) / sizeof(teacher_arch[0]);
+
+    struct Matrix dataset = matrix_allocate(arena_ptr, SAMPLE_COUNT, INPUT_SIZE + OUTPUT_SIZE);
+    struct Matrix scores = matrix_allocate(arena_ptr, SAMPLE_COUNT, OUTPUT_SIZE);
+    size_t *labels = arena_allocate_memory(arena_ptr, sizeof(*labels) * SAMPLE_COUNT);
+    struct Matrix inputs = matrix_allocate(arena_ptr, SAMPLE_COUNT, INPUT_SIZE);
+
+    matrix_fill_random(inputs, 0.0f, 1.0f);
+
+    struct NeuralNetwork teacher = neural_network_allocate(arena_ptr, teacher_arch, arch_count);
+    neural_network_randomize_weights(teacher, -1.0f, 1.0f);
+    teacher.activation_types[arch_count - 1] = ACTIVATION_NONE;
+    neural_network_predict_batch(teacher, inputs, scores, labels);
+
+    for (size_t sample_idx = 0; sample_idx < SAMPLE_COUNT; ++sample_idx) {
+        for (size_t input_idx = 0; input_idx < INPUT_SIZE; ++input_idx)
+            matrix_at(dataset, sample_idx, input_idx) = matrix_at(inputs, sample_idx, input_idx);
+        for (size_t output_idx = 0; output_idx < OUTPUT_SIZE; ++output_idx)
+            matrix_at(dataset, sample_idx, INPUT_SIZE + output_idx) = output_idx == labels[sample_idx] ? 1.0f : 0.0f;
+    }
+
+    struct NormalizationParameters no_normalization = {0};
+    if (!dataset_save_binary(dataset, INPUT_SIZE, no_normalization, dataset_filename)) {
+        perror(dataset_filename);
+        exit(EXIT_FAILURE);
+    }
+}
+
+int
+main(void)
+{
+    const char *dataset_filename = "bench_streaming_data.nnds";
+    size_t arch[] = { INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE };
+    size_t arch_count = sizeof(arch) / sizeof(arch[0]);
+
+    struct MemoryArena arena = arena_create(sizeof(float) * SAMPLE_COUNT * (2 * INPUT_SIZE + 3 * OUTPUT_SIZE)
+                                            + 16 * sizeof(float) * (INPUT_SIZE + 1) * HIDDEN_SIZE
+                                            + 64 * 1024 * 1024);
+
+    random_set_global_seed(42);
+    benchmark_write_dataset(&arena, dataset_filename);
+
+    struct NeuralNetwork initial_network = neural_network_allocate(&arena, arch, arch_count);
+    struct NeuralNetwork network = neural_network_allocate(&arena, arch, arch_count);
+    neural_network_randomize_weights(initial_network, -0.1f, 0.1f);
+
+    struct TrainingWorkspace training_workspace = training_workspace_allocate(&arena, network, BATCH_SIZE);
+
+    struct BinaryDataset evaluation_dataset;
+    if (!dataset_load_binary(dataset_filename, &evaluation_dataset)) {
+        fprintf(stderr, "Failed to load %s\n", dataset_filename);
+        return EXIT_FAILURE;
+    }
+
+    printf("Kernel ISA: %s\n", matrix_get_kernel_isa_name());
+    printf("Model %d-%d-%d, %d samples, batch %d, %d epochs, chunk %d x %d buffers, shuffle buffer %d\n",
+           INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE, SAMPLE_COUNT, BATCH_SIZE, EPOCH_COUNT,
+           CHUNK_ROWS, CHUNK_BUFFER_COUNT, SHUFFLE_BUFFER_ROWS);
+    printf("%-12s %10s %14s %10s %10s\n", "mode", "time (s)", "samples/s", "cost", "accuracy");
+
+    for (int mode_idx = 0; mode_idx < 2; ++mode_idx) {
+        neural_network_copy_parameters(network, initial_network);
+        struct Optimizer optimizer = optimizer_create(&arena, network, OPTIMIZER_ADAM, 0.001f);
+
+        double start_time = benchmark_now_seconds();
+        if (mode_idx == 0) {
+            // Seluruh dataset di memori (mmap), shuffle penuh lewat permutasi indeks setiap epoch
+            struct BinaryDataset training_dataset;
+            dataset_load_binary(dataset_filename, &training_dataset);
+            struct BatchSampler sampler = batch_sampler_create(&arena, training_dataset.data, BATCH_SIZE);
+
+            for (size_t epoch_idx = 0; epoch_idx < EPOCH_COUNT; ++epoch_idx) {
+                batch_process_training_epoch_sampled(training_workspace, &optimizer, &sampler,
+                                                     network, training_dataset.data);
+            }
+
+            dataset_unload_binary(&training_dataset);
+        } else {
+            struct DatasetStream *dataset_stream =
+                dataset_stream_open(dataset_filename, CHUNK_ROWS, CHUNK_BUFFER_COUNT, SHUFFLE_BUFFER_ROWS, 42);
+
+            for (size_t epoch_idx = 0; epoch_idx < EPOCH_COUNT; ++epoch_idx)
+                batch_process_training_stream(training_workspace, &optimizer, BATCH_SIZE, network, dataset_stream);
+
+            dataset_stream_close(dataset_stream);
+        }
+        double elapsed_time = benchmark_now_seconds() - start_time;
+
+        printf("%-12s %10.3f %14.0f %10.4f %9.2f%%\n",
+               mode_idx == 0 ? "in-memory" : "streaming", elapsed_time,
+               (double)SAMPLE_COUNT * EPOCH_COUNT / elapsed_time,
+               neural_network_calculate_cost(network, evaluation_dataset.data),
+               100.0f * neural_network_calculate_accuracy(network, evaluation_dataset.data));
+    }
+
+    dataset_unload_binary(&evaluation_dataset);
+    remove(dataset_filename);
+    arena_destroy(&arena);
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
@@ -0,0 +1,134 @@
+/**
+ * @file bench_training.c
+ * @brief Benchmark training sinkron data-parallel vs Hogwild (asinkron tanpa lock)
+ *
+ * Dataset sintetis dibuat dari "teacher" network acak, lalu model yang sama
+ * dilatih dengan kedua mode dari inisialisasi weights yang identik. Jumlah
+ * thread mengikuti OMP_NUM_THREADS. Build dengan -DCMAKE_BUILD_TYPE=Release.
+ */
+
+#include "nn.h"
+#include "bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+enum {
+    SAMPLE_COUNT = 16384,
+    INPUT_SIZE = 256,
+    HIDDEN_SIZE = 512,
+    OUTPUT_SIZE = 10,
+    BATCH_SIZE = 256,
+    EPOCH_COUNT = 5
+};
+
+/**
+ * @brief Mengisi kolom output dataset dengan label one-hot dari teacher network
+ * @param teacher Network acak yang menentukan label
+ * @param context Context eksekusi untuk teacher
+ * @param dataset Dataset (kolom input sudah terisi)
+ */
+static void
+label_with_teacher(struct NeuralNetwork teacher, struct NeuralNetworkContext context, struct Matrix dataset)
+{
+    for (size_t sample_idx = 0; sample_idx < dataset.num_rows; ++sample_idx) {
+        struct Row sample = matrix_get_row(dataset, sample_idx);
+
+        row_copy_data(context.activation_vectors[0], row_create_slice(sample, 0, INPUT_SIZE));
+        neural_network_forward_pass(teacher, context);
+
+        size_t label = row_find_max_index(context.activation_vectors[teacher.total_layers - 1]);
+        for (size_t output_idx = 0; output_idx < OUTPUT_SIZE; ++output_idx)
+            row_at(sample, INPUT_SIZE + output_idx) = output_idx == label ? 1.0f : 0.0f;
+    }
+}
+
+/**
+ * @brief Training sinkron: gradient setiap batch dihitung paralel lalu direduksi
+ */
+static void
+train_synchronous(struct NeuralNetwork network, struct MemoryArena *arena_ptr,
+                  struct Matrix dataset, size_t batch_size, float learning_rate, size_t num_epochs)
+{
+    struct TrainingWorkspace training_workspace = training_workspace_allocate(arena_ptr, network, batch_size);
+
+    for (size_t epoch_idx = 0; epoch_idx < num_epochs; ++epoch_idx) {
+        for (size_t start_idx = 0; start_idx < dataset.num_rows; start_idx += batch_size) {
+            size_t batch_rows = dataset.num_rows - start_idx < batch_size ? dataset.num_rows - start_idx : batch_size;
+            struct Matrix current_batch = matrix_create_row_slice(dataset, start_idx, batch_rows);
+
+            struct NeuralNetwork batch_gradients =
+                training_workspace_compute_gradients(training_workspace, network, current_batch);
+            neural_network_apply_gradients(network, batch_gradients, learning_rate);
+        }
+    }
+
+    arena_reset(arena_ptr);
+}
+
+int
+main(void)
+{
+    size_t arch[] = { INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE };
+    size_t arch_count = sizeof(arch) / sizeof(arch[0]);
+    size_t teacher_arch[] = { INPUT_SIZE, 64, OUTPUT_SIZE };
+    float learning_rate = 0.5f;
+
+    struct MemoryArena arena = arena_create(sizeof(float) * SAMPLE_COUNT * (INPUT_SIZE + OUTPUT_SIZE)
+                                            + 8 * sizeof(float) * (INPUT_SIZE + 1) * HIDDEN_SIZE
+                                            + 1024 * 1024);
+    struct MemoryArena temp_arena = arena_create((size_t)64 * 1024 * 1024);
+
+    random_set_global_seed(42);
+    struct Matrix dataset = matrix_allocate(&arena, SAMPLE_COUNT, INPUT_SIZE + OUTPUT_SIZE);
+    matrix_fill_random(dataset, 0.0f, 1.0f);
+
+    struct NeuralNetwork teacher = neural_network_allocate(&arena, teacher_arch, arch_count);
+    neural_network_randomize_weights(teacher, -1.0f, 1.0f);
+    teacher.activation_types[arch_count - 1] = ACTIVATION_NONE;
+    label_with_teacher(teacher, neural_network_allocate_context(&arena, teacher), dataset);
+
+    struct NeuralNetwork initial_network = neural_network_allocate(&arena, arch, arch_count);
+    struct NeuralNetwork network = neural_network_allocate(&arena, arch, arch_count);
+    neural_network_randomize_weights(initial_network, -0.1f, 0.1f);
+
+#if defined(_OPENMP)
+    int thread_count = omp_get_max_threads();
+#else
+    int thread_count = 1;
+#endif
+
+    printf("Kernel ISA: %s, threads: %d\n", matrix_get_kernel_isa_name(), thread_count);
+    printf("Model %d-%d-%d, %d samples, batch %d, %d epochs\n",
+           INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE, SAMPLE_COUNT, BATCH_SIZE, EPOCH_COUNT);
+    printf("%-12s %10s %14s %10s %10s\n", "mode", "time (s)", "samples/s", "cost", "accuracy");
+
+    for (int mode_idx = 0; mode_idx < 2; ++mode_idx) {
+        neural_network_copy_parameters(network, initial_network);
+
+        double start_time = benchmark_now_seconds();
+        if (mode_idx == 0)
+            train_synchronous(network, &temp_arena, dataset, BATCH_SIZE, learning_rate, EPOCH_COUNT);
+        else
+            neural_network_train_hogwild(network, dataset, BATCH_SIZE, learning_rate, EPOCH_COUNT, 0);
+        double elapsed_time = benchmark_now_seconds() - start_time;
+
+        printf("%-12s %10.3f %14.0f %10.4f %9.2f%%\n",
+               mode_idx == 0 ? "synchronous" : "hogwild", elapsed_time,
+               (double)SAMPLE_COUNT * EPOCH_COUNT / elapsed_time,
+               neural_network_calculate_cost(network, dataset),
+               100.0f * neural_network_calculate_accuracy(network, dataset));
+    }
+
+    arena_destroy(&temp_arena);
+    arena_destroy(&arena);
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
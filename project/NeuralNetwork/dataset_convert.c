@@ -0,0 +1,64 @@
+/**
+ * @file dataset_convert.c
+ * @brief Konversi dataset CSV klasifikasi ke format dataset biner
+ *
+ * CSV dimuat dengan dataset_load_from_csv (kolom terakhir menjadi one-hot),
+ * kolom input dinormalisasi min-max ke [0, 1], lalu disimpan dengan
+ * dataset_save_binary beserta parameter normalisasinya.
+ *
+ * Pemakaian: dataset_convert <input.csv> <output.nnds> [skip_header_lines]
+ */
+
+#include "nn.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+int
+main(int argc, char **argv)
+{
+  if (argc < 3 || argc > 4) {
+    fprintf(stderr, "Usage: %s <input.csv> <output.nnds> [skip_header_lines]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const char *csv_filename = argv[1];
+  const char *dataset_filename = argv[2];
+  size_t skip_header_lines = argc == 4 ? (size_t)strtoul(argv[3], NULL, 10) : 1;
+
+  // Loader hanya memeriksa fopen dengan assert; cek di sini agar build Release tidak crash
+  FILE *csv_file = fopen(csv_filename, "rb");
+  if (csv_file == NULL) {
+    fprintf(stderr, "Failed to open %s\n", csv_filename);
+    return EXIT_FAILURE;
+  }
+  fclose(csv_file);
+
+  struct CsvLoadStatistics statistics;
+  struct Matrix dataset = dataset_load_csv_matrix(NULL, csv_filename, skip_header_lines, true, &statistics);
+
+  if (dataset.num_rows == 0) {
+    fprintf(stderr, "No valid rows in %s\n", csv_filename);
+    return EXIT_FAILURE;
+  }
+
+  size_t input_column_count = statistics.column_count - 1;
+  struct NormalizationParameters normalization =
+    matrix_normalize_minmax_with_parameters(NULL, dataset, input_column_count, 0.0f, 1.0f);
+
+  if (!dataset_save_binary(dataset, input_column_count, normalization, dataset_filename)) {
+    fprintf(stderr, "Failed to write %s\n", dataset_filename);
+    return EXIT_FAILURE;
+  }
+
+  printf("%s -> %s: %zu rows, %zu inputs, %zu outputs, %zu skipped rows\n", csv_filename, dataset_filename,
+         dataset.num_rows, input_column_count, dataset.num_columns - input_column_count,
+         statistics.skipped_row_count);
+
+  arena_free_memory(normalization.column_min_values);
+  arena_free_memory(normalization.column_max_values);
+  arena_free_memory(dataset.element);
+
+  return EXIT_SUCCESS;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
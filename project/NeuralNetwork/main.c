@@ -7,22 +7,34 @@
 int
 main(void)
 {
-  srand(time(NULL));
+  random_set_global_seed((uint64_t)time(NULL));
 
   printf("=============[ NEURAL NETWORK - IRIS CLASSIFICATION ]============\n");
+  printf("・ Matrix kernels: %s\n", matrix_get_kernel_isa_name());
 
   // Inisialisasi arena memory
-  struct MemoryArena arena = arena_create(1024 * 1024 * 10); // 10MB
-
-  // Load dataset iris
-  printf("・ Loading dataset iris.csv...\n");
-  struct Matrix dataset = dataset_load_from_csv(&arena, "iris.csv", 1); // Skip header
+  struct MemoryArena arena = arena_create(0); // Chunk 1MB, bertambah otomatis jika kurang
+  arena_enable_statistics(&arena);            // Peak di akhir run = ukuran arena yang cukup
+  arena_set_tag(&arena, "dataset");
+
+  // Load dataset iris: pakai dataset biner hasil dataset_convert jika ada,
+  // sehingga tidak perlu parse CSV dan normalisasi ulang setiap run
+  struct BinaryDataset binary_dataset = {0};
+  struct Matrix dataset;
+
+  if (dataset_load_binary("iris.nnds", &binary_dataset)) {
+    printf("・ Loaded preprocessed dataset iris.nnds (mmap)\n");
+    dataset = binary_dataset.data;
+  } else {
+    printf("・ Loading dataset iris.csv...\n");
+    dataset = dataset_load_from_csv(&arena, "iris.csv", 2); // Skip sumber dan header
+
+    // Normalisasi data input (4 kolom pertama)
+    printf("・ Normalizing input features...\n");
+    matrix_normalize_minmax(dataset, 4, 0.0f, 1.0f);
+  }
   printf("・ Dataset loaded: %zu samples, %zu features\n", dataset.num_rows, dataset.num_columns);
 
-  // Normalisasi data input (4 kolom pertama)
-  printf("・ Normalizing input features...\n");
-  matrix_normalize_minmax(dataset, 4, 0.0f, 1.0f);
-
   // Shuffle dataset
   printf("・ Shuffling dataset...\n");
   matrix_shuffle_rows(dataset);
@@ -53,6 +65,7 @@ main(void)
   printf("\n");
 
   // Alokasi neural network
+  arena_set_tag(&arena, "network");
   struct NeuralNetwork nn = neural_network_allocate(&arena, arch, arch_count);
 
   // Initialize weights dengan nilai random
@@ -65,34 +78,32 @@ main(void)
   printf("-- Test accuracy: %.2f%%\n", 100.0f * neural_network_calculate_accuracy(nn, test_data));
   printf("-- Training cost: %.4f\n", neural_network_calculate_accuracy(nn, train_data));
 
-  // Training parameters
-  size_t epochs = 1000;
+  // Training parameters (Adam konvergen jauh lebih cepat dari SGD biasa)
+  size_t epochs = 100;
   size_t batch_size = 32;
-  float learning_rate = 0.1f;
+  float learning_rate = 0.03f;
 
   printf("\n・ Training parameters:\n");
+  printf("-- Optimizer: Adam\n");
   printf("-- Epochs: %zu\n", epochs);
   printf("-- Batch size: %zu\n", batch_size);
   printf("-- Learning rate: %.3f\n", learning_rate);
   printf("\n======================[ STARTING TRAINING ]======================\n");
 
-  // Create separate arena for temporary calculations during training
-  struct MemoryArena temp_arena =
-      arena_create(1024 * 1024 * 5); // 5MB for temporary calculations
+  // Workspace training dialokasikan sekali dan dipakai ulang setiap batch
+  arena_set_tag(&arena, "training");
+  struct TrainingWorkspace workspace = training_workspace_allocate(&arena, nn, batch_size);
+  struct Optimizer optimizer = optimizer_create(&arena, nn, OPTIMIZER_ADAM, learning_rate);
+
+  // Setiap epoch hanya permutasi indeks yang diacak; train_data tidak ditulis ulang
+  struct BatchSampler sampler = batch_sampler_create(&arena, train_data, batch_size);
 
   // Training loop
   for (size_t epoch = 0; epoch < epochs; ++epoch) {
-    // Shuffle training data setiap epoch
-    matrix_shuffle_rows(train_data);
-
-    struct BatchProcessor batch = {0};
-    while (!batch.is_epoch_finished) {
-      batch_process_training_data(&temp_arena, &batch, batch_size, nn, train_data, learning_rate);
-      arena_reset(&temp_arena); // Only reset temporary arena
-    }
+    batch_process_training_epoch_sampled(workspace, &optimizer, &sampler, nn, train_data);
 
-    // Print progress setiap 100 epoch
-    if ((epoch + 1) % 100 == 0 || epoch == 0 || epoch == epochs - 1) {
+    // Print progress setiap 10 epoch
+    if ((epoch + 1) % 10 == 0 || epoch == 0 || epoch == epochs - 1) {
       float train_acc = neural_network_calculate_accuracy(nn, train_data);
       float test_acc = neural_network_calculate_accuracy(nn, test_data);
       float cost = neural_network_calculate_cost(nn, train_data);
@@ -114,30 +125,97 @@ main(void)
   printf("-- Final test accuracy: %.2f%%\n", 100.0f * final_test_acc);
   printf("-- Final training cost: %.4f\n", final_cost);
 
+  // Kuantisasi int8 post-training, dibandingkan dengan model float pada test set
+  arena_set_tag(&arena, "quantized model");
+  struct QuantizedNeuralNetwork quantized_nn = neural_network_quantize(&arena, nn);
+
+  printf("\n・ Reduced precision inference (%s kernels):\n", matrix_get_kernel_isa_name());
+  printf("-- Parameter bytes: float %zu | int8 weights %zu\n",
+         nn.parameter_count * sizeof(float), quantized_nn.weight_bytes);
+  printf("-- Test accuracy: float %.2f%% | int8 %.2f%%\n", 100.0f * final_test_acc,
+         100.0f * quantized_network_calculate_accuracy(quantized_nn, test_data));
+
+  // Weights 16-bit; model fp32 tetap menjadi master weights
+  arena_set_tag(&arena, "half precision model");
+  struct HalfPrecisionNeuralNetwork fp16_nn = neural_network_convert_half_precision(&arena, nn, HALF_PRECISION_FP16);
+  struct HalfPrecisionNeuralNetwork bf16_nn = neural_network_convert_half_precision(&arena, nn, HALF_PRECISION_BF16);
+
+  printf("-- Test accuracy: fp16 weights %.2f%% | bf16 weights %.2f%%\n",
+         100.0f * half_precision_network_calculate_accuracy(fp16_nn, test_data),
+         100.0f * half_precision_network_calculate_accuracy(bf16_nn, test_data));
+
+  // Magnitude pruning pada salinan model, fine-tune dengan mask, lalu inferensi CSR.
+  // Model 4-8-3 hanya punya 56 weights: sparsity tinggi sering memutus neuron hidden
+  // sepenuhnya, sehingga hasil fine-tune sangat bergantung pada seed
+  arena_set_tag(&arena, "pruned model");
+  float target_sparsity = 0.3f;
+  size_t fine_tune_epochs = 100;
+  struct NeuralNetwork pruned_nn = neural_network_allocate(&arena, arch, arch_count);
+  neural_network_copy_parameters(pruned_nn, nn);
+
+  struct PruningMask pruning_mask = neural_network_prune_magnitude(&arena, pruned_nn, target_sparsity);
+  float pruned_test_acc = neural_network_calculate_accuracy(pruned_nn, test_data);
+
+  struct Optimizer fine_tune_optimizer = optimizer_create(&arena, pruned_nn, OPTIMIZER_ADAM, learning_rate / 3.0f);
+  fine_tune_optimizer.parameter_mask = pruning_mask.parameter_mask;
+  for (size_t epoch = 0; epoch < fine_tune_epochs; ++epoch)
+    batch_process_training_epoch_sampled(workspace, &fine_tune_optimizer, &sampler, pruned_nn, train_data);
+
+  struct SparseNeuralNetwork sparse_nn = neural_network_create_sparse(&arena, pruned_nn);
+
+  printf("\n・ Magnitude pruning (%.0f%% of weights, %zu fine-tune epochs):\n",
+         100.0f * neural_network_get_weight_sparsity(pruned_nn), fine_tune_epochs);
+  printf("-- Test accuracy: pruned %.2f%% | fine-tuned %.2f%% | sparse inference %.2f%%\n",
+         100.0f * pruned_test_acc, 100.0f * neural_network_calculate_accuracy(pruned_nn, test_data),
+         100.0f * sparse_network_calculate_accuracy(sparse_nn, test_data));
+
+  // Simpan model lalu muat ulang via mmap (weights tidak disalin)
+  const char *model_filename = "iris.nnmodel";
+  struct NeuralNetwork loaded_nn;
+  struct MappedFile model_mapping;
+
+  printf("\n・ Saving model to %s...\n", model_filename);
+  arena_set_tag(&arena, "loaded model");
+  if (neural_network_save_model(nn, model_filename) &&
+      neural_network_load_model(&arena, model_filename, true, &loaded_nn, &model_mapping)) {
+    printf("-- Loaded model test accuracy: %.2f%%\n",
+           100.0f * neural_network_calculate_accuracy(loaded_nn, test_data));
+    neural_network_unload_model(&model_mapping);
+  } else {
+    printf("-- Failed to save/load model\n");
+  }
+
   // Demo prediksi dengan beberapa sample dari test set
   printf("\n======================[ SAMPLE PREDICTIONS ]=====================\n");
   printf("・ Actual -> Predicted (Confidence)\n");
   printf("・ 0 = Setosa | 1 = Versicolor | 2 = Virginica\n");
   printf("-----------------------------------------------------------------\n");
 
-  for (size_t i = 0; i < 10 && i < test_data.num_rows; ++i) {
-    struct Row sample = matrix_get_row(test_data, i);
-    struct Row input = row_create_slice(sample, 0, 4);
-    struct Row target = row_create_slice(sample, 4, 3);
+  // Prediksi beberapa sample sekaligus
+  size_t sample_count = test_data.num_rows < 10 ? test_data.num_rows : 10;
+  struct Matrix samples = matrix_create_row_slice(test_data, 0, sample_count);
+  arena_set_tag(&arena, "prediction");
+  struct Matrix scores = matrix_allocate(&arena, sample_count, 3);
+  size_t predicted_labels[10];
 
-    // Copy input ke network
-    row_copy_data(nn.activation_vectors[0], input);
-    neural_network_forward_pass(nn);
+  neural_network_predict_batch(nn, samples, scores, predicted_labels);
+
+  for (size_t i = 0; i < sample_count; ++i) {
+    struct Row target = row_create_slice(matrix_get_row(samples, i), 4, 3);
 
     size_t actual = row_find_max_index(target);
-    size_t predicted = row_find_max_index(nn.activation_vectors[nn.total_layers - 1]);
-    float confidence = row_at(nn.activation_vectors[nn.total_layers - 1], predicted);
+    size_t predicted = predicted_labels[i];
+    float confidence = matrix_at(scores, i, predicted);
 
     printf("   %zu    ->    %zu     (%.3f) %s\n", actual, predicted, confidence,
            (actual == predicted) ? "✓" : "✗");
   }
 
-  printf("\n・ Classification Complete\n");
+  printf("\n・ Classification Complete\n\n");
+  arena_print_statistics(&arena, "・ Arena");
+
+  dataset_unload_binary(&binary_dataset);
+  arena_destroy(&arena);
 
   return 0;
 }
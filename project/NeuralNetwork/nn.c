@@ -11,11 +11,33 @@
  */
 
 #include "nn.h"
+#include "nn_simd.h"
 
 #include <stdio.h>
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+#if defined(NN_USE_PTHREADS)
+#include <pthread.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define NN_HAS_MMAP 1
+#endif
 
 // ==================[ ACTIVATION FUNCTIONS - IMPLEMENTATION ]==================
 
@@ -49,9 +71,7 @@ activation_relu(float input_value)
 float
 activation_tanh(float input_value)
 {
-    float exp_positive = expf(input_value);
-    float exp_negative = expf(-input_value);
-    return (exp_positive - exp_negative) / (exp_positive + exp_negative);
+    return tanhf(input_value);
 }
 
 /**
@@ -94,827 +114,5908 @@ activation_compute_derivative(float activated_value, enum ActivationType activat
     return 0.0f;
 }
 
-// ====================[ MEMORY MANAGEMENT - IMPLEMENTATION ]===================
+#if defined(NN_FAST_ACTIVATION)
+static enum ActivationPrecision activation_precision = ACTIVATION_PRECISION_FAST;
+#else
+static enum ActivationPrecision activation_precision = ACTIVATION_PRECISION_EXACT;
+#endif
 
 /**
- * @brief Membuat arena baru untuk manajemen memori
- * @param size_in_bytes Ukuran arena yang diinginkan dalam bytes
- * @return Struktur MemoryArena yang siap digunakan
+ * @brief Mengatur presisi sigmoid dan tanh untuk semua operasi array/matrix
+ * @param precision Presisi yang akan dipakai
  */
-struct MemoryArena
-arena_create(size_t size_in_bytes)
+void
+activation_set_precision(enum ActivationPrecision precision)
 {
-    struct MemoryArena arena = {0};
-    size_t buffer_element_size = sizeof(*arena.memory_buffer);
-    size_t total_capacity = (size_in_bytes + buffer_element_size - 1) / buffer_element_size;
-    uintptr_t *memory_buffer = (uintptr_t *)malloc(total_capacity * buffer_element_size);
-
-    assert(memory_buffer != NULL);
-
-    arena.total_capacity = total_capacity;
-    arena.memory_buffer = memory_buffer;
-
-    return arena;
+    activation_precision = precision;
 }
 
 /**
- * @brief Mengalokasikan memori dari arena atau menggunakan malloc biasa
- * @param arena_ptr Pointer ke arena (NULL untuk menggunakan malloc)
- * @param size_in_bytes Ukuran memori yang dibutuhkan dalam bytes
- * @return Pointer ke memori yang dialokasikan, atau NULL jika gagal
+ * @brief Mendapatkan presisi sigmoid dan tanh yang sedang dipakai
+ * @return Presisi aktif
  */
-void*
-arena_allocate_memory(struct MemoryArena *arena_ptr, size_t size_in_bytes)
+enum ActivationPrecision
+activation_get_precision(void)
 {
-    if (arena_ptr == NULL) return calloc(1, size_in_bytes);
-
-    size_t buffer_element_size = sizeof(*arena_ptr->memory_buffer);
-    size_t required_buffers = (size_in_bytes + buffer_element_size - 1) / buffer_element_size;
-
-    assert(arena_ptr->used_buffers + required_buffers <= arena_ptr->total_capacity);
-
-    if (arena_ptr->used_buffers + required_buffers > arena_ptr->total_capacity) return NULL;
+    return activation_precision;
+}
 
-    void *allocated_memory = &arena_ptr->memory_buffer[arena_ptr->used_buffers];
-    arena_ptr->used_buffers += required_buffers;
+/**
+ * @brief Menerapkan fungsi aktivasi ke seluruh array sekaligus (in-place)
+ * @param values Array nilai yang akan diproses
+ * @param count Jumlah elemen
+ * @param activation_type Tipe aktivasi yang akan diterapkan
+ */
+void
+activation_apply_array(float *values, size_t count, enum ActivationType activation_type)
+{
+    const struct SimdKernelTable *kernels = simd_get_kernels();
 
-    memset(allocated_memory, 0, size_in_bytes);
-    return allocated_memory;
+    if (activation_precision == ACTIVATION_PRECISION_FAST)
+        kernels->vector_activation_fast(values, count, activation_type);
+    else
+        kernels->vector_activation(values, count, activation_type);
 }
 
 /**
- * @brief Mereset arena untuk menggunakan ulang memori
- * @param arena_ptr Pointer ke arena yang akan direset
+ * @brief Mengalikan setiap gradient dengan turunan aktivasi
+ * @param gradient_values Array gradient (hasil disimpan di sini)
+ * @param activated_values Array nilai yang sudah melalui aktivasi
+ * @param count Jumlah elemen
+ * @param activation_type Tipe aktivasi
  */
 void
-arena_reset(struct MemoryArena *arena_ptr)
+activation_multiply_derivative_array(float *gradient_values,
+                                     const float *activated_values,
+                                     size_t count,
+                                     enum ActivationType activation_type)
 {
-    assert(arena_ptr != NULL);
-    arena_ptr->used_buffers = 0;
+    simd_get_kernels()->vector_activation_derivative(gradient_values, activated_values, count, activation_type);
 }
 
-// ====================[ MATRIX OPERATIONS - IMPLEMENTATION ]===================
+// ====================[ MEMORY MANAGEMENT - IMPLEMENTATION ]===================
 
 /**
- * @brief Mengalokasikan matrix baru dengan ukuran tertentu
- * @param arena_ptr Arena untuk alokasi memori
- * @param num_rows Jumlah baris matrix
- * @param num_columns Jumlah kolom matrix
- * @return Struktur Matrix yang siap digunakan
+ * @brief Ukuran chunk default saat arena_create dipanggil dengan ukuran 0
  */
-struct Matrix
-matrix_allocate(struct MemoryArena *arena_ptr, size_t num_rows, size_t num_columns)
-{
-    struct Matrix new_matrix;
+#define ARENA_DEFAULT_CHUNK_SIZE ((size_t)1024 * 1024)
 
-    new_matrix.num_rows = num_rows;
-    new_matrix.num_columns = num_columns;
-    new_matrix.element = arena_allocate_memory(arena_ptr, sizeof(*new_matrix.element) * num_rows * num_columns);
+/**
+ * @brief Alignment alokasi arena_allocate_memory (cukup untuk semua tipe skalar)
+ */
+#define ARENA_DEFAULT_ALIGNMENT ((size_t)16)
 
-    assert(new_matrix.element != NULL);
+/**
+ * @brief Header chunk arena; data dimulai satu cache line setelah header
+ */
+struct ArenaChunk
+{
+    struct ArenaChunk *previous_chunk;  // Chunk sebelumnya (atau chunk bebas berikutnya)
+    size_t capacity;                    // Kapasitas data dalam bytes
+    size_t used_bytes;                  // Byte data yang sudah dialokasikan
+    size_t mapped_size;                 // Ukuran mapping mmap (0 untuk chunk malloc)
+    enum ArenaBackend backend;          // Sumber memori chunk
+};
 
-    return new_matrix;
+_Static_assert(sizeof(struct ArenaChunk) <= ARENA_CACHE_LINE_SIZE, "header chunk harus muat satu cache line");
+
+/**
+ * @brief Membulatkan nilai ke atas ke kelipatan alignment (pangkat dua)
+ */
+static inline size_t
+arena_align_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
 }
 
 /**
- * @brief Mendapatkan baris tertentu dari matrix sebagai struktur Row
- * @param source_matrix Matrix sumber
- * @param row_index Indeks baris yang diinginkan
- * @return Struktur Row yang merepresentasikan baris tersebut
+ * @brief Mengalokasikan memori heap dengan alignment tertentu
+ *
+ * Semua alokasi aligned di luar arena lewat sini: MSVC tidak punya
+ * aligned_alloc, sehingga di sana dipakai _aligned_malloc. Memori harus
+ * dibebaskan dengan memory_free_aligned.
+ *
+ * @param size_in_bytes Ukuran memori dalam bytes
+ * @param alignment Alignment dalam bytes (pangkat dua)
+ * @return Pointer ke memori, atau NULL jika gagal
  */
-struct Row
-matrix_get_row(struct Matrix source_matrix, size_t row_index)
+static void *
+memory_allocate_aligned(size_t size_in_bytes, size_t alignment)
 {
-    assert(row_index < source_matrix.num_rows);
+    if (alignment < sizeof(void *)) alignment = sizeof(void *);
+    if (size_in_bytes == 0) size_in_bytes = 1;
+
+#if defined(_MSC_VER)
+    return _aligned_malloc(size_in_bytes, alignment);
+#else
+    // aligned_alloc mensyaratkan ukuran kelipatan alignment
+    return aligned_alloc(alignment, arena_align_up(size_in_bytes, alignment));
+#endif
+}
 
-    return (struct Row) {
-        .num_columns = source_matrix.num_columns,
-        .element = &matrix_at(source_matrix, row_index, 0)
-    };
+/**
+ * @brief Membebaskan memori dari memory_allocate_aligned
+ * @param memory Pointer memori (boleh NULL)
+ */
+static void
+memory_free_aligned(void *memory)
+{
+#if defined(_MSC_VER)
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
 }
 
 /**
- * @brief Mengkonversi Row menjadi Matrix 1xN
- * @param source_row Row yang akan dikonversi
- * @return Matrix dengan 1 baris yang berisi data dari Row
+ * @brief Awal area data chunk (64-byte aligned)
  */
-struct Matrix
-row_convert_to_matrix(struct Row source_row)
+static inline unsigned char *
+arena_chunk_data(struct ArenaChunk *chunk)
 {
-    return (struct Matrix) {
-        .num_rows = 1,
-        .num_columns = source_row.num_columns,
-        .element = source_row.element
-    };
+    return (unsigned char *)chunk + ARENA_CACHE_LINE_SIZE;
 }
 
 /**
- * @brief Membuat slice (potongan) dari Row
- * @param source_row Row sumber
- * @param start_index Indeks awal slice
- * @param slice_length Panjang slice
- * @return Row baru yang merupakan potongan dari row asli
+ * @brief Jumlah chunk per backend untuk seluruh proses
  */
-struct Row
-row_create_slice(struct Row source_row, size_t start_index, size_t slice_length)
+static size_t arena_backend_chunk_counts[ARENA_BACKEND_COUNT];
+
+/**
+ * @brief Memetakan memori anonim untuk chunk huge page
+ *
+ * MAP_HUGETLB dicoba lebih dulu. Jika gagal (tidak ada huge page yang
+ * dipesan), mapping biasa diperbesar 2 MB lalu dipangkas ke batas 2 MB
+ * agar kernel bisa memakai transparent huge page setelah madvise.
+ *
+ * @param mapped_size Ukuran mapping (kelipatan ARENA_HUGE_PAGE_SIZE)
+ * @param backend_output Backend yang berhasil dipakai
+ * @return Alamat mapping, atau NULL jika kedua cara gagal
+ */
+static void *
+arena_map_huge_pages(size_t mapped_size, enum ArenaBackend *backend_output)
 {
-    assert(start_index < source_row.num_columns);
-    assert(start_index + slice_length <= source_row.num_columns);
+#if defined(NN_HAS_MMAP) && defined(MAP_ANONYMOUS)
+#if defined(MAP_HUGETLB)
+    void *huge_address = mmap(NULL, mapped_size, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (huge_address != MAP_FAILED) {
+        *backend_output = ARENA_BACKEND_HUGETLB;
+        return huge_address;
+    }
+#endif
+
+#if defined(MADV_HUGEPAGE)
+    size_t reserved_size = mapped_size + ARENA_HUGE_PAGE_SIZE;
+    unsigned char *reserved_address = mmap(NULL, reserved_size, PROT_READ | PROT_WRITE,
+                                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved_address == MAP_FAILED) return NULL;
+
+    // Buang bagian sebelum dan sesudah rentang yang aligned 2 MB
+    unsigned char *aligned_address = (unsigned char *)arena_align_up((size_t)(uintptr_t)reserved_address,
+                                                                     ARENA_HUGE_PAGE_SIZE);
+    size_t head_size = (size_t)(aligned_address - reserved_address);
+    size_t tail_size = reserved_size - head_size - mapped_size;
+    if (head_size > 0) munmap(reserved_address, head_size);
+    if (tail_size > 0) munmap(aligned_address + mapped_size, tail_size);
+
+    if (madvise(aligned_address, mapped_size, MADV_HUGEPAGE) == 0) {
+        *backend_output = ARENA_BACKEND_TRANSPARENT_HUGE_PAGES;
+        return aligned_address;
+    }
 
-    return (struct Row) {
-        .num_columns = slice_length,
-        .element = &row_at(source_row, start_index)
-    };
+    munmap(aligned_address, mapped_size);
+#endif
+#else
+    (void)mapped_size;
+#endif
+    (void)backend_output;
+    return NULL;
 }
 
 /**
- * @brief Mengisi semua elemen matrix dengan nilai tertentu
- * @param target_matrix Matrix yang akan diisi
- * @param fill_value Nilai yang akan diisikan ke semua elemen
+ * @brief Mengalokasikan chunk baru
+ * @param capacity Kapasitas data minimum dalam bytes
+ * @param use_huge_pages true untuk mencoba huge page (hanya chunk minimal satu huge page)
+ * @return Chunk baru, atau NULL jika gagal
  */
-void
-matrix_fill_with_value(struct Matrix target_matrix, float fill_value)
+static struct ArenaChunk *
+arena_chunk_create(size_t capacity, bool use_huge_pages)
 {
-    for (size_t row_idx = 0; row_idx < target_matrix.num_rows; ++row_idx) {
-        for (size_t col_idx = 0; col_idx < target_matrix.num_columns; ++col_idx) {
-            matrix_at(target_matrix, row_idx, col_idx) = fill_value;
-        }
+    capacity = arena_align_up(capacity, ARENA_CACHE_LINE_SIZE);
+
+    struct ArenaChunk *chunk = NULL;
+    size_t mapped_size = 0;
+    enum ArenaBackend backend = ARENA_BACKEND_MALLOC;
+
+    if (use_huge_pages && ARENA_CACHE_LINE_SIZE + capacity >= ARENA_HUGE_PAGE_SIZE) {
+        mapped_size = arena_align_up(ARENA_CACHE_LINE_SIZE + capacity, ARENA_HUGE_PAGE_SIZE);
+        chunk = (struct ArenaChunk *)arena_map_huge_pages(mapped_size, &backend);
+
+        // Sisa huge page terakhir ikut menjadi kapasitas chunk
+        if (chunk != NULL) capacity = mapped_size - ARENA_CACHE_LINE_SIZE;
+    }
+
+    if (chunk == NULL) {
+        mapped_size = 0;
+        backend = ARENA_BACKEND_MALLOC;
+        chunk = (struct ArenaChunk *)memory_allocate_aligned(ARENA_CACHE_LINE_SIZE + capacity,
+                                                             ARENA_CACHE_LINE_SIZE);
+        if (chunk == NULL) return NULL;
     }
+
+    chunk->previous_chunk = NULL;
+    chunk->capacity = capacity;
+    chunk->used_bytes = 0;
+    chunk->mapped_size = mapped_size;
+    chunk->backend = backend;
+
+    // critical (bukan atomic read/write OpenMP 3.1) agar tetap dikompilasi di MSVC /openmp
+    #pragma omp critical(arena_backend_counts)
+    ++arena_backend_chunk_counts[backend];
+
+    return chunk;
 }
 
 /**
- * @brief Mengisi matrix dengan nilai random dalam range tertentu
- * @param target_matrix Matrix yang akan diisi
- * @param min_value Nilai minimum untuk random
- * @param max_value Nilai maksimum untuk random
+ * @brief Mengembalikan memori chunk ke sistem sesuai backend-nya
  */
-void
-matrix_fill_random(struct Matrix target_matrix, float min_value, float max_value)
+static void
+arena_chunk_destroy(struct ArenaChunk *chunk)
 {
-    for (size_t row_idx = 0; row_idx < target_matrix.num_rows; ++row_idx) {
-        for (size_t col_idx = 0; col_idx < target_matrix.num_columns; ++col_idx) {
-            matrix_at(target_matrix, row_idx, col_idx) = RAND_FLOAT() * (max_value - min_value) + min_value;
-        }
+#if defined(NN_HAS_MMAP)
+    if (chunk->mapped_size > 0) {
+        munmap(chunk, chunk->mapped_size);
+        return;
     }
+#endif
+    memory_free_aligned(chunk);
 }
 
 /**
- * @brief Menjumlahkan dua matrix secara element-wise
- * @param destination_matrix Matrix pertama (hasil akan disimpan di sini)
- * @param source_matrix Matrix kedua yang akan ditambahkan
+ * @brief Menjadikan chunk dengan kapasitas minimal tertentu sebagai chunk aktif
+ *
+ * Chunk bebas yang cukup besar dipakai ulang lebih dulu; jika tidak ada,
+ * chunk baru dialokasikan dengan ukuran minimal chunk_size arena.
+ *
+ * @param arena_ptr Pointer ke arena
+ * @param required_capacity Kapasitas data minimum dalam bytes
+ * @return Chunk aktif baru, atau NULL jika alokasi gagal
  */
-void
-matrix_add_elementwise(struct Matrix destination_matrix, struct Matrix source_matrix)
+static struct ArenaChunk *
+arena_push_chunk(struct MemoryArena *arena_ptr, size_t required_capacity)
 {
-    assert(destination_matrix.num_rows == source_matrix.num_rows);
-    assert(destination_matrix.num_columns == source_matrix.num_columns);
-
-    for (size_t row_idx = 0; row_idx < destination_matrix.num_rows; ++row_idx) {
-        for (size_t col_idx = 0; col_idx < destination_matrix.num_columns; ++col_idx) {
-            matrix_at(destination_matrix, row_idx, col_idx) += matrix_at(source_matrix, row_idx, col_idx);
+    struct ArenaChunk **free_link = &arena_ptr->free_chunks;
+    while (*free_link != NULL && (*free_link)->capacity < required_capacity)
+        free_link = &(*free_link)->previous_chunk;
+
+    struct ArenaChunk *chunk = *free_link;
+    if (chunk != NULL) {
+        *free_link = chunk->previous_chunk;
+    } else {
+        chunk = arena_chunk_create(required_capacity > arena_ptr->chunk_size ? required_capacity
+                                                                             : arena_ptr->chunk_size,
+                                   arena_ptr->use_huge_pages);
+        if (chunk == NULL) return NULL;
+
+        if (arena_ptr->statistics != NULL) {
+            arena_ptr->statistics->reserved_bytes += chunk->capacity;
+            ++arena_ptr->statistics->chunk_count;
         }
     }
+
+    chunk->used_bytes = 0;
+    chunk->previous_chunk = arena_ptr->current_chunk;
+    arena_ptr->current_chunk = chunk;
+    return chunk;
 }
 
 /**
- * @brief Melakukan perkalian matrix (dot product)
- * @param result_matrix Matrix untuk menyimpan hasil
- * @param matrix_a Matrix pertama
- * @param matrix_b Matrix kedua
+ * @brief Membuat arena dengan chunk pertama yang langsung dialokasikan
+ * @param size_in_bytes Ukuran chunk pertama dan minimum chunk berikutnya (0 untuk default)
+ * @param use_huge_pages true untuk chunk huge page
+ * @return Struktur MemoryArena yang siap digunakan
  */
-void
-matrix_multiply_dot_product(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b)
+static struct MemoryArena
+arena_create_with_backend(size_t size_in_bytes, bool use_huge_pages)
 {
-    assert(matrix_a.num_columns == matrix_b.num_rows);
-    assert(result_matrix.num_rows == matrix_a.num_rows);
-    assert(result_matrix.num_columns == matrix_b.num_columns);
+    struct MemoryArena arena = {0};
+    arena.chunk_size = size_in_bytes > 0 ? size_in_bytes : ARENA_DEFAULT_CHUNK_SIZE;
+    arena.use_huge_pages = use_huge_pages;
 
-    for (size_t row_idx = 0; row_idx < result_matrix.num_rows; ++row_idx) {
-        for (size_t col_idx = 0; col_idx < result_matrix.num_columns; ++col_idx) {
+    struct ArenaChunk *first_chunk = arena_push_chunk(&arena, arena.chunk_size);
+    assert(first_chunk != NULL);
+    (void)first_chunk;
 
-            matrix_at(result_matrix, row_idx, col_idx) = 0.0f;
+    return arena;
+}
 
-            for (size_t inner_idx = 0; inner_idx < matrix_a.num_columns; ++inner_idx) {
-                matrix_at(result_matrix, row_idx, col_idx) +=
-                        matrix_at(matrix_a, row_idx, inner_idx) * matrix_at(matrix_b, inner_idx, col_idx);
-            }
-        }
-    }
+/**
+ * @brief Membuat arena baru untuk manajemen memori
+ * @param size_in_bytes Ukuran chunk pertama dan minimum chunk berikutnya (0 untuk default)
+ * @return Struktur MemoryArena yang siap digunakan
+ */
+struct MemoryArena
+arena_create(size_t size_in_bytes)
+{
+    return arena_create_with_backend(size_in_bytes, false);
 }
 
 /**
- * @brief Menyalin isi matrix sumber ke matrix tujuan
- * @param destination_matrix Matrix tujuan
- * @param source_matrix Matrix sumber
+ * @brief Membuat arena yang chunk besarnya memakai huge page
+ * @param size_in_bytes Ukuran chunk pertama dan minimum chunk berikutnya (0 untuk default)
+ * @return Struktur MemoryArena yang siap digunakan
  */
-void
-matrix_copy_data(struct Matrix destination_matrix, struct Matrix source_matrix)
+struct MemoryArena
+arena_create_huge_pages(size_t size_in_bytes)
 {
-    assert(destination_matrix.num_rows == source_matrix.num_rows);
-    assert(destination_matrix.num_columns == source_matrix.num_columns);
+    return arena_create_with_backend(size_in_bytes, true);
+}
 
-    for (size_t row_idx = 0; row_idx < destination_matrix.num_rows; ++row_idx) {
-        for (size_t col_idx = 0; col_idx < destination_matrix.num_columns; ++col_idx) {
-            matrix_at(destination_matrix, row_idx, col_idx) = matrix_at(source_matrix, row_idx, col_idx);
-        }
-    }
+/**
+ * @brief Jumlah chunk arena yang dialokasikan dengan backend tertentu
+ * @param backend Backend
+ * @return Jumlah chunk sejak program mulai
+ */
+size_t
+arena_get_backend_chunk_count(enum ArenaBackend backend)
+{
+    assert(backend < ARENA_BACKEND_COUNT);
+
+    size_t chunk_count;
+    #pragma omp critical(arena_backend_counts)
+    chunk_count = arena_backend_chunk_counts[backend];
+    return chunk_count;
 }
 
 /**
- * @brief Menerapkan fungsi aktivasi ke semua elemen matrix
- * @param target_matrix Matrix yang akan diproses
- * @param activation_type Tipe fungsi aktivasi yang akan diterapkan
+ * @brief Nama backend arena
+ * @param backend Backend
+ * @return Nama backend
  */
-void
-matrix_apply_activation(struct Matrix target_matrix, enum ActivationType activation_type)
+const char *
+arena_get_backend_name(enum ArenaBackend backend)
 {
-    for (size_t row_idx = 0; row_idx < target_matrix.num_rows; ++row_idx) {
-        for (size_t col_idx = 0; col_idx < target_matrix.num_columns; ++col_idx) {
-            matrix_at(target_matrix, row_idx, col_idx) =
-                activation_apply(matrix_at(target_matrix, row_idx, col_idx), activation_type);
-        }
+    switch (backend) {
+        case ARENA_BACKEND_MALLOC: return "malloc";
+        case ARENA_BACKEND_HUGETLB: return "hugetlb";
+        case ARENA_BACKEND_TRANSPARENT_HUGE_PAGES: return "thp";
+        default: return "unknown";
     }
 }
 
 /**
- * @brief Mencetak matrix ke console dengan format yang rapi
- * @param input_matrix Matrix yang akan dicetak
- * @param matrix_name Nama matrix untuk label
- * @param indent_padding Jumlah spasi untuk indentasi
+ * @brief Mencatat satu alokasi di statistik arena
+ * @param statistics Statistik arena
+ * @param tag Tag alokasi
+ * @param requested_bytes Byte yang diminta
+ * @param padded_bytes Byte yang terpakai termasuk padding alignment
  */
-void
-matrix_print_to_console(struct Matrix input_matrix, const char *matrix_name, size_t indent_padding)
+static void
+arena_record_allocation(struct ArenaStatistics *statistics, const char *tag,
+                        size_t requested_bytes, size_t padded_bytes)
 {
-    printf("%*s%s = [\n", (int)indent_padding, "", matrix_name);
-    for (size_t row_idx = 0; row_idx < input_matrix.num_rows; ++row_idx) {
-        printf("%*s    ", (int)indent_padding, "");
-        for (size_t col_idx = 0; col_idx < input_matrix.num_columns; ++col_idx) {
-            printf("%f ", matrix_at(input_matrix, row_idx, col_idx));
+    ++statistics->allocation_count;
+    statistics->requested_bytes += requested_bytes;
+    statistics->padded_bytes += padded_bytes;
+    statistics->used_bytes += padded_bytes;
+    if (statistics->used_bytes > statistics->peak_used_bytes) statistics->peak_used_bytes = statistics->used_bytes;
+
+    // Cari entri histogram untuk tag; tag yang tidak muat digabung ke entri terakhir
+    size_t tag_idx = 0;
+    while (tag_idx < statistics->tag_count &&
+           statistics->tags[tag_idx].tag != tag &&
+           (statistics->tags[tag_idx].tag == NULL || tag == NULL || strcmp(statistics->tags[tag_idx].tag, tag) != 0))
+        ++tag_idx;
+
+    if (tag_idx == statistics->tag_count) {
+        if (statistics->tag_count < ARENA_STATISTICS_MAX_TAGS) {
+            statistics->tags[statistics->tag_count++] = (struct ArenaTagStatistics) { .tag = tag };
+        } else {
+            tag_idx = ARENA_STATISTICS_MAX_TAGS - 1;
+            statistics->tags[tag_idx].tag = "(other)";
         }
-        printf("\n");
     }
-    printf("%*s]\n", (int)indent_padding, "");
-}
 
-// =====================[ NEURAL NETWORK - IMPLEMENTATION ]=====================
+    ++statistics->tags[tag_idx].allocation_count;
+    statistics->tags[tag_idx].requested_bytes += requested_bytes;
+}
 
 /**
- * @brief Mengalokasikan neural network baru dengan arsitektur tertentu
- * @param arena_ptr Arena untuk alokasi memori
- * @param layer_architecture Array berisi ukuran setiap layer
- * @param total_layers Jumlah layer dalam arsitektur
- * @return Neural network yang siap digunakan
+ * @brief Mengalokasikan memori dari arena tanpa mengisi nol
+ *
+ * Jalur cepatnya hanya pointer bump di chunk aktif; chunk baru disambung
+ * hanya saat chunk aktif tidak cukup.
+ *
+ * @param arena_ptr Pointer ke arena (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param size_in_bytes Ukuran memori yang dibutuhkan dalam bytes
+ * @param alignment Alignment dalam bytes (pangkat dua)
+ * @return Pointer ke memori yang dialokasikan, atau NULL jika gagal
  */
-struct NeuralNetwork
-neural_network_allocate(struct MemoryArena *arena_ptr, size_t *layer_architecture, size_t total_layers)
+void*
+arena_allocate_uninitialized(struct MemoryArena *arena_ptr, size_t size_in_bytes, size_t alignment)
 {
-    assert(total_layers > 1);
-
-    struct NeuralNetwork neural_network;
-    neural_network.layer_sizes = layer_architecture;
-    neural_network.total_layers = total_layers;
-
-    // Alokasi array untuk weights, biases, activations, dan activation types
-    neural_network.weight_matrices = arena_allocate_memory(
-            arena_ptr, sizeof(*neural_network.weight_matrices) * (total_layers - 1));
-    assert(neural_network.weight_matrices != NULL);
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
 
-    neural_network.bias_vectors = arena_allocate_memory(
-            arena_ptr, sizeof(*neural_network.bias_vectors) * (total_layers - 1));
-    assert(neural_network.bias_vectors != NULL);
+    if (arena_ptr == NULL) return memory_allocate_aligned(size_in_bytes, alignment);
 
-    neural_network.activation_vectors = arena_allocate_memory(
-            arena_ptr, sizeof(*neural_network.activation_vectors) * total_layers);
-    assert(neural_network.activation_vectors != NULL);
+    struct ArenaChunk *chunk = arena_ptr->current_chunk;
+    for (int attempt_idx = 0; attempt_idx < 2; ++attempt_idx) {
+        if (chunk != NULL) {
+            uintptr_t data_address = (uintptr_t)arena_chunk_data(chunk);
+            size_t offset = (size_t)(((data_address + chunk->used_bytes + alignment - 1) & ~(uintptr_t)(alignment - 1))
+                                     - data_address);
 
-    neural_network.activation_types = arena_allocate_memory(
-            arena_ptr, sizeof(*neural_network.activation_types) * total_layers);
-    assert(neural_network.activation_types != NULL);
+            if (offset <= chunk->capacity && size_in_bytes <= chunk->capacity - offset) {
+                if (arena_ptr->statistics != NULL)
+                    arena_record_allocation(arena_ptr->statistics, arena_ptr->current_tag, size_in_bytes,
+                                            offset + size_in_bytes - chunk->used_bytes);
 
-    // Setup input layer (tidak ada aktivasi)
-    neural_network.activation_vectors[0] = row_allocate(arena_ptr, layer_architecture[0]);
-    neural_network.activation_types[0] = ACTIVATION_NONE;
+                chunk->used_bytes = offset + size_in_bytes;
+                return (void *)(data_address + offset);
+            }
+        }
 
-    // Setup hidden dan output layers
-    for (size_t layer_idx = 1; layer_idx < total_layers; ++layer_idx) {
-        neural_network.weight_matrices[layer_idx - 1] =
-            matrix_allocate(arena_ptr, layer_architecture[layer_idx - 1], layer_architecture[layer_idx]);
-        neural_network.bias_vectors[layer_idx - 1] = row_allocate(arena_ptr, layer_architecture[layer_idx]);
-        neural_network.activation_vectors[layer_idx] = row_allocate(arena_ptr, layer_architecture[layer_idx]);
-        neural_network.activation_types[layer_idx] = ACTIVATION_RELU; // Default hidden layer activation
+        // Data chunk 64-byte aligned, jadi padding hanya perlu untuk alignment yang lebih besar
+        size_t alignment_padding = alignment > ARENA_CACHE_LINE_SIZE ? alignment - ARENA_CACHE_LINE_SIZE : 0;
+        chunk = arena_push_chunk(arena_ptr, size_in_bytes + alignment_padding);
+        if (chunk == NULL) return NULL;
     }
 
-    // Output layer menggunakan sigmoid untuk klasifikasi
-    neural_network.activation_types[total_layers - 1] = ACTIVATION_SIGMOID;
-
-    return neural_network;
+    assert(false && "chunk baru selalu cukup untuk alokasi");
+    return NULL;
 }
 
 /**
- * @brief Mengisi semua weights dan biases dengan nol
- * @param network Neural network yang akan di-zero
+ * @brief Mengalokasikan memori dengan alignment tertentu dan mengisinya dengan nol
+ * @param arena_ptr Pointer ke arena (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param size_in_bytes Ukuran memori yang dibutuhkan dalam bytes
+ * @param alignment Alignment dalam bytes (pangkat dua)
+ * @return Pointer ke memori yang dialokasikan, atau NULL jika gagal
  */
-void
-neural_network_zero_weights(struct NeuralNetwork network)
+void*
+arena_allocate_aligned(struct MemoryArena *arena_ptr, size_t size_in_bytes, size_t alignment)
 {
-    size_t last_layer_index = network.total_layers - 1;
-
-    for (size_t layer_idx = 0; layer_idx < last_layer_index; ++layer_idx) {
-        matrix_fill_with_value(network.weight_matrices[layer_idx], 0);
-        row_fill_with_value(network.bias_vectors[layer_idx], 0);
-        row_fill_with_value(network.activation_vectors[layer_idx], 0);
-    }
-
-    row_fill_with_value(network.activation_vectors[last_layer_index], 0);
+#if !defined(_MSC_VER)
+    // calloc mendapat halaman nol langsung dari OS untuk alokasi besar; di MSVC
+    // memori _aligned_malloc tidak boleh dicampur dengan free, jadi semua lewat jalur aligned
+    if (arena_ptr == NULL && alignment <= ARENA_DEFAULT_ALIGNMENT) return calloc(1, size_in_bytes);
+#endif
+
+    void *allocated_memory = arena_allocate_uninitialized(arena_ptr, size_in_bytes, alignment);
+    if (allocated_memory != NULL) memset(allocated_memory, 0, size_in_bytes);
+    return allocated_memory;
 }
 
 /**
- * @brief Melakukan forward propagation pada neural network
- * @param network Neural network yang akan diproses
- */
-void
-neural_network_forward_pass(struct NeuralNetwork network)
+ * @brief Mengalokasikan memori dari arena atau menggunakan malloc biasa
+ * @param arena_ptr Pointer ke arena (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param size_in_bytes Ukuran memori yang dibutuhkan dalam bytes
+ * @return Pointer ke memori yang dialokasikan, atau NULL jika gagal
+ */
+void*
+arena_allocate_memory(struct MemoryArena *arena_ptr, size_t size_in_bytes)
 {
-    assert(network.total_layers > 1);
-
-    // Proses setiap layer dari input ke output
-    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
-        // Perkalian matrix: activation[i] * weights[i]
-        matrix_multiply_dot_product(
-                row_convert_to_matrix(network.activation_vectors[layer_idx + 1]),
-                row_convert_to_matrix(network.activation_vectors[layer_idx]),
-                network.weight_matrices[layer_idx]);
-
-        // Tambahkan bias
-        matrix_add_elementwise(
-                row_convert_to_matrix(network.activation_vectors[layer_idx + 1]),
-                row_convert_to_matrix(network.bias_vectors[layer_idx]));
-
-        // Terapkan fungsi aktivasi
-        matrix_apply_activation(
-                row_convert_to_matrix(network.activation_vectors[layer_idx + 1]),
-                network.activation_types[layer_idx + 1]);
-    }
+    return arena_allocate_aligned(arena_ptr, size_in_bytes, ARENA_DEFAULT_ALIGNMENT);
 }
 
 /**
- * @brief Menghitung gradient menggunakan backpropagation
- * @param arena_ptr Arena untuk alokasi temporary
- * @param network Neural network
- * @param training_data Matrix berisi data training (input + output)
- * @return Neural network berisi gradient
+ * @brief Membebaskan memori yang dialokasikan dengan arena_ptr NULL
+ * @param memory Pointer dari fungsi alokasi arena dengan arena_ptr NULL (boleh NULL)
  */
-struct NeuralNetwork
-neural_network_compute_gradients(struct MemoryArena *arena_ptr,
-                                 struct NeuralNetwork network,
-                                 struct Matrix training_data)
+void
+arena_free_memory(void *memory)
 {
-    size_t sample_count = training_data.num_rows;
-    size_t input_columns = network.layer_sizes[0];
-    size_t output_columns = network.layer_sizes[network.total_layers - 1];
+    memory_free_aligned(memory);
+}
 
-    // Buat gradient network dengan struktur yang sama
-    struct NeuralNetwork gradient_network =
-        neural_network_allocate(arena_ptr, network.layer_sizes, network.total_layers);
-    neural_network_zero_weights(gradient_network);
+/**
+ * @brief Menyimpan posisi arena saat ini
+ * @param arena_ptr Pointer ke arena
+ * @return Marker untuk arena_restore
+ */
+struct ArenaMarker
+arena_save(struct MemoryArena *arena_ptr)
+{
+    assert(arena_ptr != NULL);
 
-    // Proses setiap sample dalam training data
-    for (size_t sample_idx = 0; sample_idx < sample_count; ++sample_idx) {
-        struct Row sample_row = matrix_get_row(training_data, sample_idx);
-        assert(input_columns + output_columns <= sample_row.num_columns);
+    struct ArenaChunk *chunk = arena_ptr->current_chunk;
+    return (struct ArenaMarker) { .chunk = chunk, .used_bytes = chunk != NULL ? chunk->used_bytes : 0 };
+}
 
-        struct Row input_data = row_create_slice(sample_row, 0, input_columns);
-        struct Row target_output = row_create_slice(sample_row, input_columns, output_columns);
+/**
+ * @brief Total byte terpakai di daftar chunk yang terhubung lewat previous_chunk
+ */
+static size_t
+arena_chunk_list_used_bytes(const struct ArenaChunk *chunk)
+{
+    size_t used_bytes = 0;
+    for (; chunk != NULL; chunk = chunk->previous_chunk) used_bytes += chunk->used_bytes;
+    return used_bytes;
+}
 
-        // Forward pass
-        row_copy_data(network.activation_vectors[0], input_data);
-        neural_network_forward_pass(network);
-
-        // Reset gradient activations untuk sample ini
-        for (size_t layer_idx = 0; layer_idx < network.total_layers; ++layer_idx)
-            row_fill_with_value(gradient_network.activation_vectors[layer_idx], 0.0f);
-
-        // Hitung error di output layer
-        struct Row network_output = network.activation_vectors[network.total_layers - 1];
-        struct Row gradient_output = gradient_network.activation_vectors[network.total_layers - 1];
-
-        for (size_t output_idx = 0; output_idx < output_columns; ++output_idx)
-            gradient_output.element[output_idx] =
-                network_output.element[output_idx] - target_output.element[output_idx];
-
-        // Backpropagation dari output ke input
-        for (size_t layer_idx = network.total_layers - 1; layer_idx > 0; --layer_idx) {
-            size_t current_layer_size = network.activation_vectors[layer_idx].num_columns;
-            size_t previous_layer_size = network.activation_vectors[layer_idx - 1].num_columns;
-
-            struct Row current_activation = network.activation_vectors[layer_idx];
-            struct Row current_gradient = gradient_network.activation_vectors[layer_idx];
-            struct Row previous_gradient = gradient_network.activation_vectors[layer_idx - 1];
-            struct Matrix current_weights = network.weight_matrices[layer_idx - 1];
-            struct Matrix gradient_weights = gradient_network.weight_matrices[layer_idx - 1];
-            struct Row gradient_bias = gradient_network.bias_vectors[layer_idx - 1];
-
-            // Hitung gradient untuk layer ini
-            for (size_t neuron_idx = 0; neuron_idx < current_layer_size; ++neuron_idx) {
-                float activation_value = current_activation.element[neuron_idx];
-                float error_value = current_gradient.element[neuron_idx];
-                float derivative_value =
-                    activation_compute_derivative(activation_value, network.activation_types[layer_idx]);
-
-                // Gradient bias
-                gradient_bias.element[neuron_idx] += error_value * derivative_value;
-
-                // Gradient weights dan propagasi error ke layer sebelumnya
-                for (size_t prev_neuron_idx = 0; prev_neuron_idx < previous_layer_size; ++prev_neuron_idx) {
-                    float previous_activation = network.activation_vectors[layer_idx - 1].element[prev_neuron_idx];
-                    float weight_gradient = error_value * derivative_value * previous_activation;
-
-                    matrix_at(gradient_weights, prev_neuron_idx, neuron_idx) += weight_gradient;
-                    previous_gradient.element[prev_neuron_idx] +=
-                            error_value * derivative_value * matrix_at(current_weights, prev_neuron_idx, neuron_idx);
-                }
-            }
-        }
-    }
+/**
+ * @brief Mengembalikan arena ke posisi marker
+ * @param arena_ptr Pointer ke arena
+ * @param marker Marker dari arena_save
+ */
+void
+arena_restore(struct MemoryArena *arena_ptr, struct ArenaMarker marker)
+{
+    assert(arena_ptr != NULL);
 
-    // Rata-rata gradient dari semua sample
-    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
-        struct Matrix weight_gradients = gradient_network.weight_matrices[layer_idx];
-        struct Row bias_gradients = gradient_network.bias_vectors[layer_idx];
+    // Chunk yang disambung setelah marker dipindah ke daftar chunk bebas
+    while (arena_ptr->current_chunk != marker.chunk) {
+        struct ArenaChunk *chunk = arena_ptr->current_chunk;
+        assert(chunk != NULL && "marker bukan milik arena ini");
 
-        for (size_t row_idx = 0; row_idx < weight_gradients.num_rows; ++row_idx)
-            for (size_t col_idx = 0; col_idx < weight_gradients.num_columns; ++col_idx)
-                matrix_at(weight_gradients, row_idx, col_idx) /= sample_count;
+        arena_ptr->current_chunk = chunk->previous_chunk;
+        chunk->previous_chunk = arena_ptr->free_chunks;
+        arena_ptr->free_chunks = chunk;
+    }
 
-        for (size_t bias_idx = 0; bias_idx < bias_gradients.num_columns; ++bias_idx)
-            bias_gradients.element[bias_idx] /= sample_count;
+    if (marker.chunk != NULL) {
+        assert(marker.used_bytes <= marker.chunk->used_bytes);
+        marker.chunk->used_bytes = marker.used_bytes;
     }
 
-    return gradient_network;
+    if (arena_ptr->statistics != NULL)
+        arena_ptr->statistics->used_bytes = arena_chunk_list_used_bytes(arena_ptr->current_chunk);
 }
 
 /**
- * @brief Menerapkan gradient untuk memperbarui weights dan biases
- * @param network Neural network yang akan diupdate
- * @param gradient_network Neural network berisi gradient
- * @param learning_rate Learning rate untuk update
+ * @brief Mereset arena untuk menggunakan ulang memori
+ * @param arena_ptr Pointer ke arena yang akan direset
  */
 void
-neural_network_apply_gradients(struct NeuralNetwork network,
-                               struct NeuralNetwork gradient_network,
-                               float learning_rate)
+arena_reset(struct MemoryArena *arena_ptr)
 {
-    // Update weights dan biases menggunakan gradient descent
-    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
-        // Update weights
-        for (size_t row_idx = 0; row_idx < network.weight_matrices[layer_idx].num_rows; ++row_idx) {
-            for (size_t col_idx = 0; col_idx < network.weight_matrices[layer_idx].num_columns; ++col_idx) {
-                matrix_at(network.weight_matrices[layer_idx], row_idx, col_idx) -=
-                        learning_rate * matrix_at(gradient_network.weight_matrices[layer_idx], row_idx, col_idx);
-            }
-        }
-
-        // Update biases
-        for (size_t bias_idx = 0; bias_idx < network.bias_vectors[layer_idx].num_columns; ++bias_idx) {
-            row_at(network.bias_vectors[layer_idx], bias_idx) -=
-                    learning_rate * row_at(gradient_network.bias_vectors[layer_idx], bias_idx);
-        }
-    }
+    assert(arena_ptr != NULL);
+    arena_restore(arena_ptr, (struct ArenaMarker) {0});
 }
 
-// ===================[ DATASET OPERATIONS - IMPLEMENTATION ]===================
-
 /**
- * @brief Memuat dataset dari file CSV
- * @param arena_ptr Arena untuk alokasi memori
- * @param csv_filename Nama file CSV yang akan dimuat
- * @param skip_header_lines Jumlah baris header yang akan dilewati
- * @return Matrix berisi data dari CSV
+ * @brief Membebaskan daftar chunk yang terhubung lewat previous_chunk
  */
-struct Matrix dataset_load_from_csv(struct MemoryArena *arena_ptr, const char *csv_filename, size_t skip_header_lines)
+static void
+arena_free_chunk_list(struct ArenaChunk *chunk)
 {
-    enum {
-        MAX_ROWS = 2048,
-        INPUT_FEATURES = 4,    // Features in Iris dataset
-        OUTPUT_CLASSES = 3,    // Class count: setosa, versicolor, virginica
-        TOTAL_COLUMNS = INPUT_FEATURES + OUTPUT_CLASSES,
-        MAX_LINE_LENGTH = 4096
-    };
-
-    FILE *csv_file = fopen(csv_filename, "r");
-    assert(csv_file && "Gagal membuka file CSV");
-
-    struct Matrix dataset = matrix_allocate(arena_ptr, MAX_ROWS, TOTAL_COLUMNS);
-    matrix_fill_with_value(dataset, 0.0f);
-
-    char line[MAX_LINE_LENGTH];
-    size_t row_index = 0;
-
-    // Skip header lines
-    for (size_t i = 0; i < skip_header_lines; ++i) {
-        if (!fgets(line, sizeof(line), csv_file))
-            break;  // Jika header lebih banyak dari jumlah baris, keluar
+    while (chunk != NULL) {
+        struct ArenaChunk *previous_chunk = chunk->previous_chunk;
+        arena_chunk_destroy(chunk);
+        chunk = previous_chunk;
     }
+}
 
-    while (fgets(line, sizeof(line), csv_file) && row_index < dataset.num_rows) {
-        float features[INPUT_FEATURES];
-        int label = -1;
+/**
+ * @brief Membebaskan seluruh memori milik arena
+ * @param arena_ptr Pointer ke arena yang akan dibebaskan
+ */
+void
+arena_destroy(struct MemoryArena *arena_ptr)
+{
+    assert(arena_ptr != NULL);
 
-        int parsed = sscanf(line, "%f,%f,%f,%f,%d",
-                            &features[0], &features[1], &features[2], &features[3], &label);
+    arena_free_chunk_list(arena_ptr->current_chunk);
+    arena_free_chunk_list(arena_ptr->free_chunks);
+    free(arena_ptr->statistics);
+    *arena_ptr = (struct MemoryArena) {0};
+}
 
-        if (parsed != 5)
-            continue;
+/**
+ * @brief Mengaktifkan statistik pemakaian arena
+ * @param arena_ptr Pointer ke arena
+ */
+void
+arena_enable_statistics(struct MemoryArena *arena_ptr)
+{
+    assert(arena_ptr != NULL);
+    if (arena_ptr->statistics != NULL) return;
 
-        // Pastikan label valid
-        assert(label >= 0 && label < OUTPUT_CLASSES && "Label class diluar jangkauan");
+    struct ArenaStatistics *statistics = (struct ArenaStatistics *)calloc(1, sizeof(*statistics));
+    assert(statistics != NULL);
 
-        // Simpan fitur input
-        for (size_t i = 0; i < INPUT_FEATURES; ++i) {
-            matrix_at(dataset, row_index, i) = features[i];
+    // Chunk yang sudah ada (termasuk chunk bebas) ikut dihitung
+    const struct ArenaChunk *chunk_lists[] = { arena_ptr->current_chunk, arena_ptr->free_chunks };
+    for (size_t list_idx = 0; list_idx < 2; ++list_idx) {
+        for (const struct ArenaChunk *chunk = chunk_lists[list_idx]; chunk != NULL; chunk = chunk->previous_chunk) {
+            statistics->reserved_bytes += chunk->capacity;
+            ++statistics->chunk_count;
         }
-
-        // One-hot encoding untuk label output
-        matrix_at(dataset, row_index, INPUT_FEATURES + (size_t)label) = 1.0f;
-
-        ++row_index;
     }
 
-    fclose(csv_file);
-
-    dataset.num_rows = row_index;
-    dataset.num_columns = TOTAL_COLUMNS;
-
-    return dataset;
+    statistics->used_bytes = arena_chunk_list_used_bytes(arena_ptr->current_chunk);
+    statistics->peak_used_bytes = statistics->used_bytes;
+    arena_ptr->statistics = statistics;
 }
 
 /**
- * @brief Membuat slice dari beberapa baris matrix
- * @param source_matrix Matrix sumber
- * @param start_row Baris awal slice
- * @param num_rows Jumlah baris yang diambil
- * @return Matrix baru yang merupakan slice dari matrix asli
+ * @brief Mengatur tag untuk alokasi berikutnya
+ * @param arena_ptr Pointer ke arena
+ * @param tag Nama tag (NULL untuk tanpa tag)
+ * @return Tag sebelumnya
  */
-struct Matrix
-matrix_create_row_slice(struct Matrix source_matrix, size_t start_row, size_t num_rows)
+const char *
+arena_set_tag(struct MemoryArena *arena_ptr, const char *tag)
 {
-    assert(start_row + num_rows <= source_matrix.num_rows);
+    assert(arena_ptr != NULL);
 
-    return (struct Matrix) {
-        .num_rows = num_rows,
-        .num_columns = source_matrix.num_columns,
-        .element = &matrix_at(source_matrix, start_row, 0)
-    };
+    const char *previous_tag = arena_ptr->current_tag;
+    arena_ptr->current_tag = tag;
+    return previous_tag;
 }
 
-// ====================[ BATCH PROCESSING - IMPLEMENTATION ]====================
-
 /**
- * @brief Memproses satu batch data untuk training
- * @param arena_ptr Arena untuk alokasi temporary
- * @param batch_processor Struktur batch yang melacak progress
- * @param batch_size Ukuran batch
- * @param network Neural network yang akan dilatih
- * @param training_dataset Dataset training
- * @param learning_rate Learning rate untuk update
+ * @brief Mengambil salinan statistik arena
+ * @param arena_ptr Pointer ke arena
+ * @param statistics_output Statistik hasil
+ * @return true jika statistik diaktifkan
  */
-void
-batch_process_training_data(struct MemoryArena *arena_ptr,
-                            struct BatchProcessor *batch_processor,
-                            size_t batch_size,
-                            struct NeuralNetwork network,
-                            struct Matrix training_dataset,
-                            float learning_rate)
+bool
+arena_get_statistics(const struct MemoryArena *arena_ptr, struct ArenaStatistics *statistics_output)
 {
-    // Reset jika epoch selesai
-    if (batch_processor->is_epoch_finished) {
-        batch_processor->current_start_idx = 0;
-        batch_processor->accumulated_cost = 0.0f;
-        batch_processor->is_epoch_finished = false;
-    }
-
-    // Tentukan ukuran batch actual (mungkin lebih kecil di batch terakhir)
-    size_t actual_batch_size = (batch_processor->current_start_idx + batch_size >= training_dataset.num_rows)
-                    ? (training_dataset.num_rows - batch_processor->current_start_idx) : batch_size;
-
-    struct Matrix current_batch = matrix_create_row_slice(
-            training_dataset, batch_processor->current_start_idx, actual_batch_size);
+    assert(arena_ptr != NULL && statistics_output != NULL);
 
-    // Simpan state arena untuk reset setelah selesai
-    size_t arena_checkpoint = arena_ptr->used_buffers;
-
-    // Hitung gradient dan update network
-    struct NeuralNetwork batch_gradients = neural_network_compute_gradients(arena_ptr, network, current_batch);
-    neural_network_apply_gradients(network, batch_gradients, learning_rate);
-
-    // Akumulasi cost untuk monitoring
-    batch_processor->accumulated_cost += neural_network_calculate_cost(network, current_batch);
-    batch_processor->current_start_idx += actual_batch_size;
-
-    // Cek apakah epoch selesai
-    if (batch_processor->current_start_idx >= training_dataset.num_rows) {
-        size_t total_batch_count = (training_dataset.num_rows + batch_size - 1) / batch_size;
-        batch_processor->accumulated_cost /= total_batch_count;
-        batch_processor->is_epoch_finished = true;
+    if (arena_ptr->statistics == NULL) {
+        *statistics_output = (struct ArenaStatistics) {0};
+        return false;
     }
 
-    // Reset arena ke checkpoint (hanya free temporary allocations)
-    arena_ptr->used_buffers = arena_checkpoint;
+    *statistics_output = *arena_ptr->statistics;
+    return true;
 }
 
 /**
- * @brief Melatih neural network dengan dataset lengkap
- * @param network Neural network yang akan dilatih
- * @param arena_ptr Arena untuk alokasi temporary
- * @param training_dataset Dataset training
- * @param batch_size Ukuran batch untuk training
- * @param learning_rate Learning rate
- * @param num_epochs Jumlah epoch training
+ * @brief Mencetak statistik arena ke console
+ * @param arena_ptr Pointer ke arena
+ * @param arena_name Nama arena (untuk label)
  */
 void
-neural_network_train(struct NeuralNetwork network,
-                     struct MemoryArena *arena_ptr,
-                     struct Matrix training_dataset, size_t batch_size,
-                     float learning_rate, size_t num_epochs)
+arena_print_statistics(const struct MemoryArena *arena_ptr, const char *arena_name)
 {
-    for (size_t epoch_idx = 0; epoch_idx < num_epochs; ++epoch_idx) {
-        struct BatchProcessor batch_processor = {0};
-
-        // Proses semua batch dalam satu epoch
-        while (!batch_processor.is_epoch_finished)
-            batch_process_training_data(
-                    arena_ptr, &batch_processor, batch_size, network, training_dataset, learning_rate);
+    struct ArenaStatistics statistics;
+    if (!arena_get_statistics(arena_ptr, &statistics)) {
+        printf("%s: statistik tidak diaktifkan\n", arena_name);
+        return;
+    }
 
-        // Print progress
-        printf("Epoch %zu selesai. Loss rata-rata: %.4f, Akurasi: %.2f%%\n",
-                epoch_idx + 1,
-                batch_processor.accumulated_cost,
-                100.0f * neural_network_calculate_accuracy(network, training_dataset));
+    double padding_percent = statistics.padded_bytes > 0
+                           ? 100.0 * (double)(statistics.padded_bytes - statistics.requested_bytes)
+                                   / (double)statistics.padded_bytes
+                           : 0.0;
+
+    printf("%s: %zu allocations, requested %.1f KB, padded %.1f KB (%.1f%% padding)\n",
+           arena_name, statistics.allocation_count, statistics.requested_bytes / 1024.0,
+           statistics.padded_bytes / 1024.0, padding_percent);
+    printf("  used %.1f KB, peak %.1f KB, reserved %.1f KB in %zu chunks\n",
+           statistics.used_bytes / 1024.0, statistics.peak_used_bytes / 1024.0,
+           statistics.reserved_bytes / 1024.0, statistics.chunk_count);
+
+    for (size_t tag_idx = 0; tag_idx < statistics.tag_count; ++tag_idx) {
+        const struct ArenaTagStatistics *tag_statistics = &statistics.tags[tag_idx];
+        printf("  %-20s %8zu allocations %12.1f KB\n",
+               tag_statistics->tag != NULL ? tag_statistics->tag : "(untagged)",
+               tag_statistics->allocation_count, tag_statistics->requested_bytes / 1024.0);
     }
 }
 
 /**
- * @brief Mengacak urutan baris dalam matrix (untuk shuffling dataset)
- * @param target_matrix Matrix yang baris-barisnya akan diacak
+ * @brief Slot pool scratch: satu arena per cache line agar worker tidak false sharing
  */
-void
-matrix_shuffle_rows(struct Matrix target_matrix)
+struct ScratchArenaSlot
 {
-    if (target_matrix.num_rows <= 1) return;
-
-    // Fisher-Yates shuffle algorithm
-    for (size_t current_idx = 0; current_idx < target_matrix.num_rows; ++current_idx) {
-        size_t random_idx = current_idx + rand() % (target_matrix.num_rows - current_idx);
-        if (current_idx != random_idx) {
-            // Tukar baris current_idx dengan baris random_idx
-            for (size_t col_idx = 0; col_idx < target_matrix.num_columns; ++col_idx) {
-                float temp_value = matrix_at(target_matrix, current_idx, col_idx);
-                matrix_at(target_matrix, current_idx, col_idx) = matrix_at(target_matrix, random_idx, col_idx);
-                matrix_at(target_matrix, random_idx, col_idx) = temp_value;
-            }
-        }
-    }
-}
+    _Alignas(ARENA_CACHE_LINE_SIZE) struct MemoryArena arena;  // Arena milik slot (anggota pertama)
+    struct ArenaMarker acquire_marker;                          // Posisi arena saat dipinjam
+    bool is_in_use;                                             // true selama arena dipinjam (dijaga critical)
+};
 
 /**
- * @brief Menghitung cost function (mean squared error) pada dataset
- * @param network Neural network
- * @param test_dataset Dataset untuk evaluasi
- * @return Nilai cost rata-rata
+ * @brief Pool arena scratch per thread
  */
-float
-neural_network_calculate_cost(struct NeuralNetwork network, struct Matrix test_dataset)
+struct ScratchArenaPool
 {
-    size_t sample_count = test_dataset.num_rows;
-    size_t input_size = network.activation_vectors[0].num_columns;
-    size_t output_size = network.activation_vectors[network.total_layers - 1].num_columns;
-
-    float total_cost = 0.0f;
-
-    // Hitung MSE untuk setiap sample
-    for (size_t sample_idx = 0; sample_idx < sample_count; ++sample_idx) {
-        struct Row sample_row = matrix_get_row(test_dataset, sample_idx);
-        struct Row input_data = row_create_slice(sample_row, 0, input_size);
-        struct Row expected_output = row_create_slice(sample_row, input_size, output_size);
-
-        // Forward pass
-        row_copy_data(network.activation_vectors[0], input_data);
-        neural_network_forward_pass(network);
+    size_t slot_count;                  // Jumlah arena
+    struct ScratchArenaSlot *slots;     // Slot, 64-byte aligned
+};
 
-        // Hitung squared error
-        for (size_t output_idx = 0; output_idx < output_size; ++output_idx) {
-            float prediction_diff = row_at(network.activation_vectors[network.total_layers - 1], output_idx) -
-                                    row_at(expected_output, output_idx);
-
-            total_cost += prediction_diff * prediction_diff;
-        }
+/**
+ * @brief Membuat pool arena scratch
+ * @param arena_count Jumlah arena (0 untuk omp_get_max_threads())
+ * @param arena_size_in_bytes Ukuran chunk pertama setiap arena
+ * @return Pool baru
+ */
+struct ScratchArenaPool *
+scratch_arena_pool_create(size_t arena_count, size_t arena_size_in_bytes)
+{
+#if defined(_OPENMP)
+    if (arena_count == 0) arena_count = (size_t)omp_get_max_threads();
+#else
+    if (arena_count == 0) arena_count = 1;
+#endif
+
+    struct ScratchArenaPool *pool = (struct ScratchArenaPool *)malloc(sizeof(*pool));
+    assert(pool != NULL);
+
+    pool->slot_count = arena_count;
+    pool->slots = (struct ScratchArenaSlot *)memory_allocate_aligned(sizeof(*pool->slots) * arena_count,
+                                                                     ARENA_CACHE_LINE_SIZE);
+    assert(pool->slots != NULL);
+
+    // Thread ke-i membuat dan menyentuh arena ke-i, sehingga halamannya dipetakan di node NUMA thread itu
+    #pragma omp parallel for num_threads((int)arena_count) schedule(static, 1) if (arena_count > 1)
+    for (long slot_idx = 0; slot_idx < (long)arena_count; ++slot_idx) {
+        struct ScratchArenaSlot *slot = &pool->slots[slot_idx];
+
+        slot->arena = arena_create(arena_size_in_bytes);
+        memset(arena_chunk_data(slot->arena.current_chunk), 0, slot->arena.current_chunk->capacity);
+        slot->acquire_marker = (struct ArenaMarker) {0};
+        slot->is_in_use = false;
     }
 
-    return total_cost / sample_count;
+    return pool;
 }
 
 /**
- * @brief Mencari indeks elemen dengan nilai maksimum dalam row
- * @param input_row Row yang akan dicari nilai maksimumnya
- * @return Indeks elemen dengan nilai terbesar
+ * @brief Menandai slot sedang dipinjam jika masih bebas
+ *
+ * Bagian kritis hanya memeriksa dan mengubah satu flag; alokasi di arena
+ * yang dipinjam tetap tanpa lock. omp critical dipakai (bukan atomic C11)
+ * agar tetap bisa dikompilasi dengan OpenMP 2.0 di MSVC.
+ *
+ * @param slot Slot pool
+ * @return true jika slot berhasil dipinjam
  */
-size_t
-row_find_max_index(struct Row input_row)
+static bool
+scratch_arena_slot_try_acquire(struct ScratchArenaSlot *slot)
 {
-    size_t max_element_index = 0;
-    for (size_t element_idx = 1; element_idx < input_row.num_columns; ++element_idx) {
-        if (input_row.element[element_idx] > input_row.element[max_element_index]) {
-            max_element_index = element_idx;
+    bool is_acquired = false;
+
+    #pragma omp critical(scratch_arena_pool)
+    {
+        if (!slot->is_in_use) {
+            slot->is_in_use = true;
+            is_acquired = true;
         }
     }
-    return max_element_index;
+
+    return is_acquired;
 }
 
 /**
- * @brief Menghitung akurasi klasifikasi neural network
- * @param network Neural network yang akan dievaluasi
- * @param test_dataset Dataset untuk evaluasi
- * @return Akurasi antara 0.0 hingga 1.0
+ * @brief Meminjam arena dari pool
+ * @param pool Pool arena
+ * @return Arena yang dipinjam, atau NULL jika semua arena sedang dipinjam
  */
-float
-neural_network_calculate_accuracy(struct NeuralNetwork network, struct Matrix test_dataset)
+struct MemoryArena *
+scratch_arena_pool_acquire(struct ScratchArenaPool *pool)
 {
-    size_t correct_predictions = 0;
-    size_t total_samples = test_dataset.num_rows;
-
-    // Evaluasi setiap sample
-    for (size_t sample_idx = 0; sample_idx < total_samples; ++sample_idx) {
-        struct Row sample_row = matrix_get_row(test_dataset, sample_idx);
-        struct Row input_data = row_create_slice(sample_row, 0, network.activation_vectors[0].num_columns);
-        struct Row expected_output = row_create_slice(
-                sample_row, network.activation_vectors[0].num_columns,
-                network.activation_vectors[network.total_layers - 1].num_columns);
+    assert(pool != NULL);
 
-        // Forward pass
-        row_copy_data(network.activation_vectors[0], input_data);
-        neural_network_forward_pass(network);
+    size_t preferred_slot = 0;
+#if defined(_OPENMP)
+    preferred_slot = (size_t)omp_get_thread_num() % pool->slot_count;
+#endif
 
-        // Bandingkan prediksi dengan label sebenarnya
-        size_t predicted_class = row_find_max_index(network.activation_vectors[network.total_layers - 1]);
-        size_t actual_class = row_find_max_index(expected_output);
+    for (size_t attempt_idx = 0; attempt_idx < pool->slot_count; ++attempt_idx) {
+        struct ScratchArenaSlot *slot = &pool->slots[(preferred_slot + attempt_idx) % pool->slot_count];
 
-        if (predicted_class == actual_class) {
-            ++correct_predictions;
+        if (scratch_arena_slot_try_acquire(slot)) {
+            slot->acquire_marker = arena_save(&slot->arena);
+            return &slot->arena;
         }
     }
 
-    return (float)correct_predictions / total_samples;
+    return NULL;
 }
 
 /**
- * @brief Normalisasi min-max pada kolom input matrix
- * @param target_matrix Matrix yang akan dinormalisasi
- * @param num_input_columns Jumlah kolom input yang akan dinormalisasi
- * @param new_min_value Nilai minimum baru setelah normalisasi
- * @param new_max_value Nilai maksimum baru setelah normalisasi
+ * @brief Mengembalikan arena ke pool
+ * @param pool Pool arena
+ * @param arena_ptr Arena dari scratch_arena_pool_acquire
  */
 void
-matrix_normalize_minmax(struct Matrix target_matrix, size_t num_input_columns, float new_min_value, float new_max_value)
+scratch_arena_pool_release(struct ScratchArenaPool *pool, struct MemoryArena *arena_ptr)
 {
-    // Normalisasi setiap kolom secara terpisah
-    for (size_t col_idx = 0; col_idx < num_input_columns; ++col_idx) {
-        // Cari min dan max untuk kolom col_idx
-        float column_min_value = matrix_at(target_matrix, 0, col_idx);
-        float column_max_value = matrix_at(target_matrix, 0, col_idx);
+    assert(pool != NULL);
+    (void)pool;
 
-        for (size_t row_idx = 1; row_idx < target_matrix.num_rows; ++row_idx) {
-            float current_value = matrix_at(target_matrix, row_idx, col_idx);
-            if (current_value < column_min_value) column_min_value = current_value;
-            if (current_value > column_max_value) column_max_value = current_value;
-        }
+    // Arena adalah anggota pertama slot
+    struct ScratchArenaSlot *slot = (struct ScratchArenaSlot *)arena_ptr;
+    assert(slot >= pool->slots && slot < pool->slots + pool->slot_count);
 
-        // Hindari pembagian dengan nol
-        float value_range = column_max_value - column_min_value;
-        if (value_range == 0.0f) value_range = 1.0f;
+    arena_restore(&slot->arena, slot->acquire_marker);
 
-        // Terapkan normalisasi min-max
-        for (size_t row_idx = 0; row_idx < target_matrix.num_rows; ++row_idx) {
-            float *current_value_ptr = &matrix_at(target_matrix, row_idx, col_idx);
-            *current_value_ptr = ((*current_value_ptr - column_min_value) / value_range) *
-                                 (new_max_value - new_min_value) + new_min_value;
-        }
-    }
+    #pragma omp critical(scratch_arena_pool)
+    slot->is_in_use = false;
 }
 
 /**
- * @brief Inisialisasi weights neural network dengan nilai random
- * @param network Neural network yang akan diinisialisasi
- * @param min_weight Nilai minimum untuk random weights
- * @param max_weight Nilai maksimum untuk random weights
+ * @brief Membebaskan pool beserta semua arenanya
+ * @param pool Pool arena
  */
 void
-neural_network_randomize_weights(struct NeuralNetwork network, float min_weight, float max_weight)
+scratch_arena_pool_destroy(struct ScratchArenaPool *pool)
 {
-    // Inisialisasi semua weights dengan random, biases dengan nol
-    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
-        matrix_fill_random(network.weight_matrices[layer_idx], min_weight, max_weight);
-        row_fill_with_value(network.bias_vectors[layer_idx], 0.0f);
-    }
+    if (pool == NULL) return;
+
+    for (size_t slot_idx = 0; slot_idx < pool->slot_count; ++slot_idx)
+        arena_destroy(&pool->slots[slot_idx].arena);
+
+    memory_free_aligned(pool->slots);
+    free(pool);
+}
+
+/**
+ * @brief fseek dengan offset 64-bit
+ *
+ * long hanya 32-bit di Windows, sehingga fseek/ftell biasa gagal untuk file
+ * di atas 2 GB tepat di platform yang tidak memakai mmap.
+ *
+ * @param file File yang terbuka
+ * @param offset Offset dalam bytes
+ * @param origin SEEK_SET, SEEK_CUR, atau SEEK_END
+ * @return 0 jika berhasil
+ */
+static int
+file_seek(FILE *file, uint64_t offset, int origin)
+{
+#if defined(_WIN32)
+    return _fseeki64(file, (__int64)offset, origin);
+#elif defined(NN_HAS_MMAP)
+    return fseeko(file, (off_t)offset, origin);
+#else
+    if ((uint64_t)(long)offset != offset) return -1;
+    return fseek(file, (long)offset, origin);
+#endif
+}
+
+/**
+ * @brief ftell dengan hasil 64-bit (lihat file_seek)
+ * @param file File yang terbuka
+ * @return Posisi file dalam bytes, atau -1 jika gagal
+ */
+static int64_t
+file_tell(FILE *file)
+{
+#if defined(_WIN32)
+    return (int64_t)_ftelli64(file);
+#elif defined(NN_HAS_MMAP)
+    return (int64_t)ftello(file);
+#else
+    return (int64_t)ftell(file);
+#endif
+}
+
+/**
+ * @brief Memetakan seluruh file ke memori
+ * @param filename Path file
+ * @param is_copy_on_write true untuk mapping privat yang boleh ditulis (file tidak berubah)
+ * @param mapping_output Mapping hasil (base_address minimal 64-byte aligned)
+ * @return true jika berhasil
+ */
+bool
+mapped_file_open(const char *filename, bool is_copy_on_write, struct MappedFile *mapping_output)
+{
+    *mapping_output = (struct MappedFile) {0};
+
+#if defined(NN_HAS_MMAP)
+    int file_descriptor = open(filename, O_RDONLY);
+    if (file_descriptor < 0) return false;
+
+    struct stat file_status;
+    if (fstat(file_descriptor, &file_status) != 0 || file_status.st_size <= 0) {
+        close(file_descriptor);
+        return false;
+    }
+
+    size_t file_size = (size_t)file_status.st_size;
+    void *mapped_address = is_copy_on_write
+                         ? mmap(NULL, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file_descriptor, 0)
+                         : mmap(NULL, file_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+    close(file_descriptor); // Mapping tetap valid setelah descriptor ditutup
+
+    if (mapped_address == MAP_FAILED) return false;
+
+    *mapping_output = (struct MappedFile) {
+        .base_address = mapped_address, .mapped_size = file_size, .is_memory_mapped = true
+    };
+    return true;
+#else
+    // Buffer hasil baca selalu milik pemanggil, jadi copy-on-write tidak berpengaruh
+    (void)is_copy_on_write;
+
+    FILE *input_file = fopen(filename, "rb");
+    if (input_file == NULL) return false;
+
+    int64_t file_size = -1;
+    if (file_seek(input_file, 0, SEEK_END) == 0) file_size = file_tell(input_file);
+
+    if (file_size <= 0 || (uint64_t)file_size > SIZE_MAX - 128 || file_seek(input_file, 0, SEEK_SET) != 0) {
+        fclose(input_file);
+        return false;
+    }
+
+    // Buffer aligned agar data di file tetap di batas 64 byte; pointer asli disimpan di depannya
+    size_t alignment = 64;
+    unsigned char *raw_buffer = (unsigned char *)malloc((size_t)file_size + alignment + sizeof(void *));
+    if (raw_buffer == NULL) {
+        fclose(input_file);
+        return false;
+    }
+
+    uintptr_t aligned_address = ((uintptr_t)(raw_buffer + sizeof(void *)) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    unsigned char *file_buffer = (unsigned char *)aligned_address;
+    ((void **)file_buffer)[-1] = raw_buffer;
+
+    bool is_read = fread(file_buffer, 1, (size_t)file_size, input_file) == (size_t)file_size;
+    fclose(input_file);
+
+    if (!is_read) {
+        free(raw_buffer);
+        return false;
+    }
+
+    *mapping_output = (struct MappedFile) {
+        .base_address = file_buffer, .mapped_size = (size_t)file_size, .is_memory_mapped = false
+    };
+    return true;
+#endif
+}
+
+/**
+ * @brief Melepas mapping file (semua pointer ke dalam mapping menjadi tidak valid)
+ * @param mapping Mapping dari mapped_file_open
+ */
+void
+mapped_file_close(struct MappedFile *mapping)
+{
+    assert(mapping != NULL);
+
+    if (mapping->base_address != NULL) {
+#if defined(NN_HAS_MMAP)
+        assert(mapping->is_memory_mapped);
+        munmap(mapping->base_address, mapping->mapped_size);
+#else
+        free(((void **)mapping->base_address)[-1]);
+#endif
+    }
+
+    *mapping = (struct MappedFile) {0};
+}
+
+// ================[ RANDOM NUMBER GENERATION - IMPLEMENTATION ]================
+
+/**
+ * @brief Seed global untuk matrix_fill_random, matrix_shuffle_rows, dan BatchSampler
+ */
+static uint64_t random_global_seed = 0x853c49e6748fea9bull;
+
+/**
+ * @brief Counter stream_id berikutnya untuk seed global
+ */
+static uint64_t random_global_stream_counter = 0;
+
+/**
+ * @brief Finalizer splitmix64: mencampur 64 bit input dengan avalanche penuh
+ * @param value Nilai input
+ * @return Nilai tercampur
+ */
+static inline uint64_t
+random_mix64(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Menggabungkan seed dan stream_id menjadi satu kunci 64-bit
+ * @param seed Seed
+ * @param stream_id Nomor stream
+ * @return Kunci stream
+ */
+static inline uint64_t
+random_stream_key(uint64_t seed, uint64_t stream_id)
+{
+    return random_mix64(seed ^ random_mix64(stream_id + 0x9e3779b97f4a7c15ull));
+}
+
+/**
+ * @brief Rotasi kiri 64-bit
+ */
+static inline uint64_t
+random_rotate_left(uint64_t value, int shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+/**
+ * @brief Mengambil seed global dan stream_id berikutnya secara atomik
+ *
+ * Keduanya dibaca dalam critical yang sama dengan random_set_global_seed,
+ * sehingga pasangan (seed, stream_id) selalu konsisten. Memakai critical,
+ * bukan atomic capture (OpenMP 3.1), agar tetap dikompilasi dengan
+ * OpenMP 2.0 di MSVC.
+ *
+ * @param seed_output Seed global saat ini
+ * @return Nomor stream
+ */
+static uint64_t
+random_next_global_stream_id(uint64_t *seed_output)
+{
+    uint64_t stream_id;
+
+    #pragma omp critical(random_global_stream)
+    {
+        *seed_output = random_global_seed;
+        stream_id = random_global_stream_counter++;
+    }
+
+    return stream_id;
+}
+
+/**
+ * @brief Mengatur seed global dan mereset counter stream_id
+ * @param seed Seed global
+ */
+void
+random_set_global_seed(uint64_t seed)
+{
+    #pragma omp critical(random_global_stream)
+    {
+        random_global_seed = seed;
+        random_global_stream_counter = 0;
+    }
+}
+
+/**
+ * @brief Membuat stream dari seed global dan stream_id berikutnya
+ * @return Stream random
+ */
+struct RandomStream
+random_stream_create_from_global_seed(void)
+{
+    uint64_t seed;
+    uint64_t stream_id = random_next_global_stream_id(&seed);
+
+    return random_stream_create(seed, stream_id);
+}
+
+/**
+ * @brief Membuat stream xoshiro256** dari seed dan nomor stream
+ * @param seed Seed
+ * @param stream_id Nomor stream
+ * @return Stream random
+ */
+struct RandomStream
+random_stream_create(uint64_t seed, uint64_t stream_id)
+{
+    struct RandomStream random_stream;
+    uint64_t splitmix_state = random_stream_key(seed, stream_id);
+
+    // Keluaran splitmix64 berurutan tidak mungkin semuanya nol, jadi state selalu valid
+    for (size_t word_idx = 0; word_idx < 4; ++word_idx) {
+        splitmix_state += 0x9e3779b97f4a7c15ull;
+        random_stream.state[word_idx] = random_mix64(splitmix_state);
+    }
+
+    return random_stream;
+}
+
+/**
+ * @brief Langkah xoshiro256**
+ * @param random_stream Stream random
+ * @return 64 bit random
+ */
+uint64_t
+random_stream_next(struct RandomStream *random_stream)
+{
+    uint64_t *state = random_stream->state;
+    uint64_t result = random_rotate_left(state[1] * 5, 7) * 9;
+    uint64_t shifted = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = random_rotate_left(state[3], 45);
+
+    return result;
+}
+
+/**
+ * @brief Float uniform di [0, 1) dari 24 bit teratas
+ * @param random_stream Stream random
+ * @return Float random
+ */
+float
+random_stream_next_float(struct RandomStream *random_stream)
+{
+    return (float)(random_stream_next(random_stream) >> 40) * 0x1p-24f;
+}
+
+/**
+ * @brief Indeks uniform di [0, bound) dengan rejection sampling
+ * @param random_stream Stream random
+ * @param bound Batas atas eksklusif
+ * @return Indeks random
+ */
+size_t
+random_stream_next_index(struct RandomStream *random_stream, size_t bound)
+{
+    assert(bound > 0);
+
+    // Tolak nilai di bawah 2^64 mod bound agar setiap sisa muncul sama sering
+    uint64_t rejection_threshold = (0 - (uint64_t)bound) % (uint64_t)bound;
+    uint64_t value;
+    do {
+        value = random_stream_next(random_stream);
+    } while (value < rejection_threshold);
+
+    return (size_t)(value % (uint64_t)bound);
+}
+
+// ===========================[ GEMM - IMPLEMENTATION ]=========================
+
+/*
+ * Perkalian matrix mengikuti struktur BLIS/GotoBLAS:
+ *
+ *   loop jc (NC kolom B)    -> panel B dipack sekali dan tinggal di L2/L3
+ *    loop pc (KC dimensi k) -> satu panel KC x NC dari B
+ *     loop ic (MC baris A)  -> blok MC x KC dari A dipack dan tinggal di L2
+ *      loop jr, ir          -> micro-kernel MR x NR dengan akumulator di register
+ *
+ * Ukuran tile MR x NR dan micro-kernel berasal dari tabel kernel SIMD yang
+ * dipilih saat runtime (lihat nn_simd.h).
+ * Kedua operand dipack ke buffer berurutan sehingga micro-kernel selalu
+ * membaca memori secara sekuensial, apapun stride/transpose operand aslinya.
+ */
+
+#define GEMM_MC 144     // Jumlah baris blok A (muat di L2, kelipatan semua MR)
+#define GEMM_KC 256     // Panjang dimensi k per blok (panel MR x KC muat di L1)
+#define GEMM_NC 2048    // Jumlah kolom panel B (muat di L3)
+
+/**
+ * @brief Batas jumlah operasi (m * n * k) di mana loop sederhana lebih cepat dari packing
+ */
+#define GEMM_SMALL_THRESHOLD ((size_t)32 * 32 * 32)
+
+/**
+ * @brief Jumlah kolom B 16-bit yang dilebarkan sekaligus di jalur GEMM sederhana
+ */
+#define GEMM_SMALL_ROW_CHUNK ((size_t)512)
+
+#if defined(_MSC_VER)
+#define NN_THREAD_LOCAL __declspec(thread)
+#else
+#define NN_THREAD_LOCAL _Thread_local
+#endif
+
+/**
+ * @brief Operand GEMM dengan stride umum
+ *
+ * Elemen (i, j) berada di element[i * row_stride + j * column_stride],
+ * sehingga operand yang ditranspose cukup ditukar stride-nya tanpa disalin.
+ * Operand B boleh disimpan 16-bit (half_element); nilainya dilebarkan ke
+ * fp32 saat packing sehingga micro-kernel tetap bekerja dalam fp32.
+ */
+struct GemmOperand
+{
+    const float *element;                   // Pointer ke elemen pertama (NULL jika half_element dipakai)
+    size_t row_stride;                      // Jarak antar baris (dalam elemen)
+    size_t column_stride;                   // Jarak antar kolom (dalam elemen)
+    const uint16_t *half_element;           // Elemen fp16/bf16 (hanya operand B, NULL untuk fp32)
+    enum HalfPrecisionFormat half_format;   // Format half_element
+};
+
+/**
+ * @brief Mengalokasikan buffer dengan alignment 64 byte (cache line)
+ * @param size_in_bytes Ukuran buffer dalam bytes
+ * @return Pointer ke buffer yang dialokasikan
+ */
+static void *
+gemm_allocate_aligned(size_t size_in_bytes)
+{
+    void *buffer = memory_allocate_aligned(size_in_bytes, ARENA_CACHE_LINE_SIZE);
+    assert(buffer != NULL);
+    return buffer;
+}
+
+/**
+ * @brief Mendapatkan buffer packing milik thread saat ini
+ *
+ * Buffer dialokasikan sekali per thread lalu dipakai ulang oleh setiap
+ * pemanggilan GEMM, sehingga GEMM aman dipanggil dari banyak thread.
+ *
+ * @param packed_a_out Pointer untuk menerima buffer panel A (MC x KC)
+ * @param packed_b_out Pointer untuk menerima buffer panel B (KC x NC)
+ */
+static void
+gemm_get_pack_buffers(float **packed_a_out, float **packed_b_out)
+{
+    static NN_THREAD_LOCAL float *packed_a_buffer = NULL;
+    static NN_THREAD_LOCAL float *packed_b_buffer = NULL;
+
+    if (packed_a_buffer == NULL) {
+        packed_a_buffer = gemm_allocate_aligned(sizeof(float) * GEMM_MC * GEMM_KC);
+        packed_b_buffer = gemm_allocate_aligned(sizeof(float) * GEMM_KC * GEMM_NC);
+    }
+
+    *packed_a_out = packed_a_buffer;
+    *packed_b_out = packed_b_buffer;
+}
+
+/**
+ * @brief Pack blok A (mc x kc) menjadi panel-panel MR baris
+ *
+ * Setiap panel disimpan kolom demi kolom: untuk setiap k ada MR nilai
+ * berurutan. Baris sisa di panel terakhir diisi nol.
+ */
+static void
+gemm_pack_a(float *packed_a, struct GemmOperand a, size_t row_start, size_t k_start,
+            size_t mc, size_t kc, size_t mr)
+{
+    for (size_t panel_row = 0; panel_row < mc; panel_row += mr) {
+        size_t panel_rows = mc - panel_row < mr ? mc - panel_row : mr;
+
+        for (size_t k_idx = 0; k_idx < kc; ++k_idx) {
+            const float *source = a.element + (row_start + panel_row) * a.row_stride
+                                            + (k_start + k_idx) * a.column_stride;
+            size_t lane = 0;
+
+            for (; lane < panel_rows; ++lane) packed_a[lane] = source[lane * a.row_stride];
+            for (; lane < mr; ++lane) packed_a[lane] = 0.0f;
+
+            packed_a += mr;
+        }
+    }
+}
+
+/**
+ * @brief Membaca count elemen baris B sebagai fp32 (elemen 16-bit dilebarkan)
+ * @param kernels Tabel kernel aktif
+ * @param destination Buffer tujuan
+ * @param b Operand B
+ * @param row_idx Indeks baris B
+ * @param column_start Kolom pertama yang dibaca
+ * @param count Jumlah elemen
+ */
+static void
+gemm_load_b_row(const struct SimdKernelTable *kernels, float *destination, struct GemmOperand b,
+                size_t row_idx, size_t column_start, size_t count)
+{
+    size_t offset = row_idx * b.row_stride + column_start * b.column_stride;
+
+    if (b.half_element != NULL) {
+        if (b.column_stride == 1) {
+            kernels->vector_widen_half(destination, b.half_element + offset, count, b.half_format);
+        } else {
+            for (size_t lane = 0; lane < count; ++lane)
+                kernels->vector_widen_half(destination + lane, b.half_element + offset + lane * b.column_stride,
+                                           1, b.half_format);
+        }
+        return;
+    }
+
+    const float *source = b.element + offset;
+    if (b.column_stride == 1) {
+        for (size_t lane = 0; lane < count; ++lane) destination[lane] = source[lane];
+    } else {
+        for (size_t lane = 0; lane < count; ++lane) destination[lane] = source[lane * b.column_stride];
+    }
+}
+
+/**
+ * @brief Pack panel B (kc x nc) menjadi panel-panel NR kolom
+ *
+ * Setiap panel disimpan baris demi baris: untuk setiap k ada NR nilai
+ * berurutan. Kolom sisa di panel terakhir diisi nol.
+ */
+static void
+gemm_pack_b(float *packed_b, struct GemmOperand b, size_t k_start, size_t column_start,
+            size_t kc, size_t nc, size_t nr)
+{
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+
+    for (size_t panel_column = 0; panel_column < nc; panel_column += nr) {
+        size_t panel_columns = nc - panel_column < nr ? nc - panel_column : nr;
+
+        for (size_t k_idx = 0; k_idx < kc; ++k_idx) {
+            gemm_load_b_row(kernels, packed_b, b, k_start + k_idx, column_start + panel_column, panel_columns);
+            for (size_t lane = panel_columns; lane < nr; ++lane) packed_b[lane] = 0.0f;
+
+            packed_b += nr;
+        }
+    }
+}
+
+/**
+ * @brief Menerapkan epilogue (bias + aktivasi) pada satu baris C yang sudah selesai
+ */
+static void
+gemm_apply_epilogue_row(const struct SimdKernelTable *kernels, const struct GemmEpilogue *epilogue,
+                        float *c_row, size_t n)
+{
+    if (epilogue == NULL) return;
+
+    if (epilogue->bias != NULL) kernels->vector_add(c_row, epilogue->bias, n);
+
+    if (epilogue->use_fast_activation)
+        kernels->vector_activation_fast(c_row, n, epilogue->activation_type);
+    else
+        kernels->vector_activation(c_row, n, epilogue->activation_type);
+}
+
+/**
+ * @brief GEMM sederhana untuk matrix kecil, di mana biaya packing tidak sebanding
+ *
+ * Urutan loop i-k-j agar baris B dan baris C dibaca berurutan. Jika baris B
+ * contiguous, update baris C memakai kernel axpy SIMD. Jalur ini juga dipakai
+ * untuk m == 1 (forward pass satu sample), yang pada dasarnya GEMV.
+ */
+static void
+gemm_small(size_t m, size_t n, size_t k, struct GemmOperand a, struct GemmOperand b,
+           float *c, size_t c_row_stride, const struct GemmEpilogue *epilogue)
+{
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+
+    for (size_t row_idx = 0; row_idx < m; ++row_idx) {
+        float *c_row = c + row_idx * c_row_stride;
+
+        memset(c_row, 0, sizeof(*c_row) * n);
+
+        for (size_t inner_idx = 0; inner_idx < k; ++inner_idx) {
+            float a_value = a.element[row_idx * a.row_stride + inner_idx * a.column_stride];
+
+            if (b.half_element != NULL) {
+                // Baris B 16-bit dilebarkan per potongan ke buffer di stack
+                float b_row_buffer[GEMM_SMALL_ROW_CHUNK];
+
+                for (size_t col_start = 0; col_start < n; col_start += GEMM_SMALL_ROW_CHUNK) {
+                    size_t chunk = n - col_start < GEMM_SMALL_ROW_CHUNK ? n - col_start : GEMM_SMALL_ROW_CHUNK;
+                    gemm_load_b_row(kernels, b_row_buffer, b, inner_idx, col_start, chunk);
+                    kernels->vector_axpy(c_row + col_start, b_row_buffer, a_value, chunk);
+                }
+                continue;
+            }
+
+            const float *b_row = b.element + inner_idx * b.row_stride;
+
+            if (b.column_stride == 1) {
+                kernels->vector_axpy(c_row, b_row, a_value, n);
+            } else {
+                for (size_t col_idx = 0; col_idx < n; ++col_idx)
+                    c_row[col_idx] += a_value * b_row[col_idx * b.column_stride];
+            }
+        }
+
+        // Baris C masih di L1, epilogue langsung diterapkan
+        gemm_apply_epilogue_row(kernels, epilogue, c_row, n);
+    }
+}
+
+/**
+ * @brief GEMM C (m x n) = A (m x k) * B (k x n) dengan cache blocking dan packing
+ * @param m Jumlah baris A dan C
+ * @param n Jumlah kolom B dan C
+ * @param k Jumlah kolom A dan baris B
+ * @param a Operand A
+ * @param b Operand B
+ * @param c Pointer ke elemen pertama C (disimpan row-major)
+ * @param c_row_stride Jarak antar baris C
+ * @param epilogue Bias + aktivasi yang diterapkan pada hasil (NULL jika tidak ada)
+ */
+static void
+gemm_compute(size_t m, size_t n, size_t k, struct GemmOperand a, struct GemmOperand b,
+             float *c, size_t c_row_stride, const struct GemmEpilogue *epilogue)
+{
+    if (m == 0 || n == 0) return;
+
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+
+    if (k == 0) {
+        for (size_t row_idx = 0; row_idx < m; ++row_idx) {
+            memset(c + row_idx * c_row_stride, 0, sizeof(*c) * n);
+            gemm_apply_epilogue_row(kernels, epilogue, c + row_idx * c_row_stride, n);
+        }
+        return;
+    }
+
+    // Satu baris (GEMV) tidak mendapat keuntungan dari packing
+    if (m == 1 || m * n * k <= GEMM_SMALL_THRESHOLD) {
+        gemm_small(m, n, k, a, b, c, c_row_stride, epilogue);
+        return;
+    }
+
+    size_t mr = kernels->gemm_mr;
+    size_t nr = kernels->gemm_nr;
+
+    float *packed_a, *packed_b;
+    gemm_get_pack_buffers(&packed_a, &packed_b);
+
+    for (size_t jc = 0; jc < n; jc += GEMM_NC) {
+        size_t nc = n - jc < GEMM_NC ? n - jc : GEMM_NC;
+
+        for (size_t pc = 0; pc < k; pc += GEMM_KC) {
+            size_t kc = k - pc < GEMM_KC ? k - pc : GEMM_KC;
+            bool accumulate = pc > 0;
+            bool is_last_k_block = pc + kc == k;
+
+            gemm_pack_b(packed_b, b, pc, jc, kc, nc, nr);
+
+            for (size_t ic = 0; ic < m; ic += GEMM_MC) {
+                size_t mc = m - ic < GEMM_MC ? m - ic : GEMM_MC;
+
+                gemm_pack_a(packed_a, a, ic, pc, mc, kc, mr);
+
+                for (size_t jr = 0; jr < nc; jr += nr) {
+                    size_t columns = nc - jr < nr ? nc - jr : nr;
+                    const float *panel_b = packed_b + jr * kc;
+
+                    // Epilogue hanya dijalankan setelah blok k terakhir, saat nilai C sudah final
+                    struct GemmEpilogue tile_epilogue;
+                    const struct GemmEpilogue *active_epilogue = NULL;
+                    if (epilogue != NULL && is_last_k_block) {
+                        tile_epilogue = *epilogue;
+                        if (tile_epilogue.bias != NULL) tile_epilogue.bias += jc + jr;
+                        active_epilogue = &tile_epilogue;
+                    }
+
+                    for (size_t ir = 0; ir < mc; ir += mr) {
+                        size_t rows = mc - ir < mr ? mc - ir : mr;
+
+                        kernels->gemm_micro_kernel(kc, packed_a + ir * kc, panel_b,
+                                                   c + (ic + ir) * c_row_stride + jc + jr, c_row_stride,
+                                                   rows, columns, accumulate, active_epilogue);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// ====================[ MATRIX OPERATIONS - IMPLEMENTATION ]===================
+
+/**
+ * @brief Mengalokasikan matrix baru dengan ukuran tertentu
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param num_rows Jumlah baris matrix
+ * @param num_columns Jumlah kolom matrix
+ * @return Struktur Matrix yang siap digunakan
+ */
+struct Matrix
+matrix_allocate(struct MemoryArena *arena_ptr, size_t num_rows, size_t num_columns)
+{
+    struct Matrix new_matrix;
+
+    new_matrix.num_rows = num_rows;
+    new_matrix.num_columns = num_columns;
+    new_matrix.element = arena_allocate_aligned(arena_ptr, sizeof(*new_matrix.element) * num_rows * num_columns,
+                                                ARENA_CACHE_LINE_SIZE);
+
+    assert(new_matrix.element != NULL);
+
+    return new_matrix;
+}
+
+/**
+ * @brief Mengalokasikan matrix baru tanpa mengisi nol
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param num_rows Jumlah baris matrix
+ * @param num_columns Jumlah kolom matrix
+ * @return Matrix yang elemennya belum diinisialisasi
+ */
+struct Matrix
+matrix_allocate_uninitialized(struct MemoryArena *arena_ptr, size_t num_rows, size_t num_columns)
+{
+    struct Matrix new_matrix;
+
+    new_matrix.num_rows = num_rows;
+    new_matrix.num_columns = num_columns;
+    new_matrix.element = arena_allocate_uninitialized(arena_ptr,
+                                                      sizeof(*new_matrix.element) * num_rows * num_columns,
+                                                      ARENA_CACHE_LINE_SIZE);
+
+    assert(new_matrix.element != NULL);
+
+    return new_matrix;
+}
+
+/**
+ * @brief Mengalokasikan matrix 16-bit (fp16 atau bf16) tanpa mengisi nol
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param num_rows Jumlah baris matrix
+ * @param num_columns Jumlah kolom matrix
+ * @param format Format elemen
+ * @return Matrix 16-bit yang elemennya belum diinisialisasi
+ */
+struct HalfMatrix
+half_matrix_allocate(struct MemoryArena *arena_ptr, size_t num_rows, size_t num_columns,
+                     enum HalfPrecisionFormat format)
+{
+    struct HalfMatrix new_matrix;
+
+    new_matrix.num_rows = num_rows;
+    new_matrix.num_columns = num_columns;
+    new_matrix.format = format;
+    new_matrix.element = arena_allocate_uninitialized(arena_ptr,
+                                                      sizeof(*new_matrix.element) * num_rows * num_columns,
+                                                      ARENA_CACHE_LINE_SIZE);
+
+    assert(new_matrix.element != NULL);
+
+    return new_matrix;
+}
+
+/**
+ * @brief Jumlah elemen per blok konversi ke matrix 16-bit (satu unit kerja thread)
+ */
+#define HALF_CONVERT_BLOCK_ELEMENTS ((size_t)1 << 16)
+
+/**
+ * @brief Mengisi matrix 16-bit dari matrix fp32 (round to nearest even)
+ * @param destination_matrix Matrix 16-bit tujuan
+ * @param source_matrix Matrix fp32 sumber (ukuran sama)
+ */
+void
+half_matrix_convert_from_matrix(struct HalfMatrix destination_matrix, struct Matrix source_matrix)
+{
+    assert(destination_matrix.num_rows == source_matrix.num_rows);
+    assert(destination_matrix.num_columns == source_matrix.num_columns);
+
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+    size_t element_count = source_matrix.num_rows * source_matrix.num_columns;
+    long block_count = (long)((element_count + HALF_CONVERT_BLOCK_ELEMENTS - 1) / HALF_CONVERT_BLOCK_ELEMENTS);
+
+    #pragma omp parallel for schedule(static) if (block_count > 1)
+    for (long block_idx = 0; block_idx < block_count; ++block_idx) {
+        size_t element_start = (size_t)block_idx * HALF_CONVERT_BLOCK_ELEMENTS;
+        size_t block_elements = element_count - element_start < HALF_CONVERT_BLOCK_ELEMENTS
+                                    ? element_count - element_start : HALF_CONVERT_BLOCK_ELEMENTS;
+
+        kernels->vector_narrow_half(destination_matrix.element + element_start,
+                                    source_matrix.element + element_start, block_elements,
+                                    destination_matrix.format);
+    }
+}
+
+/**
+ * @brief Membuat transpose matrix dalam format CSR (hanya elemen nonzero)
+ *
+ * Baris CSR ke-j berisi kolom j dari source_matrix; indeks kolom di setiap
+ * baris CSR terurut naik sehingga baris input dibaca berurutan oleh kernel.
+ *
+ * @param arena_ptr Arena untuk alokasi
+ * @param source_matrix Matrix dense sumber (maksimal UINT32_MAX baris)
+ * @return Matrix CSR berukuran source_matrix.num_columns x source_matrix.num_rows
+ */
+struct SparseMatrix
+sparse_matrix_create_transposed(struct MemoryArena *arena_ptr, struct Matrix source_matrix)
+{
+    assert(source_matrix.num_rows <= UINT32_MAX);
+
+    struct SparseMatrix sparse_matrix;
+    sparse_matrix.num_rows = source_matrix.num_columns;
+    sparse_matrix.num_columns = source_matrix.num_rows;
+    sparse_matrix.row_offsets = arena_allocate_memory(arena_ptr, sizeof(size_t) * (sparse_matrix.num_rows + 1));
+    assert(sparse_matrix.row_offsets != NULL);
+
+    // Pass pertama: jumlah nonzero per kolom sumber, lalu prefix sum menjadi offset
+    for (size_t row_idx = 0; row_idx < source_matrix.num_rows; ++row_idx) {
+        for (size_t column_idx = 0; column_idx < source_matrix.num_columns; ++column_idx)
+            if (matrix_at(source_matrix, row_idx, column_idx) != 0.0f) ++sparse_matrix.row_offsets[column_idx + 1];
+    }
+    for (size_t sparse_row = 0; sparse_row < sparse_matrix.num_rows; ++sparse_row)
+        sparse_matrix.row_offsets[sparse_row + 1] += sparse_matrix.row_offsets[sparse_row];
+
+    sparse_matrix.nonzero_count = sparse_matrix.row_offsets[sparse_matrix.num_rows];
+    sparse_matrix.column_indexes = arena_allocate_uninitialized(
+        arena_ptr, sizeof(uint32_t) * sparse_matrix.nonzero_count, ARENA_CACHE_LINE_SIZE);
+    sparse_matrix.values = arena_allocate_uninitialized(
+        arena_ptr, sizeof(float) * sparse_matrix.nonzero_count, ARENA_CACHE_LINE_SIZE);
+    assert(sparse_matrix.column_indexes != NULL && sparse_matrix.values != NULL);
+
+    // Pass kedua: row_offsets[j] dipakai sebagai posisi tulis baris j, sehingga
+    // setelah selesai bergeser satu baris dan dikembalikan dengan memmove
+    for (size_t row_idx = 0; row_idx < source_matrix.num_rows; ++row_idx) {
+        for (size_t column_idx = 0; column_idx < source_matrix.num_columns; ++column_idx) {
+            float value = matrix_at(source_matrix, row_idx, column_idx);
+            if (value == 0.0f) continue;
+
+            size_t position = sparse_matrix.row_offsets[column_idx]++;
+            sparse_matrix.column_indexes[position] = (uint32_t)row_idx;
+            sparse_matrix.values[position] = value;
+        }
+    }
+
+    memmove(sparse_matrix.row_offsets + 1, sparse_matrix.row_offsets, sizeof(size_t) * sparse_matrix.num_rows);
+    sparse_matrix.row_offsets[0] = 0;
+
+    return sparse_matrix;
+}
+
+/**
+ * @brief Mendapatkan baris tertentu dari matrix sebagai struktur Row
+ * @param source_matrix Matrix sumber
+ * @param row_index Indeks baris yang diinginkan
+ * @return Struktur Row yang merepresentasikan baris tersebut
+ */
+struct Row
+matrix_get_row(struct Matrix source_matrix, size_t row_index)
+{
+    assert(row_index < source_matrix.num_rows);
+
+    return (struct Row) {
+        .num_columns = source_matrix.num_columns,
+        .element = &matrix_at(source_matrix, row_index, 0)
+    };
+}
+
+/**
+ * @brief Mengkonversi Row menjadi Matrix 1xN
+ * @param source_row Row yang akan dikonversi
+ * @return Matrix dengan 1 baris yang berisi data dari Row
+ */
+struct Matrix
+row_convert_to_matrix(struct Row source_row)
+{
+    return (struct Matrix) {
+        .num_rows = 1,
+        .num_columns = source_row.num_columns,
+        .element = source_row.element
+    };
+}
+
+/**
+ * @brief Membuat slice (potongan) dari Row
+ * @param source_row Row sumber
+ * @param start_index Indeks awal slice
+ * @param slice_length Panjang slice
+ * @return Row baru yang merupakan potongan dari row asli
+ */
+struct Row
+row_create_slice(struct Row source_row, size_t start_index, size_t slice_length)
+{
+    assert(start_index < source_row.num_columns);
+    assert(start_index + slice_length <= source_row.num_columns);
+
+    return (struct Row) {
+        .num_columns = slice_length,
+        .element = &row_at(source_row, start_index)
+    };
+}
+
+/**
+ * @brief Mengisi semua elemen matrix dengan nilai tertentu
+ * @param target_matrix Matrix yang akan diisi
+ * @param fill_value Nilai yang akan diisikan ke semua elemen
+ */
+void
+matrix_fill_with_value(struct Matrix target_matrix, float fill_value)
+{
+    // Elemen matrix selalu berurutan di memori, jadi cukup satu kernel untuk seluruh buffer
+    simd_get_kernels()->vector_fill(target_matrix.element, fill_value,
+                                    target_matrix.num_rows * target_matrix.num_columns);
+}
+
+/**
+ * @brief Mengisi matrix dengan nilai random dalam range tertentu
+ * @param target_matrix Matrix yang akan diisi
+ * @param min_value Nilai minimum untuk random
+ * @param max_value Nilai maksimum untuk random
+ */
+void
+matrix_fill_random(struct Matrix target_matrix, float min_value, float max_value)
+{
+    uint64_t seed;
+    uint64_t stream_id = random_next_global_stream_id(&seed);
+
+    matrix_fill_random_with_seed(target_matrix, min_value, max_value, seed, stream_id);
+}
+
+/**
+ * @brief Jumlah elemen per blok matrix_fill_random_with_seed (satu unit kerja thread)
+ */
+#define RANDOM_FILL_BLOCK_ELEMENTS ((size_t)1 << 16)
+
+/**
+ * @brief Mengisi matrix dengan generator berbasis counter dari seed dan stream tertentu
+ * @param target_matrix Matrix yang akan diisi
+ * @param min_value Nilai minimum
+ * @param max_value Nilai maksimum (eksklusif)
+ * @param seed Seed
+ * @param stream_id Nomor stream
+ */
+void
+matrix_fill_random_with_seed(struct Matrix target_matrix, float min_value, float max_value,
+                             uint64_t seed, uint64_t stream_id)
+{
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+    uint64_t stream_key = random_stream_key(seed, stream_id);
+    size_t element_count = target_matrix.num_rows * target_matrix.num_columns;
+    size_t block_count = (element_count + RANDOM_FILL_BLOCK_ELEMENTS - 1) / RANDOM_FILL_BLOCK_ELEMENTS;
+
+    // Nilai hanya bergantung pada indeks elemen, jadi pembagian blok ke thread tidak mengubah hasil
+    #pragma omp parallel for schedule(static) if (block_count > 1)
+    for (long block_idx = 0; block_idx < (long)block_count; ++block_idx) {
+        size_t element_start = (size_t)block_idx * RANDOM_FILL_BLOCK_ELEMENTS;
+        size_t block_elements = element_count - element_start < RANDOM_FILL_BLOCK_ELEMENTS
+                                    ? element_count - element_start : RANDOM_FILL_BLOCK_ELEMENTS;
+
+        // Counter kernel 32-bit: setiap rentang 2^32 elemen memakai kunci turunan sendiri
+        uint64_t range_key = random_mix64(stream_key + ((uint64_t)element_start >> 32));
+        kernels->vector_fill_random(target_matrix.element + element_start, block_elements,
+                                    (uint32_t)element_start, (uint32_t)range_key, (uint32_t)(range_key >> 32),
+                                    min_value, max_value - min_value);
+    }
+}
+
+/**
+ * @brief Menjumlahkan dua matrix secara element-wise
+ * @param destination_matrix Matrix pertama (hasil akan disimpan di sini)
+ * @param source_matrix Matrix kedua yang akan ditambahkan
+ */
+void
+matrix_add_elementwise(struct Matrix destination_matrix, struct Matrix source_matrix)
+{
+    assert(destination_matrix.num_rows == source_matrix.num_rows);
+    assert(destination_matrix.num_columns == source_matrix.num_columns);
+
+    simd_get_kernels()->vector_add(destination_matrix.element, source_matrix.element,
+                                   destination_matrix.num_rows * destination_matrix.num_columns);
+}
+
+/**
+ * @brief Melakukan perkalian matrix (dot product)
+ * @param result_matrix Matrix untuk menyimpan hasil
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua
+ */
+void
+matrix_multiply_dot_product(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b)
+{
+    assert(matrix_a.num_columns == matrix_b.num_rows);
+    assert(result_matrix.num_rows == matrix_a.num_rows);
+    assert(result_matrix.num_columns == matrix_b.num_columns);
+
+    struct GemmOperand operand_a = { .element = matrix_a.element, .row_stride = matrix_a.num_columns, .column_stride = 1 };
+    struct GemmOperand operand_b = { .element = matrix_b.element, .row_stride = matrix_b.num_columns, .column_stride = 1 };
+
+    gemm_compute(result_matrix.num_rows, result_matrix.num_columns, matrix_a.num_columns,
+                 operand_a, operand_b, result_matrix.element, result_matrix.num_columns, NULL);
+}
+
+/**
+ * @brief Melakukan perkalian matrix A^T * B
+ * @param result_matrix Matrix untuk menyimpan hasil
+ * @param matrix_a Matrix pertama (dibaca sebagai transpose)
+ * @param matrix_b Matrix kedua
+ */
+void
+matrix_multiply_transpose_a(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b)
+{
+    assert(matrix_a.num_rows == matrix_b.num_rows);
+    assert(result_matrix.num_rows == matrix_a.num_columns);
+    assert(result_matrix.num_columns == matrix_b.num_columns);
+
+    // Transpose cukup dengan menukar stride baris dan kolom
+    struct GemmOperand operand_a = { .element = matrix_a.element, .row_stride = 1, .column_stride = matrix_a.num_columns };
+    struct GemmOperand operand_b = { .element = matrix_b.element, .row_stride = matrix_b.num_columns, .column_stride = 1 };
+
+    gemm_compute(result_matrix.num_rows, result_matrix.num_columns, matrix_a.num_rows,
+                 operand_a, operand_b, result_matrix.element, result_matrix.num_columns, NULL);
+}
+
+/**
+ * @brief Melakukan perkalian matrix A * B^T
+ * @param result_matrix Matrix untuk menyimpan hasil
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua (dibaca sebagai transpose)
+ */
+void
+matrix_multiply_transpose_b(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b)
+{
+    assert(matrix_a.num_columns == matrix_b.num_columns);
+    assert(result_matrix.num_rows == matrix_a.num_rows);
+    assert(result_matrix.num_columns == matrix_b.num_rows);
+
+    struct GemmOperand operand_a = { .element = matrix_a.element, .row_stride = matrix_a.num_columns, .column_stride = 1 };
+    struct GemmOperand operand_b = { .element = matrix_b.element, .row_stride = 1, .column_stride = matrix_b.num_columns };
+
+    gemm_compute(result_matrix.num_rows, result_matrix.num_columns, matrix_a.num_columns,
+                 operand_a, operand_b, result_matrix.element, result_matrix.num_columns, NULL);
+}
+
+/**
+ * @brief Melakukan result = aktivasi(A * B + bias) dalam satu GEMM
+ *
+ * Bias dan aktivasi diterapkan oleh epilogue micro-kernel selagi tile hasil
+ * masih di register, sehingga matrix hasil hanya ditulis sekali.
+ *
+ * @param result_matrix Matrix untuk menyimpan hasil
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua
+ * @param bias_row Bias yang ditambahkan ke setiap baris hasil
+ * @param activation_type Tipe fungsi aktivasi
+ */
+void
+matrix_multiply_bias_activation(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b,
+                                struct Row bias_row, enum ActivationType activation_type)
+{
+    assert(matrix_a.num_columns == matrix_b.num_rows);
+    assert(result_matrix.num_rows == matrix_a.num_rows);
+    assert(result_matrix.num_columns == matrix_b.num_columns);
+    assert(bias_row.num_columns == result_matrix.num_columns);
+
+    struct GemmOperand operand_a = { .element = matrix_a.element, .row_stride = matrix_a.num_columns, .column_stride = 1 };
+    struct GemmOperand operand_b = { .element = matrix_b.element, .row_stride = matrix_b.num_columns, .column_stride = 1 };
+    struct GemmEpilogue epilogue = {
+        .bias = bias_row.element, .activation_type = activation_type,
+        .use_fast_activation = activation_precision == ACTIVATION_PRECISION_FAST
+    };
+
+    gemm_compute(result_matrix.num_rows, result_matrix.num_columns, matrix_a.num_columns,
+                 operand_a, operand_b, result_matrix.element, result_matrix.num_columns, &epilogue);
+}
+
+/**
+ * @brief Melakukan result = aktivasi(A * B + bias) dengan B disimpan 16-bit
+ *
+ * Sama dengan matrix_multiply_bias_activation; elemen B dilebarkan ke fp32
+ * saat packing, akumulasi dan bias tetap fp32.
+ *
+ * @param result_matrix Matrix untuk menyimpan hasil
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua (fp16 atau bf16)
+ * @param bias_row Bias yang ditambahkan ke setiap baris hasil
+ * @param activation_type Tipe fungsi aktivasi
+ */
+void
+matrix_multiply_half_bias_activation(struct Matrix result_matrix, struct Matrix matrix_a, struct HalfMatrix matrix_b,
+                                     struct Row bias_row, enum ActivationType activation_type)
+{
+    assert(matrix_a.num_columns == matrix_b.num_rows);
+    assert(result_matrix.num_rows == matrix_a.num_rows);
+    assert(result_matrix.num_columns == matrix_b.num_columns);
+    assert(bias_row.num_columns == result_matrix.num_columns);
+
+    struct GemmOperand operand_a = { .element = matrix_a.element, .row_stride = matrix_a.num_columns, .column_stride = 1 };
+    struct GemmOperand operand_b = {
+        .row_stride = matrix_b.num_columns, .column_stride = 1,
+        .half_element = matrix_b.element, .half_format = matrix_b.format
+    };
+    struct GemmEpilogue epilogue = {
+        .bias = bias_row.element, .activation_type = activation_type,
+        .use_fast_activation = activation_precision == ACTIVATION_PRECISION_FAST
+    };
+
+    gemm_compute(result_matrix.num_rows, result_matrix.num_columns, matrix_a.num_columns,
+                 operand_a, operand_b, result_matrix.element, result_matrix.num_columns, &epilogue);
+}
+
+/**
+ * @brief Mendapatkan buffer transpose milik thread saat ini untuk kernel sparse
+ *
+ * Seperti gemm_get_pack_buffers, buffer dipakai ulang antar pemanggilan dan
+ * hanya dialokasikan ulang jika layer membutuhkan ukuran yang lebih besar.
+ *
+ * @param input_size Jumlah baris buffer input (kolom matrix A)
+ * @param output_size Jumlah baris buffer output (kolom hasil)
+ * @param transposed_input_out Pointer untuk menerima buffer input (input_size x SIMD_SPARSE_MAX_LANES)
+ * @param transposed_output_out Pointer untuk menerima buffer output (output_size x SIMD_SPARSE_MAX_LANES)
+ */
+static void
+sparse_get_transpose_buffers(size_t input_size, size_t output_size,
+                             float **transposed_input_out, float **transposed_output_out)
+{
+    static NN_THREAD_LOCAL float *transposed_input_buffer = NULL;
+    static NN_THREAD_LOCAL float *transposed_output_buffer = NULL;
+    static NN_THREAD_LOCAL size_t input_capacity = 0;
+    static NN_THREAD_LOCAL size_t output_capacity = 0;
+
+    if (input_size > input_capacity) {
+        memory_free_aligned(transposed_input_buffer);
+        transposed_input_buffer = gemm_allocate_aligned(sizeof(float) * input_size * SIMD_SPARSE_MAX_LANES);
+        input_capacity = input_size;
+    }
+    if (output_size > output_capacity) {
+        memory_free_aligned(transposed_output_buffer);
+        transposed_output_buffer = gemm_allocate_aligned(sizeof(float) * output_size * SIMD_SPARSE_MAX_LANES);
+        output_capacity = output_size;
+    }
+
+    *transposed_input_out = transposed_input_buffer;
+    *transposed_output_out = transposed_output_buffer;
+}
+
+/**
+ * @brief Melakukan result = aktivasi(A * W + bias) dengan W^T disimpan dalam CSR
+ *
+ * Baris A diproses per blok SIMD_SPARSE_MAX_LANES: blok ditranspose, lalu
+ * setiap baris CSR menghasilkan satu kolom output untuk seluruh blok dengan
+ * akumulator di register. Jumlah operasi sebanding dengan nonzero_count.
+ *
+ * @param result_matrix Matrix tujuan untuk hasil
+ * @param matrix_a Matrix pertama
+ * @param transposed_weights Transpose W dalam CSR (dari sparse_matrix_create_transposed)
+ * @param bias_row Bias yang ditambahkan ke setiap baris hasil
+ * @param activation_type Tipe fungsi aktivasi
+ */
+void
+sparse_matrix_multiply_bias_activation(struct Matrix result_matrix, struct Matrix matrix_a,
+                                       struct SparseMatrix transposed_weights, struct Row bias_row,
+                                       enum ActivationType activation_type)
+{
+    assert(matrix_a.num_columns == transposed_weights.num_columns);
+    assert(result_matrix.num_rows == matrix_a.num_rows);
+    assert(result_matrix.num_columns == transposed_weights.num_rows);
+    assert(bias_row.num_columns == result_matrix.num_columns);
+
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+    size_t input_size = matrix_a.num_columns;
+    size_t output_size = result_matrix.num_columns;
+    float *transposed_input, *transposed_output;
+
+    sparse_get_transpose_buffers(input_size, output_size, &transposed_input, &transposed_output);
+
+    for (size_t row_start = 0; row_start < matrix_a.num_rows; row_start += SIMD_SPARSE_MAX_LANES) {
+        size_t lanes = matrix_a.num_rows - row_start < SIMD_SPARSE_MAX_LANES
+                     ? matrix_a.num_rows - row_start : SIMD_SPARSE_MAX_LANES;
+
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            const float *input_row = &matrix_at(matrix_a, row_start + lane, 0);
+            for (size_t input_idx = 0; input_idx < input_size; ++input_idx)
+                transposed_input[input_idx * SIMD_SPARSE_MAX_LANES + lane] = input_row[input_idx];
+        }
+
+        for (size_t output_idx = 0; output_idx < output_size; ++output_idx) {
+            size_t nonzero_start = transposed_weights.row_offsets[output_idx];
+            kernels->sparse_row_kernel(transposed_output + output_idx * SIMD_SPARSE_MAX_LANES,
+                                       transposed_weights.values + nonzero_start,
+                                       transposed_weights.column_indexes + nonzero_start,
+                                       transposed_weights.row_offsets[output_idx + 1] - nonzero_start,
+                                       transposed_input, SIMD_SPARSE_MAX_LANES, lanes);
+        }
+
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            float *result_row = &matrix_at(result_matrix, row_start + lane, 0);
+            for (size_t output_idx = 0; output_idx < output_size; ++output_idx)
+                result_row[output_idx] = transposed_output[output_idx * SIMD_SPARSE_MAX_LANES + lane]
+                                       + bias_row.element[output_idx];
+
+            activation_apply_array(result_row, output_size, activation_type);
+        }
+    }
+}
+
+/**
+ * @brief Menambahkan satu row ke setiap baris matrix (broadcast)
+ * @param destination_matrix Matrix yang akan ditambah
+ * @param source_row Row yang ditambahkan ke setiap baris
+ */
+void
+matrix_add_row_broadcast(struct Matrix destination_matrix, struct Row source_row)
+{
+    assert(destination_matrix.num_columns == source_row.num_columns);
+
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+
+    for (size_t row_idx = 0; row_idx < destination_matrix.num_rows; ++row_idx)
+        kernels->vector_add(&matrix_at(destination_matrix, row_idx, 0), source_row.element, source_row.num_columns);
+}
+
+/**
+ * @brief Menyalin isi matrix sumber ke matrix tujuan
+ * @param destination_matrix Matrix tujuan
+ * @param source_matrix Matrix sumber
+ */
+void
+matrix_copy_data(struct Matrix destination_matrix, struct Matrix source_matrix)
+{
+    assert(destination_matrix.num_rows == source_matrix.num_rows);
+    assert(destination_matrix.num_columns == source_matrix.num_columns);
+
+    simd_get_kernels()->vector_copy(destination_matrix.element, source_matrix.element,
+                                    destination_matrix.num_rows * destination_matrix.num_columns);
+}
+
+/**
+ * @brief Menerapkan fungsi aktivasi ke semua elemen matrix
+ * @param target_matrix Matrix yang akan diproses
+ * @param activation_type Tipe fungsi aktivasi yang akan diterapkan
+ */
+void
+matrix_apply_activation(struct Matrix target_matrix, enum ActivationType activation_type)
+{
+    activation_apply_array(target_matrix.element, target_matrix.num_rows * target_matrix.num_columns, activation_type);
+}
+
+/**
+ * @brief Mencetak matrix ke console dengan format yang rapi
+ * @param input_matrix Matrix yang akan dicetak
+ * @param matrix_name Nama matrix untuk label
+ * @param indent_padding Jumlah spasi untuk indentasi
+ */
+void
+matrix_print_to_console(struct Matrix input_matrix, const char *matrix_name, size_t indent_padding)
+{
+    printf("%*s%s = [\n", (int)indent_padding, "", matrix_name);
+    for (size_t row_idx = 0; row_idx < input_matrix.num_rows; ++row_idx) {
+        printf("%*s    ", (int)indent_padding, "");
+        for (size_t col_idx = 0; col_idx < input_matrix.num_columns; ++col_idx) {
+            printf("%f ", matrix_at(input_matrix, row_idx, col_idx));
+        }
+        printf("\n");
+    }
+    printf("%*s]\n", (int)indent_padding, "");
+}
+
+// =====================[ NEURAL NETWORK - IMPLEMENTATION ]=====================
+
+/**
+ * @brief Alignment buffer parameter neural network (cache line)
+ */
+#define NEURAL_NETWORK_PARAMETER_ALIGNMENT ((size_t)64)
+
+/**
+ * @brief Jumlah float per blok alignment parameter
+ */
+#define NEURAL_NETWORK_PARAMETER_ALIGNMENT_FLOATS (NEURAL_NETWORK_PARAMETER_ALIGNMENT / sizeof(float))
+
+/**
+ * @brief Membulatkan jumlah float ke kelipatan blok alignment parameter
+ */
+static size_t
+neural_network_align_parameter_count(size_t float_count)
+{
+    return (float_count + NEURAL_NETWORK_PARAMETER_ALIGNMENT_FLOATS - 1) &
+           ~(NEURAL_NETWORK_PARAMETER_ALIGNMENT_FLOATS - 1);
+}
+
+/**
+ * @brief Menyusun view weights dan biases di atas buffer parameter flat
+ *
+ * Urutan blok W0, b0, W1, b1, ... dan setiap blok dimulai di batas 64 byte
+ * (sisa blok adalah padding bernilai nol). Layout yang sama dipakai oleh
+ * file model biner, sehingga file bisa di-mmap langsung.
+ *
+ * @param layer_architecture Array ukuran setiap layer
+ * @param total_layers Jumlah layer
+ * @param parameter_buffer Buffer parameter (NULL untuk hanya menghitung ukuran)
+ * @param weight_matrices Array view weights yang diisi (boleh NULL jika parameter_buffer NULL)
+ * @param bias_vectors Array view bias yang diisi (boleh NULL jika parameter_buffer NULL)
+ * @return Jumlah float di buffer parameter, termasuk padding
+ */
+static size_t
+neural_network_layout_parameters(const size_t *layer_architecture, size_t total_layers, float *parameter_buffer,
+                                 struct Matrix *weight_matrices, struct Row *bias_vectors)
+{
+    size_t parameter_offset = 0;
+
+    for (size_t layer_idx = 1; layer_idx < total_layers; ++layer_idx) {
+        size_t input_size = layer_architecture[layer_idx - 1];
+        size_t output_size = layer_architecture[layer_idx];
+
+        if (parameter_buffer != NULL) {
+            weight_matrices[layer_idx - 1] = (struct Matrix) {
+                .num_rows = input_size, .num_columns = output_size, .element = parameter_buffer + parameter_offset
+            };
+        }
+        parameter_offset += neural_network_align_parameter_count(input_size * output_size);
+
+        if (parameter_buffer != NULL) {
+            bias_vectors[layer_idx - 1] = (struct Row) {
+                .num_columns = output_size, .element = parameter_buffer + parameter_offset
+            };
+        }
+        parameter_offset += neural_network_align_parameter_count(output_size);
+    }
+
+    return parameter_offset;
+}
+
+/**
+ * @brief Mengalokasikan neural network baru dengan arsitektur tertentu
+ *
+ * Weights dan biases semua layer disimpan berurutan di parameter_buffer;
+ * weight_matrices dan bias_vectors hanya view ke buffer tersebut.
+ *
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param layer_architecture Array berisi ukuran setiap layer
+ * @param total_layers Jumlah layer dalam arsitektur
+ * @return Neural network yang siap digunakan
+ */
+struct NeuralNetwork
+neural_network_allocate(struct MemoryArena *arena_ptr, size_t *layer_architecture, size_t total_layers)
+{
+    assert(total_layers > 1);
+
+    struct NeuralNetwork neural_network;
+    neural_network.layer_sizes = layer_architecture;
+    neural_network.total_layers = total_layers;
+
+    // Alokasi array untuk weights, biases, dan activation types
+    neural_network.weight_matrices = arena_allocate_memory(
+            arena_ptr, sizeof(*neural_network.weight_matrices) * (total_layers - 1));
+    assert(neural_network.weight_matrices != NULL);
+
+    neural_network.bias_vectors = arena_allocate_memory(
+            arena_ptr, sizeof(*neural_network.bias_vectors) * (total_layers - 1));
+    assert(neural_network.bias_vectors != NULL);
+
+    neural_network.activation_types = arena_allocate_memory(
+            arena_ptr, sizeof(*neural_network.activation_types) * total_layers);
+    assert(neural_network.activation_types != NULL);
+
+    // Semua parameter berada di satu buffer 64-byte aligned: W0, b0, W1, b1, ...
+    neural_network.parameter_count =
+        neural_network_layout_parameters(layer_architecture, total_layers, NULL, NULL, NULL);
+
+    neural_network.parameter_buffer = arena_allocate_aligned(
+            arena_ptr, sizeof(float) * neural_network.parameter_count, NEURAL_NETWORK_PARAMETER_ALIGNMENT);
+    assert(neural_network.parameter_buffer != NULL);
+
+    // Weights dan biases adalah view ke buffer parameter
+    neural_network_layout_parameters(layer_architecture, total_layers, neural_network.parameter_buffer,
+                                     neural_network.weight_matrices, neural_network.bias_vectors);
+
+    // Setup input layer (tidak ada aktivasi)
+    neural_network.activation_types[0] = ACTIVATION_NONE;
+
+    // Setup hidden dan output layers
+    for (size_t layer_idx = 1; layer_idx < total_layers; ++layer_idx)
+        neural_network.activation_types[layer_idx] = ACTIVATION_RELU; // Default hidden layer activation
+
+    // Output layer menggunakan sigmoid untuk klasifikasi
+    neural_network.activation_types[total_layers - 1] = ACTIVATION_SIGMOID;
+
+    return neural_network;
+}
+
+/**
+ * @brief Mengisi semua weights dan biases dengan nol
+ * @param network Neural network yang akan di-zero
+ */
+void
+neural_network_zero_weights(struct NeuralNetwork network)
+{
+    if (network.parameter_buffer != NULL) {
+        memset(network.parameter_buffer, 0, sizeof(*network.parameter_buffer) * network.parameter_count);
+        return;
+    }
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        matrix_fill_with_value(network.weight_matrices[layer_idx], 0);
+        row_fill_with_value(network.bias_vectors[layer_idx], 0);
+    }
+}
+
+/**
+ * @brief Mengalokasikan context eksekusi (buffer aktivasi) untuk satu pemanggil
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param network Neural network yang akan dijalankan dengan context ini
+ * @return Struktur NeuralNetworkContext yang siap digunakan
+ */
+struct NeuralNetworkContext
+neural_network_allocate_context(struct MemoryArena *arena_ptr, struct NeuralNetwork network)
+{
+    struct NeuralNetworkContext context;
+    context.total_layers = network.total_layers;
+    context.activation_vectors = arena_allocate_memory(
+            arena_ptr, sizeof(*context.activation_vectors) * network.total_layers);
+    assert(context.activation_vectors != NULL);
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers; ++layer_idx)
+        context.activation_vectors[layer_idx] = row_allocate(arena_ptr, network.layer_sizes[layer_idx]);
+
+    return context;
+}
+
+/**
+ * @brief Melakukan forward propagation pada neural network
+ *
+ * Network hanya dibaca; semua aktivasi ditulis ke context milik pemanggil.
+ *
+ * @param network Neural network yang akan diproses
+ * @param context Context berisi input di activation_vectors[0]
+ */
+void
+neural_network_forward_pass(struct NeuralNetwork network, struct NeuralNetworkContext context)
+{
+    assert(network.total_layers > 1);
+    assert(context.total_layers == network.total_layers);
+
+    // Proses setiap layer dari input ke output
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        // activation[i + 1] = aktivasi(activation[i] * weights[i] + bias[i])
+        matrix_multiply_bias_activation(
+                row_convert_to_matrix(context.activation_vectors[layer_idx + 1]),
+                row_convert_to_matrix(context.activation_vectors[layer_idx]),
+                network.weight_matrices[layer_idx],
+                network.bias_vectors[layer_idx],
+                network.activation_types[layer_idx + 1]);
+    }
+}
+
+/**
+ * @brief Mengalokasikan matrix aktivasi untuk forward pass mode batch
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param network Neural network yang akan diproses
+ * @param batch_capacity Jumlah baris maksimum per batch
+ * @return Struktur BatchActivations yang siap digunakan
+ */
+struct BatchActivations
+neural_network_allocate_batch_activations(struct MemoryArena *arena_ptr,
+                                          struct NeuralNetwork network,
+                                          size_t batch_capacity)
+{
+    assert(batch_capacity > 0);
+
+    struct BatchActivations batch_activations;
+    batch_activations.batch_capacity = batch_capacity;
+    batch_activations.activation_matrices = arena_allocate_memory(
+            arena_ptr, sizeof(*batch_activations.activation_matrices) * network.total_layers);
+    assert(batch_activations.activation_matrices != NULL);
+
+    // Setiap baris yang dibaca selalu ditulis lebih dulu oleh forward/backward pass
+    for (size_t layer_idx = 0; layer_idx < network.total_layers; ++layer_idx)
+        batch_activations.activation_matrices[layer_idx] =
+            matrix_allocate_uninitialized(arena_ptr, batch_capacity, network.layer_sizes[layer_idx]);
+
+    return batch_activations;
+}
+
+/**
+ * @brief Melakukan forward propagation untuk beberapa sample sekaligus
+ * @param network Neural network yang akan diproses
+ * @param batch_activations Matrix aktivasi tujuan
+ * @param input_batch Matrix input (B baris, minimal ukuran input layer kolom)
+ */
+void
+neural_network_forward_pass_batch(struct NeuralNetwork network,
+                                  struct BatchActivations batch_activations,
+                                  struct Matrix input_batch)
+{
+    assert(network.total_layers > 1);
+    assert(input_batch.num_rows <= batch_activations.batch_capacity);
+    assert(input_batch.num_columns >= network.layer_sizes[0]);
+
+    size_t batch_rows = input_batch.num_rows;
+    struct Matrix input_activation =
+        matrix_create_row_slice(batch_activations.activation_matrices[0], 0, batch_rows);
+
+    // Salin kolom input dari setiap sample (dataset bisa berisi kolom output juga)
+    for (size_t row_idx = 0; row_idx < batch_rows; ++row_idx)
+        memcpy(&matrix_at(input_activation, row_idx, 0),
+               &matrix_at(input_batch, row_idx, 0),
+               sizeof(*input_activation.element) * input_activation.num_columns);
+
+    // Proses setiap layer dari input ke output, satu GEMM (dengan epilogue bias + aktivasi) per layer
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        struct Matrix current_activation =
+            matrix_create_row_slice(batch_activations.activation_matrices[layer_idx], 0, batch_rows);
+        struct Matrix next_activation =
+            matrix_create_row_slice(batch_activations.activation_matrices[layer_idx + 1], 0, batch_rows);
+
+        matrix_multiply_bias_activation(next_activation, current_activation, network.weight_matrices[layer_idx],
+                                        network.bias_vectors[layer_idx], network.activation_types[layer_idx + 1]);
+    }
+}
+
+/**
+ * @brief Jumlah baris minimum per thread saat menghitung gradient
+ *
+ * Batch kecil tidak dibagi ke banyak thread karena biaya sinkronisasi dan
+ * reduksi akan lebih besar dari pekerjaannya.
+ */
+#define GRADIENT_MIN_ROWS_PER_THREAD ((size_t)32)
+
+/**
+ * @brief Workspace milik satu thread (partisi) saat menghitung gradient
+ */
+struct GradientWorkspace
+{
+    struct NeuralNetwork gradient_network;      // Gradient partisi (dijumlahkan saat reduksi)
+    struct BatchActivations batch_activations;  // Aktivasi setiap layer untuk partisi
+    struct BatchActivations batch_errors;       // Error setiap layer untuk partisi
+    float squared_error;                        // Jumlah squared error output partisi
+    float batch_cost;                           // MSE batch terakhir (hanya di partisi 0)
+};
+
+/**
+ * @brief Menghitung jumlah thread yang dipakai untuk satu batch
+ * @param sample_count Jumlah sample dalam batch
+ * @return Jumlah thread (minimal 1)
+ */
+static size_t
+gradient_thread_count(size_t sample_count)
+{
+#if defined(_OPENMP)
+    // Dipanggil dari worker yang sudah paralel (misalnya Hogwild): tetap satu thread
+    if (omp_in_parallel()) return 1;
+
+    size_t max_threads = (size_t)omp_get_max_threads();
+    size_t useful_threads = (sample_count + GRADIENT_MIN_ROWS_PER_THREAD - 1) / GRADIENT_MIN_ROWS_PER_THREAD;
+
+    return useful_threads < max_threads ? (useful_threads > 0 ? useful_threads : 1) : max_threads;
+#else
+    (void)sample_count;
+    return 1;
+#endif
+}
+
+/**
+ * @brief Backpropagation untuk satu partisi batch
+ *
+ * Error output dikalikan sample_scale (1 / jumlah sample seluruh batch),
+ * sehingga jumlah gradient semua partisi sama dengan gradient rata-rata batch.
+ * Squared error dijumlahkan di loop yang sama, jadi cost batch tidak butuh
+ * forward pass tambahan.
+ *
+ * @param network Neural network
+ * @param workspace Workspace partisi (gradient_network ditimpa)
+ * @param training_data Baris training milik partisi ini
+ * @param sample_scale Faktor skala error output
+ * @return Jumlah squared error output partisi (sebelum diskalakan)
+ */
+static float
+gradient_compute_partition(struct NeuralNetwork network, struct GradientWorkspace workspace,
+                           struct Matrix training_data, float sample_scale)
+{
+    struct NeuralNetwork gradient_network = workspace.gradient_network;
+    struct BatchActivations batch_activations = workspace.batch_activations;
+    struct BatchActivations batch_errors = workspace.batch_errors;
+
+    size_t sample_count = training_data.num_rows;
+    size_t input_columns = network.layer_sizes[0];
+    size_t output_columns = network.layer_sizes[network.total_layers - 1];
+
+    // Gradient bias diakumulasi, gradient weights ditimpa oleh GEMM
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx)
+        row_fill_with_value(gradient_network.bias_vectors[layer_idx], 0);
+
+    // Forward pass untuk semua sample partisi sekaligus
+    neural_network_forward_pass_batch(network, batch_activations, training_data);
+
+    // Hitung error di output layer, langsung diskalakan agar gradient sudah dirata-rata
+    struct Matrix network_output = batch_activations.activation_matrices[network.total_layers - 1];
+    struct Matrix output_error = batch_errors.activation_matrices[network.total_layers - 1];
+
+    float squared_error = 0.0f;
+
+    for (size_t sample_idx = 0; sample_idx < sample_count; ++sample_idx) {
+        for (size_t output_idx = 0; output_idx < output_columns; ++output_idx) {
+            float prediction_diff = matrix_at(network_output, sample_idx, output_idx) -
+                                    matrix_at(training_data, sample_idx, input_columns + output_idx);
+
+            squared_error += prediction_diff * prediction_diff;
+            matrix_at(output_error, sample_idx, output_idx) = prediction_diff * sample_scale;
+        }
+    }
+
+    // Backpropagation dari output ke input
+    for (size_t layer_idx = network.total_layers - 1; layer_idx > 0; --layer_idx) {
+        struct Matrix current_activation =
+            matrix_create_row_slice(batch_activations.activation_matrices[layer_idx], 0, sample_count);
+        struct Matrix previous_activation =
+            matrix_create_row_slice(batch_activations.activation_matrices[layer_idx - 1], 0, sample_count);
+        struct Matrix current_error =
+            matrix_create_row_slice(batch_errors.activation_matrices[layer_idx], 0, sample_count);
+        struct Row gradient_bias = gradient_network.bias_vectors[layer_idx - 1];
+
+        // Kalikan error dengan turunan aktivasi untuk seluruh partisi sekaligus
+        activation_multiply_derivative_array(current_error.element, current_activation.element,
+                                             sample_count * current_error.num_columns,
+                                             network.activation_types[layer_idx]);
+
+        // Gradient bias: jumlah error setiap kolom
+        for (size_t sample_idx = 0; sample_idx < sample_count; ++sample_idx)
+            matrix_add_elementwise(row_convert_to_matrix(gradient_bias),
+                                   row_convert_to_matrix(matrix_get_row(current_error, sample_idx)));
+
+        // Gradient weights: activation[i-1]^T * error[i]
+        matrix_multiply_transpose_a(gradient_network.weight_matrices[layer_idx - 1], previous_activation, current_error);
+
+        // Propagasi error ke layer sebelumnya: error[i] * weights^T
+        if (layer_idx > 1)
+            matrix_multiply_transpose_b(
+                    matrix_create_row_slice(batch_errors.activation_matrices[layer_idx - 1], 0, sample_count),
+                    current_error,
+                    network.weight_matrices[layer_idx - 1]);
+    }
+
+    return squared_error;
+}
+
+/**
+ * @brief Apakah dua network sama-sama memakai buffer parameter flat dengan ukuran sama
+ */
+static bool
+neural_network_has_same_parameter_layout(struct NeuralNetwork first_network, struct NeuralNetwork second_network)
+{
+    return first_network.parameter_buffer != NULL && second_network.parameter_buffer != NULL &&
+           first_network.parameter_count == second_network.parameter_count;
+}
+
+/**
+ * @brief Menjumlahkan gradient source ke destination (weights dan biases)
+ */
+static void
+gradient_network_accumulate(struct NeuralNetwork destination_network, struct NeuralNetwork source_network)
+{
+    if (neural_network_has_same_parameter_layout(destination_network, source_network)) {
+        simd_get_kernels()->vector_add(destination_network.parameter_buffer, source_network.parameter_buffer,
+                                       destination_network.parameter_count);
+        return;
+    }
+
+    for (size_t layer_idx = 0; layer_idx < destination_network.total_layers - 1; ++layer_idx) {
+        matrix_add_elementwise(destination_network.weight_matrices[layer_idx],
+                               source_network.weight_matrices[layer_idx]);
+        matrix_add_elementwise(row_convert_to_matrix(destination_network.bias_vectors[layer_idx]),
+                               row_convert_to_matrix(source_network.bias_vectors[layer_idx]));
+    }
+}
+
+/**
+ * @brief Mengalokasikan workspace training yang dipakai ulang setiap mini-batch
+ *
+ * Gradient network, aktivasi, dan error untuk setiap partisi thread
+ * dialokasikan sekali di sini. Setelah itu perhitungan gradient tidak lagi
+ * mengalokasikan atau mengosongkan buffer seukuran model: gradient weights
+ * ditimpa langsung oleh GEMM dan hanya gradient bias yang direset.
+ *
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param network Neural network yang akan dilatih
+ * @param batch_capacity Jumlah baris maksimum per batch
+ * @return Struktur TrainingWorkspace yang siap digunakan
+ */
+struct TrainingWorkspace
+training_workspace_allocate(struct MemoryArena *arena_ptr, struct NeuralNetwork network, size_t batch_capacity)
+{
+    assert(batch_capacity > 0);
+
+    struct TrainingWorkspace training_workspace;
+    training_workspace.batch_capacity = batch_capacity;
+    training_workspace.partition_count = gradient_thread_count(batch_capacity);
+
+    // Partisi terbesar: batch kecil dibagi per GRADIENT_MIN_ROWS_PER_THREAD baris,
+    // batch besar dibagi rata ke semua partisi
+    size_t even_partition_rows =
+        (batch_capacity + training_workspace.partition_count - 1) / training_workspace.partition_count;
+    size_t partition_capacity =
+        even_partition_rows > GRADIENT_MIN_ROWS_PER_THREAD ? even_partition_rows : GRADIENT_MIN_ROWS_PER_THREAD;
+    training_workspace.partition_capacity = partition_capacity < batch_capacity ? partition_capacity : batch_capacity;
+
+    // Workspace dialokasikan dari arena secara serial (arena tidak thread-safe)
+    training_workspace.partitions = arena_allocate_memory(
+            arena_ptr, sizeof(*training_workspace.partitions) * training_workspace.partition_count);
+    assert(training_workspace.partitions != NULL);
+
+    for (size_t partition_idx = 0; partition_idx < training_workspace.partition_count; ++partition_idx) {
+        struct GradientWorkspace *partition = &training_workspace.partitions[partition_idx];
+
+        partition->gradient_network = neural_network_allocate(arena_ptr, network.layer_sizes, network.total_layers);
+        partition->batch_activations = neural_network_allocate_batch_activations(
+                arena_ptr, network, training_workspace.partition_capacity);
+        partition->batch_errors = neural_network_allocate_batch_activations(
+                arena_ptr, network, training_workspace.partition_capacity);
+        partition->squared_error = 0.0f;
+        partition->batch_cost = 0.0f;
+    }
+
+    return training_workspace;
+}
+
+/**
+ * @brief Menghitung gradient satu batch memakai workspace yang sudah dialokasikan
+ *
+ * Batch dibagi menjadi partisi baris yang berurutan, satu per thread OpenMP.
+ * Setiap thread memiliki workspace aktivasi dan gradient sendiri, lalu
+ * gradient digabung dengan reduksi pohon berpasangan (0+1, 2+3, lalu 0+2, ...).
+ * Urutan penjumlahan hanya bergantung pada jumlah thread, sehingga hasilnya
+ * reproducible untuk jumlah thread yang sama.
+ *
+ * @param training_workspace Workspace dari training_workspace_allocate
+ * @param network Neural network
+ * @param training_data Matrix berisi data training (input + output)
+ * @return Neural network berisi gradient (milik workspace, ditimpa pemanggilan berikutnya)
+ */
+struct NeuralNetwork
+training_workspace_compute_gradients(struct TrainingWorkspace training_workspace,
+                                     struct NeuralNetwork network,
+                                     struct Matrix training_data)
+{
+    size_t sample_count = training_data.num_rows;
+
+    assert(sample_count > 0);
+    assert(sample_count <= training_workspace.batch_capacity);
+    assert(network.layer_sizes[0] + network.layer_sizes[network.total_layers - 1] <= training_data.num_columns);
+
+    size_t thread_count = gradient_thread_count(sample_count);
+    if (thread_count > training_workspace.partition_count) thread_count = training_workspace.partition_count;
+
+    size_t rows_per_thread = sample_count / thread_count;
+    size_t remainder_rows = sample_count % thread_count;
+    float sample_scale = 1.0f / (float)sample_count;
+
+    assert(rows_per_thread + (remainder_rows > 0 ? 1 : 0) <= training_workspace.partition_capacity);
+
+    // Setiap thread menghitung gradient partisinya sendiri
+    #pragma omp parallel for num_threads((int)thread_count) schedule(static, 1) if (thread_count > 1)
+    for (long thread_idx = 0; thread_idx < (long)thread_count; ++thread_idx) {
+        size_t partition_idx = (size_t)thread_idx;
+        size_t start_row = partition_idx * rows_per_thread + (partition_idx < remainder_rows ? partition_idx : remainder_rows);
+        size_t partition_rows = rows_per_thread + (partition_idx < remainder_rows ? 1 : 0);
+
+        training_workspace.partitions[partition_idx].squared_error =
+            gradient_compute_partition(network, training_workspace.partitions[partition_idx],
+                                       matrix_create_row_slice(training_data, start_row, partition_rows),
+                                       sample_scale);
+    }
+
+    // Cost batch dijumlahkan dengan urutan partisi tetap
+    struct GradientWorkspace *partitions = training_workspace.partitions;
+    float total_squared_error = 0.0f;
+    for (size_t partition_idx = 0; partition_idx < thread_count; ++partition_idx)
+        total_squared_error += partitions[partition_idx].squared_error;
+    partitions[0].batch_cost = total_squared_error / (float)sample_count;
+
+    // Reduksi pohon berpasangan dengan urutan tetap ke partisi 0
+    for (size_t stride = 1; stride < thread_count; stride *= 2) {
+        #pragma omp parallel for num_threads((int)thread_count) schedule(static, 1) if (thread_count > 2 * stride)
+        for (long thread_idx = 0; thread_idx < (long)thread_count; thread_idx += (long)(2 * stride)) {
+            if ((size_t)thread_idx + stride < thread_count)
+                gradient_network_accumulate(partitions[thread_idx].gradient_network,
+                                            partitions[thread_idx + stride].gradient_network);
+        }
+    }
+
+    return partitions[0].gradient_network;
+}
+
+/**
+ * @brief Mengambil cost (mean squared error) batch terakhir
+ *
+ * Cost dihitung dari aktivasi output forward pass di dalam
+ * training_workspace_compute_gradients, yaitu sebelum parameter diupdate.
+ *
+ * @param training_workspace Workspace yang sudah dipakai training_workspace_compute_gradients
+ * @return Nilai cost rata-rata batch terakhir
+ */
+float
+training_workspace_get_batch_cost(struct TrainingWorkspace training_workspace)
+{
+    return training_workspace.partitions[0].batch_cost;
+}
+
+/**
+ * @brief Menghitung gradient menggunakan backpropagation
+ *
+ * Workspace dialokasikan dari arena setiap kali dipanggil. Untuk training
+ * berulang, pakai training_workspace_allocate sekali lalu
+ * training_workspace_compute_gradients.
+ *
+ * @param arena_ptr Arena untuk alokasi temporary
+ * @param network Neural network
+ * @param training_data Matrix berisi data training (input + output)
+ * @return Neural network berisi gradient
+ */
+struct NeuralNetwork
+neural_network_compute_gradients(struct MemoryArena *arena_ptr,
+                                 struct NeuralNetwork network,
+                                 struct Matrix training_data)
+{
+    struct TrainingWorkspace training_workspace =
+        training_workspace_allocate(arena_ptr, network, training_data.num_rows);
+
+    return training_workspace_compute_gradients(training_workspace, network, training_data);
+}
+
+/**
+ * @brief Jumlah parameter per potongan saat update dibagi ke beberapa thread
+ */
+#define PARAMETER_UPDATE_CHUNK ((size_t)16384)
+
+/**
+ * @brief Menerapkan gradient untuk memperbarui weights dan biases
+ *
+ * Jika kedua network memakai buffer parameter flat, update menjadi satu axpy
+ * SIMD atas seluruh buffer yang dibagi ke thread OpenMP per potongan.
+ *
+ * @param network Neural network yang akan diupdate
+ * @param gradient_network Neural network berisi gradient
+ * @param learning_rate Learning rate untuk update
+ */
+void
+neural_network_apply_gradients(struct NeuralNetwork network,
+                               struct NeuralNetwork gradient_network,
+                               float learning_rate)
+{
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+
+    if (neural_network_has_same_parameter_layout(network, gradient_network)) {
+        size_t parameter_count = network.parameter_count;
+        long chunk_count = (long)((parameter_count + PARAMETER_UPDATE_CHUNK - 1) / PARAMETER_UPDATE_CHUNK);
+
+        // parameter -= learning_rate * gradient
+        #pragma omp parallel for schedule(static) if (chunk_count > 4)
+        for (long chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx) {
+            size_t start_idx = (size_t)chunk_idx * PARAMETER_UPDATE_CHUNK;
+            size_t chunk_size = parameter_count - start_idx < PARAMETER_UPDATE_CHUNK
+                              ? parameter_count - start_idx : PARAMETER_UPDATE_CHUNK;
+
+            kernels->vector_axpy(network.parameter_buffer + start_idx,
+                                 gradient_network.parameter_buffer + start_idx, -learning_rate, chunk_size);
+        }
+        return;
+    }
+
+    // Update per layer untuk network yang view-nya tidak berada di satu buffer
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        struct Matrix weights = network.weight_matrices[layer_idx];
+        struct Row biases = network.bias_vectors[layer_idx];
+
+        kernels->vector_axpy(weights.element, gradient_network.weight_matrices[layer_idx].element,
+                             -learning_rate, weights.num_rows * weights.num_columns);
+        kernels->vector_axpy(biases.element, gradient_network.bias_vectors[layer_idx].element,
+                             -learning_rate, biases.num_columns);
+    }
+}
+
+/**
+ * @brief Menyalin semua weights dan biases dari source ke destination
+ *
+ * Network dengan buffer parameter flat disalin dengan satu memcpy.
+ *
+ * @param destination_network Network tujuan (arsitektur sama dengan source)
+ * @param source_network Network sumber
+ */
+void
+neural_network_copy_parameters(struct NeuralNetwork destination_network, struct NeuralNetwork source_network)
+{
+    assert(destination_network.total_layers == source_network.total_layers);
+
+    if (neural_network_has_same_parameter_layout(destination_network, source_network)) {
+        memcpy(destination_network.parameter_buffer, source_network.parameter_buffer,
+               sizeof(*source_network.parameter_buffer) * source_network.parameter_count);
+        return;
+    }
+
+    for (size_t layer_idx = 0; layer_idx < source_network.total_layers - 1; ++layer_idx) {
+        matrix_copy_data(destination_network.weight_matrices[layer_idx], source_network.weight_matrices[layer_idx]);
+        row_copy_data(destination_network.bias_vectors[layer_idx], source_network.bias_vectors[layer_idx]);
+    }
+}
+
+// =======================[ OPTIMIZER - IMPLEMENTATION ]========================
+
+/**
+ * @brief Membuat optimizer untuk network dengan buffer parameter flat
+ * @param arena_ptr Arena untuk alokasi state optimizer
+ * @param network Neural network yang akan dioptimasi
+ * @param optimizer_type Algoritma optimizer
+ * @param learning_rate Learning rate
+ * @return Optimizer yang siap digunakan
+ */
+struct Optimizer
+optimizer_create(struct MemoryArena *arena_ptr, struct NeuralNetwork network,
+                 enum OptimizerType optimizer_type, float learning_rate)
+{
+    assert(network.parameter_buffer != NULL);
+
+    struct Optimizer optimizer = {0};
+    optimizer.optimizer_type = optimizer_type;
+    optimizer.learning_rate = learning_rate;
+    optimizer.beta1 = 0.9f;
+    optimizer.beta2 = optimizer_type == OPTIMIZER_ADAM ? 0.999f : 0.9f;
+    optimizer.epsilon = 1e-8f;
+    optimizer.parameter_count = network.parameter_count;
+
+    // State dialokasikan (dan dinolkan) oleh arena hanya jika dipakai algoritmanya
+    if (optimizer_type == OPTIMIZER_MOMENTUM || optimizer_type == OPTIMIZER_ADAM) {
+        optimizer.first_moment = arena_allocate_aligned(arena_ptr, sizeof(float) * network.parameter_count,
+                                                        ARENA_CACHE_LINE_SIZE);
+        assert(optimizer.first_moment != NULL);
+    }
+
+    if (optimizer_type == OPTIMIZER_RMSPROP || optimizer_type == OPTIMIZER_ADAM) {
+        optimizer.second_moment = arena_allocate_aligned(arena_ptr, sizeof(float) * network.parameter_count,
+                                                         ARENA_CACHE_LINE_SIZE);
+        assert(optimizer.second_moment != NULL);
+    }
+
+    return optimizer;
+}
+
+/**
+ * @brief Memperbarui parameter network dengan satu step optimizer
+ * @param optimizer Optimizer (state diperbarui)
+ * @param network Neural network yang akan diupdate
+ * @param gradient_network Neural network berisi gradient (layout parameter sama)
+ */
+void
+optimizer_step(struct Optimizer *optimizer, struct NeuralNetwork network, struct NeuralNetwork gradient_network)
+{
+    assert(neural_network_has_same_parameter_layout(network, gradient_network));
+    assert(network.parameter_count == optimizer->parameter_count);
+
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+    struct Optimizer state = *optimizer;
+    size_t parameter_count = network.parameter_count;
+    long chunk_count = (long)((parameter_count + PARAMETER_UPDATE_CHUNK - 1) / PARAMETER_UPDATE_CHUNK);
+
+    ++optimizer->step_count;
+
+    // Koreksi bias Adam dilipat ke step size dan epsilon agar kernel tetap satu pass
+    float bias_correction1 = 1.0f - powf(state.beta1, (float)optimizer->step_count);
+    float bias_correction2 = 1.0f - powf(state.beta2, (float)optimizer->step_count);
+    float adam_step_size = state.learning_rate * sqrtf(bias_correction2) / bias_correction1;
+    float adam_epsilon = state.epsilon * sqrtf(bias_correction2);
+
+    #pragma omp parallel for schedule(static) if (chunk_count > 4)
+    for (long chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx) {
+        size_t start_idx = (size_t)chunk_idx * PARAMETER_UPDATE_CHUNK;
+        size_t chunk_size = parameter_count - start_idx < PARAMETER_UPDATE_CHUNK
+                          ? parameter_count - start_idx : PARAMETER_UPDATE_CHUNK;
+        float *parameters = network.parameter_buffer + start_idx;
+        const float *gradients = gradient_network.parameter_buffer + start_idx;
+
+        switch (state.optimizer_type) {
+            case OPTIMIZER_SGD:
+                kernels->vector_axpy(parameters, gradients, -state.learning_rate, chunk_size);
+                break;
+            case OPTIMIZER_MOMENTUM:
+                kernels->optimizer_momentum(parameters, gradients, state.first_moment + start_idx, chunk_size,
+                                            state.learning_rate, state.beta1);
+                break;
+            case OPTIMIZER_RMSPROP:
+                kernels->optimizer_rmsprop(parameters, gradients, state.second_moment + start_idx, chunk_size,
+                                           state.learning_rate, state.beta2, state.epsilon);
+                break;
+            case OPTIMIZER_ADAM:
+                kernels->optimizer_adam(parameters, gradients, state.first_moment + start_idx,
+                                        state.second_moment + start_idx, chunk_size,
+                                        adam_step_size, state.beta1, state.beta2, adam_epsilon);
+                break;
+        }
+
+        // Weights yang sudah dipangkas dikembalikan ke nol setelah update
+        if (state.parameter_mask != NULL) {
+            const float *mask = state.parameter_mask + start_idx;
+            for (size_t parameter_idx = 0; parameter_idx < chunk_size; ++parameter_idx)
+                parameters[parameter_idx] *= mask[parameter_idx];
+        }
+    }
+}
+
+// ===================[ MODEL PERSISTENCE - IMPLEMENTATION ]====================
+
+/**
+ * @brief Magic string di awal file model
+ */
+static const char MODEL_FILE_MAGIC[8] = { 'N', 'N', 'M', 'O', 'D', 'E', 'L', '\0' };
+
+/**
+ * @brief Penanda urutan byte (file hanya valid di mesin dengan endian yang sama)
+ */
+#define MODEL_FILE_ENDIAN_MARKER ((uint32_t)0x01020304u)
+
+/**
+ * @brief Nilai awal dan prime hash FNV-1a 64-bit
+ */
+#define MODEL_CHECKSUM_OFFSET_BASIS ((uint64_t)0xcbf29ce484222325ull)
+#define MODEL_CHECKSUM_PRIME ((uint64_t)0x100000001b3ull)
+
+/**
+ * @brief Header file model (selalu 48 bytes)
+ *
+ * Setelah header: uint64 layer_sizes[total_layers], uint32
+ * activation_types[total_layers], padding nol hingga parameter_offset, lalu
+ * parameter_count float. Checksum mencakup semua byte setelah header.
+ */
+struct ModelFileHeader
+{
+    char magic[8];              // "NNMODEL"
+    uint32_t format_version;    // NEURAL_NETWORK_MODEL_FORMAT_VERSION
+    uint32_t endian_marker;     // MODEL_FILE_ENDIAN_MARKER
+    uint32_t total_layers;      // Jumlah layer
+    uint32_t reserved;          // Selalu 0
+    uint64_t parameter_count;   // Jumlah float di blok parameter (termasuk padding)
+    uint64_t parameter_offset;  // Offset blok parameter dari awal file (kelipatan 64)
+    uint64_t checksum;          // FNV-1a 64 atas semua byte setelah header
+};
+
+/**
+ * @brief Meneruskan hash FNV-1a 64-bit dengan blok data
+ * @param hash Hash sebelumnya
+ * @param data Data yang di-hash
+ * @param size Ukuran data dalam bytes
+ * @return Hash baru
+ */
+static uint64_t
+model_checksum_update(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= MODEL_CHECKSUM_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Menghitung offset blok parameter di file model
+ * @param total_layers Jumlah layer
+ * @return Offset dalam bytes, dibulatkan ke NEURAL_NETWORK_PARAMETER_ALIGNMENT
+ */
+static size_t
+model_parameter_offset(size_t total_layers)
+{
+    size_t metadata_size = sizeof(struct ModelFileHeader)
+                         + total_layers * (sizeof(uint64_t) + sizeof(uint32_t));
+
+    return (metadata_size + NEURAL_NETWORK_PARAMETER_ALIGNMENT - 1) & ~(NEURAL_NETWORK_PARAMETER_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Menulis blok data ke file sambil memperbarui checksum
+ * @param model_file File tujuan
+ * @param data Data yang ditulis
+ * @param size Ukuran data dalam bytes
+ * @param checksum Checksum yang diperbarui
+ * @return true jika seluruh data tertulis
+ */
+static bool
+model_write_block(FILE *model_file, const void *data, size_t size, uint64_t *checksum)
+{
+    *checksum = model_checksum_update(*checksum, data, size);
+    return fwrite(data, 1, size, model_file) == size;
+}
+
+/**
+ * @brief Menyimpan model ke file biner berversi
+ * @param network Neural network yang akan disimpan
+ * @param model_filename Path file tujuan
+ * @return true jika berhasil ditulis
+ */
+bool
+neural_network_save_model(struct NeuralNetwork network, const char *model_filename)
+{
+    assert(network.total_layers >= 2);
+
+    FILE *model_file = fopen(model_filename, "wb");
+    if (model_file == NULL) return false;
+
+    size_t parameter_offset = model_parameter_offset(network.total_layers);
+    size_t parameter_count =
+        neural_network_layout_parameters(network.layer_sizes, network.total_layers, NULL, NULL, NULL);
+
+    struct ModelFileHeader header = {
+        .format_version = NEURAL_NETWORK_MODEL_FORMAT_VERSION,
+        .endian_marker = MODEL_FILE_ENDIAN_MARKER,
+        .total_layers = (uint32_t)network.total_layers,
+        .parameter_count = parameter_count,
+        .parameter_offset = parameter_offset,
+    };
+    memcpy(header.magic, MODEL_FILE_MAGIC, sizeof(header.magic));
+
+    // Header ditulis ulang di akhir setelah checksum diketahui
+    uint64_t checksum = MODEL_CHECKSUM_OFFSET_BASIS;
+    bool is_written = fwrite(&header, sizeof(header), 1, model_file) == 1;
+
+    for (size_t layer_idx = 0; is_written && layer_idx < network.total_layers; ++layer_idx) {
+        uint64_t layer_size = network.layer_sizes[layer_idx];
+        is_written = model_write_block(model_file, &layer_size, sizeof(layer_size), &checksum);
+    }
+
+    for (size_t layer_idx = 0; is_written && layer_idx < network.total_layers; ++layer_idx) {
+        uint32_t activation_type = (uint32_t)network.activation_types[layer_idx];
+        is_written = model_write_block(model_file, &activation_type, sizeof(activation_type), &checksum);
+    }
+
+    static const char zero_padding[NEURAL_NETWORK_PARAMETER_ALIGNMENT] = {0};
+    size_t metadata_size = sizeof(header) + network.total_layers * (sizeof(uint64_t) + sizeof(uint32_t));
+    if (is_written)
+        is_written = model_write_block(model_file, zero_padding, parameter_offset - metadata_size, &checksum);
+
+    // Blok parameter dengan layout neural_network_allocate (padding antar blok bernilai nol)
+    for (size_t layer_idx = 0; is_written && layer_idx < network.total_layers - 1; ++layer_idx) {
+        struct Matrix weights = network.weight_matrices[layer_idx];
+        struct Row biases = network.bias_vectors[layer_idx];
+        size_t weight_count = weights.num_rows * weights.num_columns;
+
+        is_written = model_write_block(model_file, weights.element, sizeof(float) * weight_count, &checksum)
+                  && model_write_block(model_file, zero_padding,
+                                       sizeof(float) * (neural_network_align_parameter_count(weight_count) - weight_count),
+                                       &checksum)
+                  && model_write_block(model_file, biases.element, sizeof(float) * biases.num_columns, &checksum)
+                  && model_write_block(model_file, zero_padding,
+                                       sizeof(float) * (neural_network_align_parameter_count(biases.num_columns)
+                                                        - biases.num_columns),
+                                       &checksum);
+    }
+
+    header.checksum = checksum;
+    if (is_written)
+        is_written = fseek(model_file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, model_file) == 1;
+
+    if (fclose(model_file) != 0) is_written = false;
+
+    return is_written;
+}
+
+/**
+ * @brief Melepas mapping model (network yang dimuat tidak boleh dipakai lagi)
+ * @param mapping Mapping dari neural_network_load_model
+ */
+void
+neural_network_unload_model(struct MappedFile *mapping)
+{
+    mapped_file_close(mapping);
+}
+
+/**
+ * @brief Memuat model dari file biner tanpa menyalin weights
+ * @param arena_ptr Arena untuk layer_sizes, activation_types, dan view
+ * @param model_filename Path file model
+ * @param verify_checksum true untuk memverifikasi checksum (membaca seluruh file)
+ * @param network_output Network hasil load
+ * @param mapping_output Mapping yang harus dilepas dengan neural_network_unload_model
+ * @return true jika file valid dan berhasil dimuat
+ */
+bool
+neural_network_load_model(struct MemoryArena *arena_ptr, const char *model_filename, bool verify_checksum,
+                          struct NeuralNetwork *network_output, struct MappedFile *mapping_output)
+{
+    assert(network_output != NULL && mapping_output != NULL);
+
+    if (!mapped_file_open(model_filename, false, mapping_output)) return false;
+
+    const unsigned char *file_bytes = (const unsigned char *)mapping_output->base_address;
+    size_t file_size = mapping_output->mapped_size;
+    struct ModelFileHeader header;
+
+    bool is_valid = file_size >= sizeof(header);
+    if (is_valid) {
+        memcpy(&header, file_bytes, sizeof(header));
+        is_valid = memcmp(header.magic, MODEL_FILE_MAGIC, sizeof(header.magic)) == 0
+                && header.format_version == NEURAL_NETWORK_MODEL_FORMAT_VERSION
+                && header.endian_marker == MODEL_FILE_ENDIAN_MARKER
+                && header.total_layers >= 2
+                && header.parameter_offset == model_parameter_offset(header.total_layers)
+                && header.parameter_offset <= file_size
+                && header.parameter_count * sizeof(float) == file_size - header.parameter_offset;
+    }
+
+    if (is_valid && verify_checksum) {
+        uint64_t checksum = model_checksum_update(MODEL_CHECKSUM_OFFSET_BASIS, file_bytes + sizeof(header),
+                                                  file_size - sizeof(header));
+        is_valid = checksum == header.checksum;
+    }
+
+    size_t total_layers = is_valid ? header.total_layers : 0;
+    size_t *layer_sizes = NULL;
+    enum ActivationType *activation_types = NULL;
+
+    if (is_valid) {
+        layer_sizes = arena_allocate_memory(arena_ptr, sizeof(*layer_sizes) * total_layers);
+        activation_types = arena_allocate_memory(arena_ptr, sizeof(*activation_types) * total_layers);
+
+        const unsigned char *metadata_cursor = file_bytes + sizeof(header);
+        for (size_t layer_idx = 0; layer_idx < total_layers; ++layer_idx) {
+            uint64_t layer_size;
+            memcpy(&layer_size, metadata_cursor + layer_idx * sizeof(layer_size), sizeof(layer_size));
+            layer_sizes[layer_idx] = (size_t)layer_size;
+            is_valid = is_valid && layer_size > 0;
+        }
+
+        metadata_cursor += total_layers * sizeof(uint64_t);
+        for (size_t layer_idx = 0; layer_idx < total_layers; ++layer_idx) {
+            uint32_t activation_type;
+            memcpy(&activation_type, metadata_cursor + layer_idx * sizeof(activation_type), sizeof(activation_type));
+            activation_types[layer_idx] = (enum ActivationType)activation_type;
+            is_valid = is_valid && activation_type <= ACTIVATION_NONE;
+        }
+
+        // Arsitektur harus menghasilkan layout parameter yang persis sama dengan file
+        is_valid = is_valid && neural_network_layout_parameters(layer_sizes, total_layers, NULL, NULL, NULL)
+                               == header.parameter_count;
+    }
+
+    if (!is_valid) {
+        neural_network_unload_model(mapping_output);
+        return false;
+    }
+
+    // View langsung ke halaman file; tidak ada weights yang disalin
+    float *parameter_buffer = (float *)(file_bytes + header.parameter_offset);
+
+    *network_output = (struct NeuralNetwork) {
+        .layer_sizes = layer_sizes,
+        .total_layers = total_layers,
+        .weight_matrices = arena_allocate_memory(arena_ptr, sizeof(struct Matrix) * (total_layers - 1)),
+        .bias_vectors = arena_allocate_memory(arena_ptr, sizeof(struct Row) * (total_layers - 1)),
+        .activation_types = activation_types,
+        .parameter_buffer = parameter_buffer,
+        .parameter_count = header.parameter_count,
+    };
+
+    neural_network_layout_parameters(layer_sizes, total_layers, parameter_buffer,
+                                     network_output->weight_matrices, network_output->bias_vectors);
+
+    return true;
+}
+
+// ===================[ DATASET OPERATIONS - IMPLEMENTATION ]===================
+
+/**
+ * @brief Ukuran chunk pembacaan file CSV
+ */
+#define CSV_READ_CHUNK_SIZE ((size_t)1 << 20)
+
+/**
+ * @brief Panjang maksimum token angka untuk jalur lambat (strtod)
+ */
+#define CSV_MAX_NUMBER_LENGTH 64
+
+/**
+ * @brief Batas jumlah class untuk label one-hot
+ */
+#define CSV_MAX_CLASS_COUNT ((size_t)1 << 16)
+
+/**
+ * @brief Pangkat sepuluh yang eksak dalam double (jalur cepat parser float)
+ */
+static const double csv_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief Mengambil waktu saat ini dalam detik
+ * @return Waktu dalam detik
+ */
+static double
+dataset_now_seconds(void)
+{
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Mem-parse satu angka desimal dari teks
+ *
+ * Mantissa dan eksponen desimal dikumpulkan sebagai bilangan bulat. Jika
+ * mantissa <= 2^53 dan |eksponen| <= 22, hasilnya satu perkalian/pembagian
+ * double yang eksak sebelum dibulatkan ke float; angka lain (jarang)
+ * diteruskan ke strtod. Teks tidak perlu diakhiri '\0'.
+ *
+ * @param cursor Awal angka
+ * @param end Batas akhir teks
+ * @param value_output Nilai hasil parse
+ * @return Pointer setelah angka, atau NULL jika bukan angka
+ */
+static const char *
+csv_parse_float(const char *cursor, const char *end, float *value_output)
+{
+    const char *number_begin = cursor;
+    bool is_negative = false;
+
+    if (cursor < end && (*cursor == '-' || *cursor == '+')) {
+        is_negative = *cursor == '-';
+        ++cursor;
+    }
+
+    uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int decimal_exponent = 0;
+    bool has_digits = false;
+    bool is_truncated = false;
+
+    for (; cursor < end && (unsigned)(*cursor - '0') < 10; ++cursor) {
+        has_digits = true;
+        if (significant_digits < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*cursor - '0');
+            significant_digits += mantissa != 0;
+        } else {
+            ++decimal_exponent;
+            is_truncated = true;
+        }
+    }
+
+    if (cursor < end && *cursor == '.') {
+        for (++cursor; cursor < end && (unsigned)(*cursor - '0') < 10; ++cursor) {
+            has_digits = true;
+            if (significant_digits < 19) {
+                mantissa = mantissa * 10 + (uint64_t)(*cursor - '0');
+                significant_digits += mantissa != 0;
+                --decimal_exponent;
+            } else {
+                is_truncated = true;
+            }
+        }
+    }
+
+    if (!has_digits) return NULL;
+
+    if (cursor < end && (*cursor == 'e' || *cursor == 'E')) {
+        const char *exponent_cursor = cursor + 1;
+        bool is_exponent_negative = false;
+
+        if (exponent_cursor < end && (*exponent_cursor == '-' || *exponent_cursor == '+')) {
+            is_exponent_negative = *exponent_cursor == '-';
+            ++exponent_cursor;
+        }
+
+        if (exponent_cursor < end && (unsigned)(*exponent_cursor - '0') < 10) {
+            int exponent_value = 0;
+            for (; exponent_cursor < end && (unsigned)(*exponent_cursor - '0') < 10; ++exponent_cursor) {
+                if (exponent_value < 10000) exponent_value = exponent_value * 10 + (*exponent_cursor - '0');
+            }
+            decimal_exponent += is_exponent_negative ? -exponent_value : exponent_value;
+            cursor = exponent_cursor;
+        }
+    }
+
+    double value;
+    if (!is_truncated && mantissa <= ((uint64_t)1 << 53) && decimal_exponent >= -22 && decimal_exponent <= 22) {
+        value = decimal_exponent < 0 ? (double)mantissa / csv_powers_of_ten[-decimal_exponent]
+                                     : (double)mantissa * csv_powers_of_ten[decimal_exponent];
+        if (is_negative) value = -value;
+    } else {
+        char number_text[CSV_MAX_NUMBER_LENGTH];
+        size_t number_length = (size_t)(cursor - number_begin);
+
+        if (number_length >= sizeof(number_text)) return NULL;
+
+        memcpy(number_text, number_begin, number_length);
+        number_text[number_length] = '\0';
+        value = strtod(number_text, NULL);
+    }
+
+    *value_output = (float)value;
+    return cursor;
+}
+
+/**
+ * @brief Mem-parse satu baris CSV yang harus berisi tepat column_count angka
+ * @param cursor Awal baris
+ * @param line_end Akhir baris (tanpa newline)
+ * @param row_values Tujuan nilai (NULL untuk validasi saja)
+ * @param column_count Jumlah kolom yang diharapkan
+ * @return true jika baris valid
+ */
+static bool
+csv_parse_line(const char *cursor, const char *line_end, float *row_values, size_t column_count)
+{
+    for (size_t column_idx = 0; column_idx < column_count; ++column_idx) {
+        float value;
+
+        while (cursor < line_end && (*cursor == ' ' || *cursor == '\t')) ++cursor;
+
+        cursor = csv_parse_float(cursor, line_end, &value);
+        if (cursor == NULL) return false;
+        if (row_values != NULL) row_values[column_idx] = value;
+
+        while (cursor < line_end && (*cursor == ' ' || *cursor == '\t')) ++cursor;
+
+        if (column_idx + 1 < column_count) {
+            if (cursor >= line_end || *cursor != ',') return false;
+            ++cursor;
+        }
+    }
+
+    return cursor == line_end;
+}
+
+/**
+ * @brief Menghitung jumlah field di satu baris CSV
+ * @param cursor Awal baris
+ * @param line_end Akhir baris
+ * @return Jumlah field (jumlah koma + 1)
+ */
+static size_t
+csv_count_fields(const char *cursor, const char *line_end)
+{
+    size_t field_count = 1;
+    for (; cursor < line_end; ++cursor) field_count += *cursor == ',';
+    return field_count;
+}
+
+/**
+ * @brief Menentukan jumlah kolom dari baris yang seluruhnya numerik
+ * @param line Awal baris
+ * @param line_end Akhir baris
+ * @return Jumlah kolom, atau 0 jika baris bukan baris data (misalnya header)
+ */
+static size_t
+csv_detect_column_count(const char *line, const char *line_end)
+{
+    size_t field_count = csv_count_fields(line, line_end);
+    return csv_parse_line(line, line_end, NULL, field_count) ? field_count : 0;
+}
+
+/**
+ * @brief Mengecek apakah baris hanya berisi whitespace
+ * @param cursor Awal baris
+ * @param line_end Akhir baris
+ * @return true jika baris kosong
+ */
+static bool
+csv_line_is_blank(const char *cursor, const char *line_end)
+{
+    for (; cursor < line_end; ++cursor) {
+        if (*cursor != ' ' && *cursor != '\t') return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Mengubah nilai label menjadi indeks class
+ * @param label_value Nilai label dari CSV
+ * @param class_output Indeks class
+ * @return true jika label bilangan bulat dalam [0, CSV_MAX_CLASS_COUNT)
+ */
+static bool
+csv_label_to_class(float label_value, size_t *class_output)
+{
+    if (!(label_value >= 0.0f && label_value < (float)CSV_MAX_CLASS_COUNT) || label_value != floorf(label_value))
+        return false;
+
+    *class_output = (size_t)label_value;
+    return true;
+}
+
+/**
+ * @brief Mengubah label di kolom label_column menjadi kolom one-hot
+ * @param row_values Baris dengan minimal label_column + class_count kolom
+ * @param label_column Indeks kolom label
+ * @param class_count Jumlah class
+ * @return true jika label valid dan lebih kecil dari class_count
+ */
+static bool
+csv_encode_one_hot(float *row_values, size_t label_column, size_t class_count)
+{
+    size_t class_idx;
+    if (!csv_label_to_class(row_values[label_column], &class_idx) || class_idx >= class_count) return false;
+
+    memset(row_values + label_column, 0, sizeof(*row_values) * class_count);
+    row_values[label_column + class_idx] = 1.0f;
+    return true;
+}
+
+/**
+ * @brief Membaca label (field terakhir) dari satu baris CSV
+ * @param line_begin Awal baris
+ * @param line_end Akhir baris
+ * @param class_output Indeks class
+ * @return true jika label valid
+ */
+static bool
+csv_parse_last_field_class(const char *line_begin, const char *line_end, size_t *class_output)
+{
+    const char *field_begin = line_end;
+    while (field_begin > line_begin && field_begin[-1] != ',') --field_begin;
+    while (field_begin < line_end && (*field_begin == ' ' || *field_begin == '\t')) ++field_begin;
+
+    float label_value;
+    const char *field_end = csv_parse_float(field_begin, line_end, &label_value);
+    if (field_end == NULL) return false;
+    while (field_end < line_end && (*field_end == ' ' || *field_end == '\t')) ++field_end;
+
+    return field_end == line_end && csv_label_to_class(label_value, class_output);
+}
+
+/**
+ * @brief Pembaca file CSV per chunk yang selalu berhenti di batas baris
+ */
+struct CsvChunkReader
+{
+    FILE *csv_file;         // File yang dibaca
+    char *buffer;           // Buffer chunk (diperbesar jika ada baris yang sangat panjang)
+    size_t capacity;        // Kapasitas buffer
+    size_t filled;          // Jumlah byte valid di buffer
+    size_t consumed;        // Jumlah byte yang sudah dikembalikan sebagai blok
+    size_t total_bytes;     // Total byte yang sudah dibaca dari file
+    bool is_end_of_file;    // true jika file sudah habis dibaca
+};
+
+/**
+ * @brief Mengambil blok berikutnya yang berisi baris-baris utuh
+ * @param reader Pembaca CSV
+ * @param block_begin Awal blok
+ * @param block_end Akhir blok (setelah newline terakhir, atau akhir file)
+ * @return false jika tidak ada data lagi
+ */
+static bool
+csv_reader_next_block(struct CsvChunkReader *reader, const char **block_begin, const char **block_end)
+{
+    // Baris yang terpotong di akhir chunk sebelumnya dipindah ke awal buffer
+    size_t remaining_bytes = reader->filled - reader->consumed;
+    memmove(reader->buffer, reader->buffer + reader->consumed, remaining_bytes);
+    reader->filled = remaining_bytes;
+    reader->consumed = 0;
+
+    for (;;) {
+        if (!reader->is_end_of_file) {
+            if (reader->capacity - reader->filled < CSV_READ_CHUNK_SIZE / 2) {
+                reader->capacity *= 2;
+                reader->buffer = (char *)realloc(reader->buffer, reader->capacity);
+                assert(reader->buffer != NULL);
+            }
+
+            size_t requested_bytes = reader->capacity - reader->filled;
+            size_t read_bytes = fread(reader->buffer + reader->filled, 1, requested_bytes, reader->csv_file);
+            reader->filled += read_bytes;
+            reader->total_bytes += read_bytes;
+            reader->is_end_of_file = read_bytes < requested_bytes;
+        }
+
+        if (reader->filled == 0) return false;
+
+        size_t block_size = reader->filled;
+        while (block_size > 0 && reader->buffer[block_size - 1] != '\n') --block_size;
+
+        // Tanpa newline: baris lebih panjang dari buffer (baca lagi) atau baris terakhir file
+        if (block_size == 0) {
+            if (!reader->is_end_of_file) continue;
+            block_size = reader->filled;
+        }
+
+        *block_begin = reader->buffer;
+        *block_end = reader->buffer + block_size;
+        reader->consumed = block_size;
+        return true;
+    }
+}
+
+/**
+ * @brief Memulai pembacaan file dari awal
+ * @param reader Pembaca CSV
+ */
+static void
+csv_reader_rewind(struct CsvChunkReader *reader)
+{
+    rewind(reader->csv_file);
+    reader->filled = 0;
+    reader->consumed = 0;
+    reader->total_bytes = 0;
+    reader->is_end_of_file = false;
+}
+
+/**
+ * @brief Mengambil baris berikutnya dari blok
+ * @param cursor Posisi di blok (diperbarui ke awal baris berikutnya)
+ * @param block_end Akhir blok
+ * @param line_end Akhir baris tanpa "\n" / "\r\n"
+ * @return Awal baris
+ */
+static const char *
+csv_next_line(const char **cursor, const char *block_end, const char **line_end)
+{
+    const char *line_begin = *cursor;
+    const char *newline = (const char *)memchr(line_begin, '\n', (size_t)(block_end - line_begin));
+    const char *content_end = newline != NULL ? newline : block_end;
+
+    *cursor = newline != NULL ? newline + 1 : block_end;
+    if (content_end > line_begin && content_end[-1] == '\r') --content_end;
+
+    *line_end = content_end;
+    return line_begin;
+}
+
+/**
+ * @brief Memuat file CSV numerik dengan jumlah baris dan kolom sembarang
+ * @param arena_ptr Arena untuk alokasi memori (NULL untuk malloc)
+ * @param csv_filename Nama file CSV
+ * @param skip_header_lines Jumlah baris yang akan dilewati (biasanya header)
+ * @param one_hot_last_column true untuk mengubah kolom terakhir (label) ke one-hot
+ * @param statistics_output Statistik pemuatan (boleh NULL)
+ * @return Matrix berisi data dari CSV
+ */
+struct Matrix
+dataset_load_csv_matrix(struct MemoryArena *arena_ptr, const char *csv_filename, size_t skip_header_lines,
+                        bool one_hot_last_column, struct CsvLoadStatistics *statistics_output)
+{
+    double start_time = dataset_now_seconds();
+
+    struct CsvChunkReader reader = {
+        .csv_file = fopen(csv_filename, "rb"),
+        .buffer = (char *)malloc(CSV_READ_CHUNK_SIZE),
+        .capacity = CSV_READ_CHUNK_SIZE,
+    };
+    assert(reader.csv_file && "Gagal membuka file CSV");
+    assert(reader.buffer != NULL);
+
+    // Pass 1: jumlah kolom (dari baris numerik pertama), batas atas jumlah baris, dan jumlah class
+    size_t column_count = 0;
+    size_t candidate_row_count = 0;
+    size_t class_count = 0;
+    size_t header_lines_left = skip_header_lines;
+    const char *block_begin, *block_end;
+
+    while (csv_reader_next_block(&reader, &block_begin, &block_end)) {
+        for (const char *cursor = block_begin; cursor < block_end;) {
+            const char *line_end;
+            const char *line = csv_next_line(&cursor, block_end, &line_end);
+
+            if (header_lines_left > 0) {
+                --header_lines_left;
+                continue;
+            }
+            if (csv_line_is_blank(line, line_end)) continue;
+
+            if (column_count == 0) {
+                column_count = csv_detect_column_count(line, line_end);
+                if (column_count == 0) continue;
+            }
+
+            ++candidate_row_count;
+
+            size_t class_idx;
+            if (one_hot_last_column && csv_parse_last_field_class(line, line_end, &class_idx) && class_idx >= class_count)
+                class_count = class_idx + 1;
+        }
+    }
+
+    assert(!one_hot_last_column || column_count != 1);
+
+    size_t output_column_count = one_hot_last_column && column_count > 0 ? column_count - 1 + class_count
+                                                                         : column_count;
+    struct Matrix dataset = {0};
+    if (candidate_row_count > 0 && output_column_count > 0)
+        dataset = matrix_allocate(arena_ptr, candidate_row_count, output_column_count);
+
+    // Pass 2: parse angka langsung ke baris matrix
+    size_t row_count = 0;
+    size_t skipped_row_count = 0;
+    header_lines_left = skip_header_lines;
+    csv_reader_rewind(&reader);
+
+    while (dataset.element != NULL && csv_reader_next_block(&reader, &block_begin, &block_end)) {
+        for (const char *cursor = block_begin; cursor < block_end;) {
+            const char *line_end;
+            const char *line = csv_next_line(&cursor, block_end, &line_end);
+
+            if (header_lines_left > 0) {
+                --header_lines_left;
+                continue;
+            }
+            if (csv_line_is_blank(line, line_end)) continue;
+
+            float *row_values = matrix_get_row(dataset, row_count).element;
+            bool is_valid = row_count < candidate_row_count && csv_parse_line(line, line_end, row_values, column_count);
+
+            if (is_valid && one_hot_last_column)
+                is_valid = csv_encode_one_hot(row_values, column_count - 1, class_count);
+
+            if (is_valid) ++row_count;
+            else ++skipped_row_count;
+        }
+    }
+
+    if (statistics_output != NULL) {
+        *statistics_output = (struct CsvLoadStatistics) {
+            .row_count = row_count,
+            .column_count = column_count,
+            .skipped_row_count = skipped_row_count,
+            .file_bytes = reader.total_bytes,
+            .elapsed_seconds = dataset_now_seconds() - start_time,
+        };
+    }
+
+    fclose(reader.csv_file);
+    free(reader.buffer);
+
+    dataset.num_rows = row_count;
+    return dataset;
+}
+
+/**
+ * @brief Ukuran minimum chunk per thread pada pemuatan CSV paralel
+ */
+#define CSV_PARALLEL_MIN_CHUNK_SIZE ((size_t)1 << 20)
+
+/**
+ * @brief Satu chunk file CSV beserta buffer baris thread-local hasil parse
+ */
+struct CsvChunkRows
+{
+    const char *chunk_begin;    // Awal chunk (awal baris)
+    const char *chunk_end;      // Akhir chunk (setelah newline)
+    float *row_values;          // Baris valid, masing-masing column_count float
+    size_t row_capacity;        // Kapasitas row_values dalam baris
+    size_t row_count;           // Jumlah baris valid
+    size_t skipped_row_count;   // Jumlah baris tidak valid
+    size_t class_count;         // Label terbesar + 1 (one-hot)
+    size_t row_offset;          // Baris pertama chunk di matrix hasil (prefix sum)
+};
+
+/**
+ * @brief Mem-parse semua baris satu chunk ke buffer thread-local
+ * @param chunk Chunk yang diparse
+ * @param column_count Jumlah kolom setiap baris
+ * @param one_hot_last_column true jika kolom terakhir adalah label class
+ */
+static void
+csv_parse_chunk(struct CsvChunkRows *chunk, size_t column_count, bool one_hot_last_column)
+{
+    for (const char *cursor = chunk->chunk_begin; cursor < chunk->chunk_end;) {
+        const char *line_end;
+        const char *line = csv_next_line(&cursor, chunk->chunk_end, &line_end);
+
+        if (csv_line_is_blank(line, line_end)) continue;
+
+        if (chunk->row_count == chunk->row_capacity) {
+            chunk->row_capacity = chunk->row_capacity > 0 ? 2 * chunk->row_capacity : 1024;
+            chunk->row_values = (float *)realloc(chunk->row_values,
+                                                 sizeof(*chunk->row_values) * chunk->row_capacity * column_count);
+            assert(chunk->row_values != NULL);
+        }
+
+        float *row_values = chunk->row_values + chunk->row_count * column_count;
+        bool is_valid = csv_parse_line(line, line_end, row_values, column_count);
+
+        // Label divalidasi di sini agar fase penggabungan tidak perlu membuang baris
+        size_t class_idx;
+        if (is_valid && one_hot_last_column) {
+            is_valid = csv_label_to_class(row_values[column_count - 1], &class_idx);
+            if (is_valid && class_idx >= chunk->class_count) chunk->class_count = class_idx + 1;
+        }
+
+        if (is_valid) ++chunk->row_count;
+        else ++chunk->skipped_row_count;
+    }
+}
+
+/**
+ * @brief Memuat file CSV numerik secara paralel dari file yang di-mmap
+ * @param arena_ptr Arena untuk alokasi memori (NULL untuk malloc)
+ * @param csv_filename Nama file CSV
+ * @param skip_header_lines Jumlah baris yang akan dilewati (biasanya header)
+ * @param one_hot_last_column true untuk mengubah kolom terakhir (label) ke one-hot
+ * @param statistics_output Statistik pemuatan (boleh NULL)
+ * @return Matrix berisi data dari CSV
+ */
+struct Matrix
+dataset_load_csv_matrix_parallel(struct MemoryArena *arena_ptr, const char *csv_filename, size_t skip_header_lines,
+                                 bool one_hot_last_column, struct CsvLoadStatistics *statistics_output)
+{
+    double start_time = dataset_now_seconds();
+
+    struct MappedFile csv_mapping;
+    bool is_mapped = mapped_file_open(csv_filename, false, &csv_mapping);
+    assert(is_mapped && "Gagal membuka file CSV");
+    (void)is_mapped;
+
+    const char *file_begin = (const char *)csv_mapping.base_address;
+    const char *file_end = file_begin + csv_mapping.mapped_size;
+    const char *data_begin = file_begin;
+    const char *line_end;
+
+    for (size_t line_idx = 0; line_idx < skip_header_lines && data_begin < file_end; ++line_idx)
+        csv_next_line(&data_begin, file_end, &line_end);
+
+    // Jumlah kolom dari baris numerik pertama (dibaca sekuensial, hanya beberapa baris)
+    size_t column_count = 0;
+    for (const char *cursor = data_begin; cursor < file_end && column_count == 0;) {
+        const char *line = csv_next_line(&cursor, file_end, &line_end);
+        if (!csv_line_is_blank(line, line_end)) column_count = csv_detect_column_count(line, line_end);
+    }
+
+    assert(!one_hot_last_column || column_count != 1);
+
+    size_t data_bytes = (size_t)(file_end - data_begin);
+    size_t chunk_count = 1;
+#if defined(_OPENMP)
+    chunk_count = (size_t)omp_get_max_threads();
+#endif
+    if (chunk_count > data_bytes / CSV_PARALLEL_MIN_CHUNK_SIZE) chunk_count = data_bytes / CSV_PARALLEL_MIN_CHUNK_SIZE;
+    if (chunk_count == 0 || column_count == 0) chunk_count = 1;
+
+    struct CsvChunkRows *chunks = (struct CsvChunkRows *)calloc(chunk_count, sizeof(*chunks));
+    assert(chunks != NULL);
+
+    // Batas chunk digeser ke awal baris berikutnya
+    const char *chunk_begin = data_begin;
+    for (size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx) {
+        const char *chunk_end = data_begin + data_bytes / chunk_count * (chunk_idx + 1);
+
+        if (chunk_idx + 1 == chunk_count || column_count == 0) {
+            chunk_end = file_end;
+        } else {
+            if (chunk_end < chunk_begin) chunk_end = chunk_begin;
+            if (chunk_end > data_begin && chunk_end[-1] != '\n') {
+                const char *newline = (const char *)memchr(chunk_end, '\n', (size_t)(file_end - chunk_end));
+                chunk_end = newline != NULL ? newline + 1 : file_end;
+            }
+        }
+
+        chunks[chunk_idx].chunk_begin = chunk_begin;
+        chunks[chunk_idx].chunk_end = column_count > 0 ? chunk_end : chunk_begin;
+        chunk_begin = chunk_end;
+    }
+
+    #pragma omp parallel for schedule(static, 1) if (chunk_count > 1)
+    for (long chunk_idx = 0; chunk_idx < (long)chunk_count; ++chunk_idx)
+        csv_parse_chunk(&chunks[chunk_idx], column_count, one_hot_last_column);
+
+    // Prefix sum jumlah baris menentukan posisi setiap chunk di matrix hasil
+    size_t row_count = 0;
+    size_t skipped_row_count = 0;
+    size_t class_count = 0;
+    for (size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx) {
+        chunks[chunk_idx].row_offset = row_count;
+        row_count += chunks[chunk_idx].row_count;
+        skipped_row_count += chunks[chunk_idx].skipped_row_count;
+        if (chunks[chunk_idx].class_count > class_count) class_count = chunks[chunk_idx].class_count;
+    }
+
+    size_t output_column_count = one_hot_last_column && column_count > 0 ? column_count - 1 + class_count
+                                                                         : column_count;
+    struct Matrix dataset = {0};
+    if (row_count > 0)
+        dataset = matrix_allocate(arena_ptr, row_count, output_column_count);
+
+    #pragma omp parallel for schedule(static, 1) if (chunk_count > 1)
+    for (long chunk_idx = 0; chunk_idx < (long)chunk_count; ++chunk_idx) {
+        struct CsvChunkRows chunk = chunks[chunk_idx];
+
+        if (!one_hot_last_column && chunk.row_count > 0) {
+            memcpy(&matrix_at(dataset, chunk.row_offset, 0), chunk.row_values,
+                   sizeof(*chunk.row_values) * chunk.row_count * column_count);
+        } else {
+            for (size_t row_idx = 0; row_idx < chunk.row_count; ++row_idx) {
+                float *row_values = matrix_get_row(dataset, chunk.row_offset + row_idx).element;
+                memcpy(row_values, chunk.row_values + row_idx * column_count, sizeof(*row_values) * column_count);
+                csv_encode_one_hot(row_values, column_count - 1, class_count);
+            }
+        }
+
+        free(chunk.row_values);
+    }
+
+    if (statistics_output != NULL) {
+        *statistics_output = (struct CsvLoadStatistics) {
+            .row_count = row_count,
+            .column_count = column_count,
+            .skipped_row_count = skipped_row_count,
+            .file_bytes = csv_mapping.mapped_size,
+            .elapsed_seconds = dataset_now_seconds() - start_time,
+        };
+    }
+
+    free(chunks);
+    mapped_file_close(&csv_mapping);
+
+    return dataset;
+}
+
+/**
+ * @brief Memuat dataset klasifikasi dari file CSV
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param csv_filename Nama file CSV yang akan dimuat
+ * @param skip_header_lines Jumlah baris header yang akan dilewati
+ * @return Matrix berisi fitur diikuti kolom one-hot
+ */
+struct Matrix
+dataset_load_from_csv(struct MemoryArena *arena_ptr, const char *csv_filename, size_t skip_header_lines)
+{
+    struct CsvLoadStatistics statistics;
+    struct Matrix dataset = dataset_load_csv_matrix(arena_ptr, csv_filename, skip_header_lines, true, &statistics);
+
+    if (statistics.skipped_row_count > 0) {
+        fprintf(stderr, "Peringatan: %zu baris tidak valid di %s dilewati\n",
+                statistics.skipped_row_count, csv_filename);
+    }
+
+    return dataset;
+}
+
+/**
+ * @brief Magic string di awal file dataset biner
+ */
+static const char DATASET_FILE_MAGIC[8] = { 'N', 'N', 'D', 'A', 'T', 'A', '\0', '\0' };
+
+/**
+ * @brief Header file dataset biner (selalu 56 bytes)
+ *
+ * Setelah header: float column_min_values[normalization_column_count], float
+ * column_max_values[normalization_column_count], padding nol hingga
+ * data_offset, lalu row_count baris float32 (input diikuti output).
+ */
+struct DatasetFileHeader
+{
+    char magic[8];                          // "NNDATA"
+    uint32_t format_version;                // DATASET_BINARY_FORMAT_VERSION
+    uint32_t endian_marker;                 // MODEL_FILE_ENDIAN_MARKER
+    uint64_t row_count;                     // Jumlah baris
+    uint32_t input_column_count;            // Jumlah kolom input
+    uint32_t output_column_count;           // Jumlah kolom output
+    uint32_t normalization_column_count;    // Jumlah kolom yang dinormalisasi (0 jika tidak ada)
+    float normalization_new_min_value;      // Nilai minimum setelah normalisasi
+    float normalization_new_max_value;      // Nilai maksimum setelah normalisasi
+    uint32_t reserved;                      // Selalu 0
+    uint64_t data_offset;                   // Offset baris pertama dari awal file (kelipatan 64)
+};
+
+/**
+ * @brief Menghitung offset data di file dataset biner
+ * @param normalization_column_count Jumlah kolom yang dinormalisasi
+ * @return Offset dalam bytes, dibulatkan ke 64 byte
+ */
+static size_t
+dataset_binary_data_offset(size_t normalization_column_count)
+{
+    size_t metadata_size = sizeof(struct DatasetFileHeader) + 2 * sizeof(float) * normalization_column_count;
+    return (metadata_size + NEURAL_NETWORK_PARAMETER_ALIGNMENT - 1) & ~(NEURAL_NETWORK_PARAMETER_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Memvalidasi header file dataset biner terhadap ukuran file
+ * @param header Header yang dibaca dari file
+ * @param file_size Ukuran file dalam bytes
+ * @return true jika header valid
+ */
+static bool
+dataset_binary_header_is_valid(const struct DatasetFileHeader *header, size_t file_size)
+{
+    size_t row_bytes = sizeof(float) * ((size_t)header->input_column_count + header->output_column_count);
+
+    return memcmp(header->magic, DATASET_FILE_MAGIC, sizeof(header->magic)) == 0
+        && header->format_version == DATASET_BINARY_FORMAT_VERSION
+        && header->endian_marker == MODEL_FILE_ENDIAN_MARKER
+        && header->normalization_column_count <= header->input_column_count
+        && header->data_offset == dataset_binary_data_offset(header->normalization_column_count)
+        && header->data_offset <= file_size
+        && row_bytes > 0
+        && header->row_count == (file_size - header->data_offset) / row_bytes
+        && (file_size - header->data_offset) % row_bytes == 0;
+}
+
+/**
+ * @brief Menyimpan dataset yang sudah diproses ke file biner
+ * @param dataset Dataset (input diikuti output)
+ * @param input_column_count Jumlah kolom input
+ * @param normalization Normalisasi yang sudah diterapkan (column_count 0 jika tidak ada)
+ * @param dataset_filename Path file tujuan
+ * @return true jika berhasil ditulis
+ */
+bool
+dataset_save_binary(struct Matrix dataset, size_t input_column_count, struct NormalizationParameters normalization,
+                    const char *dataset_filename)
+{
+    assert(input_column_count <= dataset.num_columns);
+    assert(normalization.column_count <= input_column_count);
+
+    FILE *dataset_file = fopen(dataset_filename, "wb");
+    if (dataset_file == NULL) return false;
+
+    size_t data_offset = dataset_binary_data_offset(normalization.column_count);
+    struct DatasetFileHeader header = {
+        .format_version = DATASET_BINARY_FORMAT_VERSION,
+        .endian_marker = MODEL_FILE_ENDIAN_MARKER,
+        .row_count = dataset.num_rows,
+        .input_column_count = (uint32_t)input_column_count,
+        .output_column_count = (uint32_t)(dataset.num_columns - input_column_count),
+        .normalization_column_count = (uint32_t)normalization.column_count,
+        .normalization_new_min_value = normalization.new_min_value,
+        .normalization_new_max_value = normalization.new_max_value,
+        .data_offset = data_offset,
+    };
+    memcpy(header.magic, DATASET_FILE_MAGIC, sizeof(header.magic));
+
+    static const char zero_padding[NEURAL_NETWORK_PARAMETER_ALIGNMENT] = {0};
+    size_t metadata_size = sizeof(header) + 2 * sizeof(float) * normalization.column_count;
+    size_t element_count = dataset.num_rows * dataset.num_columns;
+
+    bool is_written =
+        fwrite(&header, sizeof(header), 1, dataset_file) == 1
+        && fwrite(normalization.column_min_values, sizeof(float), normalization.column_count, dataset_file)
+               == normalization.column_count
+        && fwrite(normalization.column_max_values, sizeof(float), normalization.column_count, dataset_file)
+               == normalization.column_count
+        && fwrite(zero_padding, 1, data_offset - metadata_size, dataset_file) == data_offset - metadata_size
+        && fwrite(dataset.element, sizeof(float), element_count, dataset_file) == element_count;
+
+    if (fclose(dataset_file) != 0) is_written = false;
+
+    return is_written;
+}
+
+/**
+ * @brief Memuat dataset biner dengan mmap tanpa menyalin data
+ * @param dataset_filename Path file dataset
+ * @param dataset_output Dataset hasil load
+ * @return true jika file valid dan berhasil dimuat
+ */
+bool
+dataset_load_binary(const char *dataset_filename, struct BinaryDataset *dataset_output)
+{
+    assert(dataset_output != NULL);
+
+    struct MappedFile mapping;
+    if (!mapped_file_open(dataset_filename, true, &mapping)) return false;
+
+    unsigned char *file_bytes = (unsigned char *)mapping.base_address;
+    size_t file_size = mapping.mapped_size;
+    struct DatasetFileHeader header;
+
+    bool is_valid = file_size >= sizeof(header);
+    if (is_valid) {
+        memcpy(&header, file_bytes, sizeof(header));
+        is_valid = dataset_binary_header_is_valid(&header, file_size);
+    }
+
+    if (!is_valid) {
+        mapped_file_close(&mapping);
+        return false;
+    }
+
+    // Semua pointer menunjuk ke mapping; tidak ada data yang disalin
+    float *normalization_values = (float *)(file_bytes + sizeof(header));
+
+    *dataset_output = (struct BinaryDataset) {
+        .data = {
+            .num_rows = header.row_count,
+            .num_columns = (size_t)header.input_column_count + header.output_column_count,
+            .element = (float *)(file_bytes + header.data_offset),
+        },
+        .input_column_count = header.input_column_count,
+        .output_column_count = header.output_column_count,
+        .normalization = {
+            .column_count = header.normalization_column_count,
+            .column_min_values = normalization_values,
+            .column_max_values = normalization_values + header.normalization_column_count,
+            .new_min_value = header.normalization_new_min_value,
+            .new_max_value = header.normalization_new_max_value,
+        },
+        .mapping = mapping,
+    };
+
+    return true;
+}
+
+/**
+ * @brief Melepas dataset biner (data tidak boleh dipakai lagi)
+ * @param dataset Dataset dari dataset_load_binary
+ */
+void
+dataset_unload_binary(struct BinaryDataset *dataset)
+{
+    assert(dataset != NULL);
+
+    mapped_file_close(&dataset->mapping);
+    *dataset = (struct BinaryDataset) {0};
+}
+
+/**
+ * @brief Stream dataset biner dengan thread loader yang mengisi buffer chunk di depan
+ *
+ * Ring buffer berisi chunk_buffer_count slot. Consumer memegang paling banyak
+ * satu slot (chunk yang sedang dilatih); slot lain diisi loader. Slot dengan
+ * 0 baris menandai akhir epoch.
+ */
+struct DatasetStream
+{
+    FILE *dataset_file;             // File dataset biner
+    size_t data_offset;             // Offset baris pertama di file
+    size_t row_count;               // Jumlah baris di file
+    size_t input_column_count;      // Jumlah kolom input
+    size_t column_count;            // Jumlah kolom setiap baris
+    size_t file_rows_remaining;     // Baris epoch ini yang belum dibaca dari file
+
+    size_t chunk_rows;              // Kapasitas satu chunk dalam baris
+    size_t chunk_buffer_count;      // Jumlah slot ring buffer
+    float *chunk_buffers;           // chunk_buffer_count * chunk_rows * column_count float
+    size_t *chunk_row_counts;       // Jumlah baris setiap slot (0 = akhir epoch)
+    size_t produce_idx;             // Slot berikutnya yang diisi loader
+    size_t consume_idx;             // Slot berikutnya (atau yang sedang dipegang) consumer
+    size_t filled_count;            // Slot terisi yang belum diambil consumer
+    bool is_chunk_held;             // true jika consumer sedang memegang slot consume_idx
+
+    float *read_rows;               // Buffer baca file (chunk_rows baris)
+    size_t read_count;              // Jumlah baris valid di read_rows
+    size_t read_position;           // Baris berikutnya yang diambil dari read_rows
+    float *shuffle_rows;            // Shuffle buffer (0 baris jika tanpa shuffle)
+    size_t shuffle_capacity;        // Kapasitas shuffle buffer dalam baris
+    size_t shuffle_count;           // Jumlah baris di shuffle buffer
+    struct RandomStream random_stream; // Stream random untuk shuffle
+
+#if defined(NN_USE_PTHREADS)
+    pthread_t loader_thread;        // Thread yang membaca dan mengacak chunk berikutnya
+    pthread_mutex_t mutex;          // Melindungi state ring buffer
+    pthread_cond_t chunk_ready;     // Sinyal ada slot terisi
+    pthread_cond_t slot_free;       // Sinyal ada slot kosong
+    bool is_stopping;               // true saat stream ditutup
+#endif
+};
+
+/**
+ * @brief Membaca blok baris berikutnya dari file ke buffer
+ * @param stream Stream dataset
+ * @param destination Buffer tujuan
+ * @param max_rows Jumlah baris maksimum
+ * @return Jumlah baris yang dibaca (0 di akhir epoch)
+ */
+static size_t
+dataset_stream_read_rows(struct DatasetStream *stream, float *destination, size_t max_rows)
+{
+    size_t requested_rows = max_rows < stream->file_rows_remaining ? max_rows : stream->file_rows_remaining;
+    size_t read_rows = fread(destination, sizeof(float) * stream->column_count, requested_rows, stream->dataset_file);
+
+    // Baca yang gagal diperlakukan sebagai akhir data epoch ini
+    stream->file_rows_remaining = read_rows == requested_rows ? stream->file_rows_remaining - read_rows : 0;
+    return read_rows;
+}
+
+/**
+ * @brief Mengisi satu chunk dengan baris berikutnya (teracak lewat shuffle buffer)
+ *
+ * Shuffle buffer berukuran tetap: setiap baris keluar dipilih acak dari
+ * buffer lalu digantikan baris berikutnya dari file, sehingga memori tetap
+ * terbatas berapa pun ukuran dataset.
+ *
+ * @param stream Stream dataset
+ * @param chunk_values Buffer chunk tujuan
+ * @return Jumlah baris di chunk (0 jika epoch selesai)
+ */
+static size_t
+dataset_stream_fill_chunk(struct DatasetStream *stream, float *chunk_values)
+{
+    size_t column_count = stream->column_count;
+
+    if (stream->shuffle_capacity == 0)
+        return dataset_stream_read_rows(stream, chunk_values, stream->chunk_rows);
+
+    size_t chunk_row_count = 0;
+    while (chunk_row_count < stream->chunk_rows) {
+        // Isi shuffle buffer sampai penuh dari buffer baca
+        while (stream->shuffle_count < stream->shuffle_capacity) {
+            if (stream->read_position == stream->read_count) {
+                stream->read_count = dataset_stream_read_rows(stream, stream->read_rows, stream->chunk_rows);
+                stream->read_position = 0;
+                if (stream->read_count == 0) break;
+            }
+
+            size_t copy_rows = stream->read_count - stream->read_position;
+            if (copy_rows > stream->shuffle_capacity - stream->shuffle_count)
+                copy_rows = stream->shuffle_capacity - stream->shuffle_count;
+
+            memcpy(stream->shuffle_rows + stream->shuffle_count * column_count,
+                   stream->read_rows + stream->read_position * column_count,
+                   sizeof(float) * copy_rows * column_count);
+            stream->shuffle_count += copy_rows;
+            stream->read_position += copy_rows;
+        }
+
+        if (stream->shuffle_count == 0) break;
+
+        // Ambil baris acak, isi lubangnya dengan baris terakhir buffer
+        size_t picked_idx = random_stream_next_index(&stream->random_stream, stream->shuffle_count);
+        float *picked_row = stream->shuffle_rows + picked_idx * column_count;
+
+        memcpy(chunk_values + chunk_row_count * column_count, picked_row, sizeof(float) * column_count);
+        --stream->shuffle_count;
+        memmove(picked_row, stream->shuffle_rows + stream->shuffle_count * column_count, sizeof(float) * column_count);
+        ++chunk_row_count;
+    }
+
+    return chunk_row_count;
+}
+
+/**
+ * @brief Mengisi slot berikutnya; di akhir epoch menulis penanda dan memutar file ke awal
+ * @param stream Stream dataset
+ * @param slot_idx Slot yang diisi
+ */
+static void
+dataset_stream_produce_slot(struct DatasetStream *stream, size_t slot_idx)
+{
+    float *chunk_values = stream->chunk_buffers + slot_idx * stream->chunk_rows * stream->column_count;
+    size_t chunk_row_count = dataset_stream_fill_chunk(stream, chunk_values);
+
+    if (chunk_row_count == 0) {
+        // Jika rewind gagal, epoch berikutnya kosong (hanya penanda akhir epoch) alih-alih membaca posisi acak
+        bool is_rewound = file_seek(stream->dataset_file, stream->data_offset, SEEK_SET) == 0;
+        stream->file_rows_remaining = is_rewound ? stream->row_count : 0;
+        stream->read_count = 0;
+        stream->read_position = 0;
+    }
+
+    stream->chunk_row_counts[slot_idx] = chunk_row_count;
+}
+
+#if defined(NN_USE_PTHREADS)
+/**
+ * @brief Fungsi thread loader: mengisi slot kosong selagi consumer melatih chunk lain
+ * @param stream_pointer Stream dataset
+ * @return NULL
+ */
+static void *
+dataset_stream_loader_main(void *stream_pointer)
+{
+    struct DatasetStream *stream = (struct DatasetStream *)stream_pointer;
+
+    pthread_mutex_lock(&stream->mutex);
+    for (;;) {
+        while (!stream->is_stopping &&
+               stream->filled_count + (stream->is_chunk_held ? 1 : 0) == stream->chunk_buffer_count)
+            pthread_cond_wait(&stream->slot_free, &stream->mutex);
+
+        if (stream->is_stopping) break;
+
+        size_t slot_idx = stream->produce_idx;
+        pthread_mutex_unlock(&stream->mutex);
+
+        // I/O dan shuffle berjalan tanpa lock, paralel dengan training
+        dataset_stream_produce_slot(stream, slot_idx);
+
+        pthread_mutex_lock(&stream->mutex);
+        stream->produce_idx = (slot_idx + 1) % stream->chunk_buffer_count;
+        ++stream->filled_count;
+        pthread_cond_signal(&stream->chunk_ready);
+    }
+    pthread_mutex_unlock(&stream->mutex);
+
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Membuka stream dataset biner untuk training out-of-core
+ * @param dataset_filename Path file dataset biner
+ * @param chunk_rows Jumlah baris per chunk
+ * @param chunk_buffer_count Jumlah buffer chunk (2 = double buffering, 3 = triple buffering)
+ * @param shuffle_buffer_rows Ukuran shuffle buffer dalam baris (0 tanpa shuffle)
+ * @param shuffle_seed Seed shuffle
+ * @return Stream, atau NULL jika file tidak valid
+ */
+struct DatasetStream *
+dataset_stream_open(const char *dataset_filename, size_t chunk_rows, size_t chunk_buffer_count,
+                    size_t shuffle_buffer_rows, uint64_t shuffle_seed)
+{
+    assert(chunk_rows > 0 && chunk_buffer_count >= 2);
+
+    FILE *dataset_file = fopen(dataset_filename, "rb");
+    if (dataset_file == NULL) return NULL;
+
+    struct DatasetFileHeader header;
+    int64_t file_size = -1;
+    if (file_seek(dataset_file, 0, SEEK_END) == 0) file_size = file_tell(dataset_file);
+
+    bool is_valid = file_size >= (int64_t)sizeof(header)
+                 && file_seek(dataset_file, 0, SEEK_SET) == 0
+                 && fread(&header, sizeof(header), 1, dataset_file) == 1
+                 && dataset_binary_header_is_valid(&header, (size_t)file_size)
+                 && file_seek(dataset_file, header.data_offset, SEEK_SET) == 0;
+
+    struct DatasetStream *stream = is_valid ? (struct DatasetStream *)calloc(1, sizeof(*stream)) : NULL;
+    if (stream == NULL) {
+        fclose(dataset_file);
+        return NULL;
+    }
+
+    size_t column_count = (size_t)header.input_column_count + header.output_column_count;
+
+    stream->dataset_file = dataset_file;
+    stream->data_offset = header.data_offset;
+    stream->row_count = header.row_count;
+    stream->input_column_count = header.input_column_count;
+    stream->column_count = column_count;
+    stream->file_rows_remaining = header.row_count;
+    stream->chunk_rows = chunk_rows;
+    stream->chunk_buffer_count = chunk_buffer_count;
+    stream->chunk_buffers = (float *)malloc(sizeof(float) * chunk_buffer_count * chunk_rows * column_count);
+    stream->chunk_row_counts = (size_t *)calloc(chunk_buffer_count, sizeof(size_t));
+    stream->read_rows = (float *)malloc(sizeof(float) * chunk_rows * column_count);
+    stream->shuffle_capacity = shuffle_buffer_rows;
+    stream->shuffle_rows = shuffle_buffer_rows > 0 ? (float *)malloc(sizeof(float) * shuffle_buffer_rows * column_count)
+                                                   : NULL;
+    stream->random_stream = random_stream_create(shuffle_seed, 0);
+
+    assert(stream->chunk_buffers != NULL && stream->chunk_row_counts != NULL && stream->read_rows != NULL);
+    assert(shuffle_buffer_rows == 0 || stream->shuffle_rows != NULL);
+
+#if defined(NN_USE_PTHREADS)
+    pthread_mutex_init(&stream->mutex, NULL);
+    pthread_cond_init(&stream->chunk_ready, NULL);
+    pthread_cond_init(&stream->slot_free, NULL);
+
+    int thread_status = pthread_create(&stream->loader_thread, NULL, dataset_stream_loader_main, stream);
+    assert(thread_status == 0 && "Gagal membuat thread loader dataset");
+    (void)thread_status;
+#endif
+
+    return stream;
+}
+
+/**
+ * @brief Mengambil chunk berikutnya dari stream
+ * @param stream Stream dataset
+ * @param chunk_output Chunk (valid sampai pemanggilan berikutnya)
+ * @return false di akhir epoch (pemanggilan berikutnya memulai epoch baru)
+ */
+bool
+dataset_stream_next_chunk(struct DatasetStream *stream, struct Matrix *chunk_output)
+{
+    assert(stream != NULL && chunk_output != NULL);
+
+    size_t slot_idx;
+
+#if defined(NN_USE_PTHREADS)
+    pthread_mutex_lock(&stream->mutex);
+
+    // Slot yang dipegang sebelumnya dikembalikan ke loader
+    if (stream->is_chunk_held) {
+        stream->consume_idx = (stream->consume_idx + 1) % stream->chunk_buffer_count;
+        stream->is_chunk_held = false;
+        pthread_cond_signal(&stream->slot_free);
+    }
+
+    while (stream->filled_count == 0)
+        pthread_cond_wait(&stream->chunk_ready, &stream->mutex);
+
+    slot_idx = stream->consume_idx;
+    --stream->filled_count;
+    stream->is_chunk_held = true;
+
+    pthread_mutex_unlock(&stream->mutex);
+#else
+    // Tanpa thread: chunk dibaca langsung saat diminta
+    slot_idx = 0;
+    dataset_stream_produce_slot(stream, slot_idx);
+#endif
+
+    size_t chunk_row_count = stream->chunk_row_counts[slot_idx];
+    *chunk_output = (struct Matrix) {
+        .num_rows = chunk_row_count,
+        .num_columns = stream->column_count,
+        .element = stream->chunk_buffers + slot_idx * stream->chunk_rows * stream->column_count,
+    };
+
+    return chunk_row_count > 0;
+}
+
+/**
+ * @brief Mendapatkan jumlah baris dan kolom dataset di stream
+ * @param stream Stream dataset
+ * @param row_count_output Jumlah baris per epoch (boleh NULL)
+ * @param input_column_count_output Jumlah kolom input (boleh NULL)
+ * @param output_column_count_output Jumlah kolom output (boleh NULL)
+ */
+void
+dataset_stream_get_shape(const struct DatasetStream *stream, size_t *row_count_output,
+                         size_t *input_column_count_output, size_t *output_column_count_output)
+{
+    assert(stream != NULL);
+
+    if (row_count_output != NULL) *row_count_output = stream->row_count;
+    if (input_column_count_output != NULL) *input_column_count_output = stream->input_column_count;
+    if (output_column_count_output != NULL)
+        *output_column_count_output = stream->column_count - stream->input_column_count;
+}
+
+/**
+ * @brief Menghentikan thread loader dan membebaskan stream
+ * @param stream Stream dataset (boleh NULL)
+ */
+void
+dataset_stream_close(struct DatasetStream *stream)
+{
+    if (stream == NULL) return;
+
+#if defined(NN_USE_PTHREADS)
+    pthread_mutex_lock(&stream->mutex);
+    stream->is_stopping = true;
+    pthread_cond_broadcast(&stream->slot_free);
+    pthread_mutex_unlock(&stream->mutex);
+
+    pthread_join(stream->loader_thread, NULL);
+    pthread_cond_destroy(&stream->slot_free);
+    pthread_cond_destroy(&stream->chunk_ready);
+    pthread_mutex_destroy(&stream->mutex);
+#endif
+
+    fclose(stream->dataset_file);
+    free(stream->shuffle_rows);
+    free(stream->read_rows);
+    free(stream->chunk_row_counts);
+    free(stream->chunk_buffers);
+    free(stream);
+}
+
+/**
+ * @brief Membuat slice dari beberapa baris matrix
+ * @param source_matrix Matrix sumber
+ * @param start_row Baris awal slice
+ * @param num_rows Jumlah baris yang diambil
+ * @return Matrix baru yang merupakan slice dari matrix asli
+ */
+struct Matrix
+matrix_create_row_slice(struct Matrix source_matrix, size_t start_row, size_t num_rows)
+{
+    assert(start_row + num_rows <= source_matrix.num_rows);
+
+    return (struct Matrix) {
+        .num_rows = num_rows,
+        .num_columns = source_matrix.num_columns,
+        .element = &matrix_at(source_matrix, start_row, 0)
+    };
+}
+
+// ====================[ BATCH PROCESSING - IMPLEMENTATION ]====================
+
+/**
+ * @brief Implementasi bersama batch processing (optimizer NULL berarti SGD dengan learning_rate)
+ */
+static void
+batch_process_training_step(struct TrainingWorkspace training_workspace,
+                            struct Optimizer *optimizer,
+                            struct BatchProcessor *batch_processor,
+                            size_t batch_size,
+                            struct NeuralNetwork network,
+                            struct Matrix training_dataset,
+                            float learning_rate)
+{
+    // Reset jika epoch selesai
+    if (batch_processor->is_epoch_finished) {
+        batch_processor->current_start_idx = 0;
+        batch_processor->accumulated_cost = 0.0f;
+        batch_processor->is_epoch_finished = false;
+    }
+
+    // Tentukan ukuran batch actual (mungkin lebih kecil di batch terakhir)
+    size_t actual_batch_size = (batch_processor->current_start_idx + batch_size >= training_dataset.num_rows)
+                    ? (training_dataset.num_rows - batch_processor->current_start_idx) : batch_size;
+
+    struct Matrix current_batch = matrix_create_row_slice(
+            training_dataset, batch_processor->current_start_idx, actual_batch_size);
+
+    // Hitung gradient dan update network
+    struct NeuralNetwork batch_gradients =
+        training_workspace_compute_gradients(training_workspace, network, current_batch);
+    if (optimizer != NULL)
+        optimizer_step(optimizer, network, batch_gradients);
+    else
+        neural_network_apply_gradients(network, batch_gradients, learning_rate);
+
+    // Akumulasi cost untuk monitoring (dari forward pass gradient, tanpa pass tambahan)
+    batch_processor->accumulated_cost += training_workspace_get_batch_cost(training_workspace);
+    batch_processor->current_start_idx += actual_batch_size;
+
+    // Cek apakah epoch selesai
+    if (batch_processor->current_start_idx >= training_dataset.num_rows) {
+        size_t total_batch_count = (training_dataset.num_rows + batch_size - 1) / batch_size;
+        batch_processor->accumulated_cost /= total_batch_count;
+        batch_processor->is_epoch_finished = true;
+    }
+}
+
+/**
+ * @brief Memproses satu batch data untuk training
+ * @param training_workspace Workspace training (kapasitas minimal batch_size)
+ * @param batch_processor Struktur batch yang melacak progress
+ * @param batch_size Ukuran batch
+ * @param network Neural network yang akan dilatih
+ * @param training_dataset Dataset training
+ * @param learning_rate Learning rate untuk update
+ */
+void
+batch_process_training_data(struct TrainingWorkspace training_workspace,
+                            struct BatchProcessor *batch_processor,
+                            size_t batch_size,
+                            struct NeuralNetwork network,
+                            struct Matrix training_dataset,
+                            float learning_rate)
+{
+    batch_process_training_step(training_workspace, NULL, batch_processor, batch_size,
+                                network, training_dataset, learning_rate);
+}
+
+/**
+ * @brief Memproses satu batch data untuk training dengan optimizer
+ * @param training_workspace Workspace training (kapasitas minimal batch_size)
+ * @param optimizer Optimizer yang memperbarui parameter
+ * @param batch_processor Struktur batch yang melacak progress
+ * @param batch_size Ukuran batch
+ * @param network Neural network yang akan dilatih
+ * @param training_dataset Dataset training
+ */
+void
+batch_process_training_data_with_optimizer(struct TrainingWorkspace training_workspace,
+                                           struct Optimizer *optimizer,
+                                           struct BatchProcessor *batch_processor,
+                                           size_t batch_size,
+                                           struct NeuralNetwork network,
+                                           struct Matrix training_dataset)
+{
+    assert(optimizer != NULL);
+
+    batch_process_training_step(training_workspace, optimizer, batch_processor, batch_size,
+                                network, training_dataset, optimizer->learning_rate);
+}
+
+/**
+ * @brief Melatih network satu epoch dari stream dataset
+ * @param training_workspace Workspace training (kapasitas minimal batch_size)
+ * @param optimizer Optimizer yang memperbarui parameter
+ * @param batch_size Ukuran batch
+ * @param network Neural network yang akan dilatih
+ * @param dataset_stream Stream dataset
+ * @return Jumlah baris yang dilatih
+ */
+size_t
+batch_process_training_stream(struct TrainingWorkspace training_workspace,
+                              struct Optimizer *optimizer,
+                              size_t batch_size,
+                              struct NeuralNetwork network,
+                              struct DatasetStream *dataset_stream)
+{
+    size_t trained_row_count = 0;
+    struct Matrix chunk;
+
+    // Loader mengisi chunk berikutnya selagi chunk ini dilatih
+    while (dataset_stream_next_chunk(dataset_stream, &chunk)) {
+        for (size_t start_idx = 0; start_idx < chunk.num_rows; start_idx += batch_size) {
+            size_t batch_rows = chunk.num_rows - start_idx < batch_size ? chunk.num_rows - start_idx : batch_size;
+            struct Matrix current_batch = matrix_create_row_slice(chunk, start_idx, batch_rows);
+
+            struct NeuralNetwork batch_gradients =
+                training_workspace_compute_gradients(training_workspace, network, current_batch);
+            optimizer_step(optimizer, network, batch_gradients);
+        }
+        trained_row_count += chunk.num_rows;
+    }
+
+    return trained_row_count;
+}
+
+/**
+ * @brief Membuat sampler mini-batch untuk dataset
+ * @param arena_ptr Arena untuk permutasi dan buffer batch
+ * @param training_dataset Dataset yang akan disampling (maksimal UINT32_MAX baris)
+ * @param batch_size Jumlah baris per batch
+ * @return Sampler dengan permutasi identitas
+ */
+struct BatchSampler
+batch_sampler_create(struct MemoryArena *arena_ptr, struct Matrix training_dataset, size_t batch_size)
+{
+    assert(batch_size > 0);
+    assert(training_dataset.num_rows <= UINT32_MAX);
+
+    struct BatchSampler sampler = {
+        .row_count = training_dataset.num_rows,
+        .batch_size = batch_size,
+        .permutation = arena_allocate_memory(arena_ptr, sizeof(uint32_t) * training_dataset.num_rows),
+        .random_stream = random_stream_create_from_global_seed(),
+    };
+
+    for (size_t row_idx = 0; row_idx < sampler.row_count; ++row_idx)
+        sampler.permutation[row_idx] = (uint32_t)row_idx;
+
+    // Buffer batch selalu diisi batch_sampler_next_batch sebelum dibaca
+    sampler.batch_buffer = matrix_allocate_uninitialized(arena_ptr, batch_size, training_dataset.num_columns);
+
+    return sampler;
+}
+
+/**
+ * @brief Mengacak permutasi indeks (Fisher-Yates) dan memulai epoch baru
+ * @param sampler Sampler
+ */
+void
+batch_sampler_shuffle(struct BatchSampler *sampler)
+{
+    assert(sampler != NULL);
+
+    for (size_t current_idx = sampler->row_count; current_idx > 1; --current_idx) {
+        size_t random_idx = random_stream_next_index(&sampler->random_stream, current_idx);
+        uint32_t temp_index = sampler->permutation[current_idx - 1];
+        sampler->permutation[current_idx - 1] = sampler->permutation[random_idx];
+        sampler->permutation[random_idx] = temp_index;
+    }
+
+    sampler->current_position = 0;
+}
+
+/**
+ * @brief Mengumpulkan batch berikutnya ke buffer batch sampler
+ * @param sampler Sampler
+ * @param training_dataset Dataset yang sama dengan saat sampler dibuat
+ * @param batch_output Batch (view ke buffer sampler, valid sampai pemanggilan berikutnya)
+ * @return false jika epoch selesai (posisi kembali ke awal permutasi)
+ */
+bool
+batch_sampler_next_batch(struct BatchSampler *sampler, struct Matrix training_dataset, struct Matrix *batch_output)
+{
+    assert(sampler != NULL && batch_output != NULL);
+    assert(training_dataset.num_rows == sampler->row_count);
+    assert(training_dataset.num_columns == sampler->batch_buffer.num_columns);
+
+    if (sampler->current_position >= sampler->row_count) {
+        sampler->current_position = 0;
+        return false;
+    }
+
+    size_t batch_rows = sampler->row_count - sampler->current_position;
+    if (batch_rows > sampler->batch_size) batch_rows = sampler->batch_size;
+
+    const uint32_t *batch_indices = sampler->permutation + sampler->current_position;
+    size_t row_bytes = sizeof(float) * training_dataset.num_columns;
+
+    for (size_t batch_idx = 0; batch_idx < batch_rows; ++batch_idx) {
+        memcpy(&matrix_at(sampler->batch_buffer, batch_idx, 0),
+               &matrix_at(training_dataset, batch_indices[batch_idx], 0), row_bytes);
+    }
+
+    sampler->current_position += batch_rows;
+    *batch_output = matrix_create_row_slice(sampler->batch_buffer, 0, batch_rows);
+    return true;
+}
+
+/**
+ * @brief Melatih network satu epoch dengan batch dari sampler
+ * @param training_workspace Workspace training (kapasitas minimal sampler->batch_size)
+ * @param optimizer Optimizer yang memperbarui parameter
+ * @param sampler Sampler untuk training_dataset
+ * @param network Neural network yang akan dilatih
+ * @param training_dataset Dataset training
+ */
+void
+batch_process_training_epoch_sampled(struct TrainingWorkspace training_workspace,
+                                     struct Optimizer *optimizer,
+                                     struct BatchSampler *sampler,
+                                     struct NeuralNetwork network,
+                                     struct Matrix training_dataset)
+{
+    assert(optimizer != NULL);
+
+    batch_sampler_shuffle(sampler);
+
+    struct Matrix current_batch;
+    while (batch_sampler_next_batch(sampler, training_dataset, &current_batch)) {
+        struct NeuralNetwork batch_gradients =
+            training_workspace_compute_gradients(training_workspace, network, current_batch);
+        optimizer_step(optimizer, network, batch_gradients);
+    }
+}
+
+/**
+ * @brief Melatih neural network dengan dataset lengkap
+ * @param network Neural network yang akan dilatih
+ * @param arena_ptr Arena untuk alokasi temporary
+ * @param training_dataset Dataset training
+ * @param batch_size Ukuran batch untuk training
+ * @param learning_rate Learning rate
+ * @param num_epochs Jumlah epoch training
+ */
+void
+neural_network_train(struct NeuralNetwork network,
+                     struct MemoryArena *arena_ptr,
+                     struct Matrix training_dataset, size_t batch_size,
+                     float learning_rate, size_t num_epochs)
+{
+    // Workspace dialokasikan sekali untuk seluruh training
+    struct ArenaMarker arena_marker = arena_save(arena_ptr);
+    struct TrainingWorkspace training_workspace = training_workspace_allocate(arena_ptr, network, batch_size);
+
+    for (size_t epoch_idx = 0; epoch_idx < num_epochs; ++epoch_idx) {
+        struct BatchProcessor batch_processor = {0};
+
+        // Proses semua batch dalam satu epoch
+        while (!batch_processor.is_epoch_finished)
+            batch_process_training_data(
+                    training_workspace, &batch_processor, batch_size, network, training_dataset, learning_rate);
+
+        // Print progress
+        printf("Epoch %zu selesai. Loss rata-rata: %.4f, Akurasi: %.2f%%\n",
+                epoch_idx + 1,
+                batch_processor.accumulated_cost,
+                100.0f * neural_network_calculate_accuracy(network, training_dataset));
+    }
+
+    arena_restore(arena_ptr, arena_marker);
+}
+
+/**
+ * @brief Menghitung ukuran arena yang cukup untuk training_workspace_allocate
+ *
+ * Memperhitungkan satu partisi (satu thread) dengan batch_rows baris: gradient
+ * network, aktivasi dan error batch, beserta array struktur dan padding alokasi.
+ * Dipakai sebagai ukuran chunk pertama agar arena worker tidak perlu tumbuh.
+ *
+ * @param network Neural network yang dilatih
+ * @param batch_rows Jumlah baris maksimum per batch
+ * @return Ukuran arena dalam bytes
+ */
+static size_t
+gradient_arena_size(struct NeuralNetwork network, size_t batch_rows)
+{
+    size_t total_bytes = sizeof(struct GradientWorkspace) + sizeof(struct Matrix) * 6 * network.total_layers
+                       + sizeof(uintptr_t) * 8 + NEURAL_NETWORK_PARAMETER_ALIGNMENT;
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers; ++layer_idx) {
+        size_t layer_size = network.layer_sizes[layer_idx];
+
+        // Aktivasi dan error batch
+        total_bytes += 2 * (sizeof(float) * batch_rows * layer_size + ARENA_CACHE_LINE_SIZE);
+
+        // Gradient weights dan bias (setiap blok dibulatkan ke 64 byte)
+        if (layer_idx > 0)
+            total_bytes += sizeof(float) * (network.layer_sizes[layer_idx - 1] + 1) * layer_size
+                         + 2 * NEURAL_NETWORK_PARAMETER_ALIGNMENT;
+    }
+
+    return total_bytes;
+}
+
+/**
+ * @brief Melatih neural network dengan SGD asinkron tanpa lock (Hogwild)
+ * @param network Neural network yang akan dilatih
+ * @param training_dataset Dataset training
+ * @param batch_size Ukuran batch untuk training
+ * @param learning_rate Learning rate
+ * @param num_epochs Jumlah epoch training
+ * @param worker_count Jumlah worker thread (0 untuk memakai semua thread OpenMP)
+ */
+void
+neural_network_train_hogwild(struct NeuralNetwork network,
+                             struct Matrix training_dataset, size_t batch_size,
+                             float learning_rate, size_t num_epochs,
+                             size_t worker_count)
+{
+    assert(batch_size > 0);
+    assert(training_dataset.num_rows > 0);
+
+#if defined(_OPENMP)
+    if (worker_count == 0) worker_count = (size_t)omp_get_max_threads();
+#else
+    worker_count = 1;
+#endif
+
+    size_t batch_count = (training_dataset.num_rows + batch_size - 1) / batch_size;
+    long total_batch_count = (long)(batch_count * num_epochs);
+
+    // Arena setiap worker dialokasikan dan disentuh pertama oleh thread itu sendiri (node NUMA-nya)
+    struct ScratchArenaPool *arena_pool =
+        scratch_arena_pool_create(worker_count, gradient_arena_size(network, batch_size));
+
+    #pragma omp parallel num_threads((int)worker_count)
+    {
+        struct MemoryArena *worker_arena = scratch_arena_pool_acquire(arena_pool);
+        assert(worker_arena != NULL);
+        struct TrainingWorkspace training_workspace = training_workspace_allocate(worker_arena, network, batch_size);
+
+        // Setiap worker memilih batch dengan stream random sendiri, sehingga urutan
+        // batch berbeda setiap epoch tanpa permutasi bersama atau sinkronisasi
+        struct RandomStream worker_stream = random_stream_create_from_global_seed();
+
+        // Worker mengambil tugas berikutnya secara dinamis, tanpa barrier antar epoch
+        #pragma omp for schedule(dynamic, 1) nowait
+        for (long task_idx = 0; task_idx < total_batch_count; ++task_idx) {
+            size_t start_idx = random_stream_next_index(&worker_stream, batch_count) * batch_size;
+            size_t batch_rows = training_dataset.num_rows - start_idx < batch_size
+                              ? training_dataset.num_rows - start_idx : batch_size;
+            struct Matrix current_batch = matrix_create_row_slice(training_dataset, start_idx, batch_rows);
+
+            // Weights dibaca dan ditulis bersamaan oleh worker lain tanpa lock.
+            // Update yang saling menimpa sesekali hilang, dan hal itu memang
+            // diterima oleh Hogwild sebagai ganti tidak adanya sinkronisasi.
+            struct NeuralNetwork batch_gradients =
+                training_workspace_compute_gradients(training_workspace, network, current_batch);
+            neural_network_apply_gradients(network, batch_gradients, learning_rate);
+        }
+
+        scratch_arena_pool_release(arena_pool, worker_arena);
+    }
+
+    scratch_arena_pool_destroy(arena_pool);
+}
+
+/**
+ * @brief Mengacak urutan baris dalam matrix (untuk shuffling dataset)
+ * @param target_matrix Matrix yang baris-barisnya akan diacak
+ */
+void
+matrix_shuffle_rows(struct Matrix target_matrix)
+{
+    if (target_matrix.num_rows <= 1) return;
+
+    struct RandomStream random_stream = random_stream_create_from_global_seed();
+
+    // Fisher-Yates shuffle algorithm
+    for (size_t current_idx = 0; current_idx < target_matrix.num_rows; ++current_idx) {
+        size_t random_idx = current_idx
+                            + random_stream_next_index(&random_stream, target_matrix.num_rows - current_idx);
+        if (current_idx != random_idx) {
+            // Tukar baris current_idx dengan baris random_idx
+            for (size_t col_idx = 0; col_idx < target_matrix.num_columns; ++col_idx) {
+                float temp_value = matrix_at(target_matrix, current_idx, col_idx);
+                matrix_at(target_matrix, current_idx, col_idx) = matrix_at(target_matrix, random_idx, col_idx);
+                matrix_at(target_matrix, random_idx, col_idx) = temp_value;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Jumlah baris yang diproses sekaligus saat evaluasi cost dan akurasi
+ */
+#define EVALUATION_BATCH_ROWS ((size_t)256)
+
+/**
+ * @brief Menghitung ukuran arena yang cukup untuk aktivasi evaluasi
+ * @param network Neural network yang akan dievaluasi
+ * @return Ukuran arena dalam bytes
+ */
+static size_t
+evaluation_arena_size(struct NeuralNetwork network)
+{
+    size_t total_bytes = sizeof(struct BatchActivations) + sizeof(struct Matrix) * network.total_layers
+                       + 2 * ARENA_DEFAULT_ALIGNMENT;
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers; ++layer_idx)
+        total_bytes += sizeof(float) * EVALUATION_BATCH_ROWS * network.layer_sizes[layer_idx] + ARENA_CACHE_LINE_SIZE;
+
+    return total_bytes;
+}
+
+/**
+ * @brief Menghitung cost function (mean squared error) pada dataset
+ * @param network Neural network
+ * @param test_dataset Dataset untuk evaluasi
+ * @return Nilai cost rata-rata
+ */
+float
+neural_network_calculate_cost(struct NeuralNetwork network, struct Matrix test_dataset)
+{
+    size_t sample_count = test_dataset.num_rows;
+    size_t input_size = network.layer_sizes[0];
+    size_t output_size = network.layer_sizes[network.total_layers - 1];
+
+    float total_cost = 0.0f;
+
+    struct MemoryArena evaluation_arena = arena_create(evaluation_arena_size(network));
+    struct BatchActivations batch_activations =
+        neural_network_allocate_batch_activations(&evaluation_arena, network, EVALUATION_BATCH_ROWS);
+
+    // Hitung MSE per potongan batch
+    for (size_t start_idx = 0; start_idx < sample_count; start_idx += EVALUATION_BATCH_ROWS) {
+        size_t batch_rows = sample_count - start_idx < EVALUATION_BATCH_ROWS
+                          ? sample_count - start_idx : EVALUATION_BATCH_ROWS;
+        struct Matrix batch_data = matrix_create_row_slice(test_dataset, start_idx, batch_rows);
+
+        // Forward pass
+        neural_network_forward_pass_batch(network, batch_activations, batch_data);
+        struct Matrix batch_output = batch_activations.activation_matrices[network.total_layers - 1];
+
+        // Hitung squared error
+        for (size_t sample_idx = 0; sample_idx < batch_rows; ++sample_idx) {
+            for (size_t output_idx = 0; output_idx < output_size; ++output_idx) {
+                float prediction_diff = matrix_at(batch_output, sample_idx, output_idx) -
+                                        matrix_at(batch_data, sample_idx, input_size + output_idx);
+
+                total_cost += prediction_diff * prediction_diff;
+            }
+        }
+    }
+
+    arena_destroy(&evaluation_arena);
+
+    return total_cost / sample_count;
+}
+
+/**
+ * @brief Mencari indeks elemen dengan nilai maksimum dalam row
+ * @param input_row Row yang akan dicari nilai maksimumnya
+ * @return Indeks elemen dengan nilai terbesar
+ */
+size_t
+row_find_max_index(struct Row input_row)
+{
+    size_t max_element_index = 0;
+    for (size_t element_idx = 1; element_idx < input_row.num_columns; ++element_idx) {
+        if (input_row.element[element_idx] > input_row.element[max_element_index]) {
+            max_element_index = element_idx;
+        }
+    }
+    return max_element_index;
+}
+
+/**
+ * @brief Evaluasi per potongan untuk satu jenis network (fp32, int8, 16-bit, sparse)
+ *
+ * Setiap jenis network hanya menyediakan cara mengalokasikan workspace per
+ * thread dan forward pass satu potongan; pembagian potongan ke thread,
+ * penyalinan skor, dan perhitungan akurasi dilakukan evaluation_process_chunks.
+ */
+struct EvaluationPass
+{
+    const void *model;      // Network yang dievaluasi (hanya dibaca)
+    size_t input_size;      // Ukuran input layer
+    size_t output_size;     // Ukuran output layer
+    size_t arena_size;      // Ukuran arena workspace per thread
+    void *(*workspace_allocate)(struct MemoryArena *arena_ptr, const void *model);
+    struct Matrix (*forward_pass)(const void *model, void *workspace, struct Matrix input_batch);
+};
+
+/**
+ * @brief Menjalankan forward pass per potongan EVALUATION_BATCH_ROWS secara paralel
+ *
+ * Potongan dibagikan secara dinamis ke thread OpenMP. Setiap thread memiliki
+ * arena dan workspace sendiri, sedangkan network hanya dibaca.
+ *
+ * @param evaluation_pass Network beserta workspace dan forward pass-nya
+ * @param input_batch Matrix input (dengan kolom target jika count_correct)
+ * @param output_scores Matrix hasil skor kelas (boleh NULL)
+ * @param output_labels Array hasil indeks kelas terbesar per baris (boleh NULL)
+ * @param count_correct Hitung prediksi yang cocok dengan kolom target input_batch
+ * @return Jumlah prediksi benar (0 jika count_correct false)
+ */
+static size_t
+evaluation_process_chunks(struct EvaluationPass evaluation_pass, struct Matrix input_batch,
+                          const struct Matrix *output_scores, size_t *output_labels, bool count_correct)
+{
+    size_t correct_predictions = 0;
+    size_t total_samples = input_batch.num_rows;
+    long chunk_count = (long)((total_samples + EVALUATION_BATCH_ROWS - 1) / EVALUATION_BATCH_ROWS);
+
+    assert(input_batch.num_columns >= evaluation_pass.input_size + (count_correct ? evaluation_pass.output_size : 0));
+    assert(output_scores == NULL || output_scores->num_rows == total_samples);
+    assert(output_scores == NULL || output_scores->num_columns == evaluation_pass.output_size);
+
+    #pragma omp parallel if (chunk_count > 1)
+    {
+        struct MemoryArena evaluation_arena = arena_create(evaluation_pass.arena_size);
+        void *workspace = evaluation_pass.workspace_allocate(&evaluation_arena, evaluation_pass.model);
+
+        #pragma omp for schedule(dynamic, 1) reduction(+:correct_predictions)
+        for (long chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx) {
+            size_t start_idx = (size_t)chunk_idx * EVALUATION_BATCH_ROWS;
+            size_t batch_rows = total_samples - start_idx < EVALUATION_BATCH_ROWS
+                              ? total_samples - start_idx : EVALUATION_BATCH_ROWS;
+            struct Matrix batch_data = matrix_create_row_slice(input_batch, start_idx, batch_rows);
+
+            // Forward pass
+            struct Matrix batch_output = matrix_create_row_slice(
+                    evaluation_pass.forward_pass(evaluation_pass.model, workspace, batch_data), 0, batch_rows);
+
+            if (output_scores != NULL)
+                matrix_copy_data(matrix_create_row_slice(*output_scores, start_idx, batch_rows), batch_output);
+
+            if (output_labels == NULL && !count_correct) continue;
+
+            // Label prediksi, dibandingkan dengan label sebenarnya jika diminta
+            for (size_t sample_idx = 0; sample_idx < batch_rows; ++sample_idx) {
+                size_t predicted_class = row_find_max_index(matrix_get_row(batch_output, sample_idx));
+
+                if (output_labels != NULL)
+                    output_labels[start_idx + sample_idx] = predicted_class;
+
+                if (count_correct) {
+                    struct Row expected_output = row_create_slice(matrix_get_row(batch_data, sample_idx),
+                                                                  evaluation_pass.input_size,
+                                                                  evaluation_pass.output_size);
+
+                    if (predicted_class == row_find_max_index(expected_output))
+                        ++correct_predictions;
+                }
+            }
+        }
+
+        arena_destroy(&evaluation_arena);
+    }
+
+    return correct_predictions;
+}
+
+/**
+ * @brief Mengalokasikan matrix aktivasi evaluasi untuk network yang memakai BatchActivations
+ * @param arena_ptr Arena milik thread
+ * @param layout Network (cukup layer_sizes dan total_layers)
+ * @return Pointer ke BatchActivations di arena
+ */
+static struct BatchActivations *
+evaluation_allocate_batch_activations(struct MemoryArena *arena_ptr, struct NeuralNetwork layout)
+{
+    struct BatchActivations *batch_activations = arena_allocate_memory(arena_ptr, sizeof(*batch_activations));
+    assert(batch_activations != NULL);
+
+    *batch_activations = neural_network_allocate_batch_activations(arena_ptr, layout, EVALUATION_BATCH_ROWS);
+    return batch_activations;
+}
+
+/**
+ * @brief Workspace evaluasi network fp32 (lihat struct EvaluationPass)
+ */
+static void *
+neural_network_evaluation_workspace_allocate(struct MemoryArena *arena_ptr, const void *model)
+{
+    return evaluation_allocate_batch_activations(arena_ptr, *(const struct NeuralNetwork *)model);
+}
+
+/**
+ * @brief Forward pass evaluasi network fp32 (lihat struct EvaluationPass)
+ */
+static struct Matrix
+neural_network_evaluation_forward_pass(const void *model, void *workspace, struct Matrix input_batch)
+{
+    const struct NeuralNetwork *network = model;
+    struct BatchActivations *batch_activations = workspace;
+
+    neural_network_forward_pass_batch(*network, *batch_activations, input_batch);
+    return batch_activations->activation_matrices[network->total_layers - 1];
+}
+
+/**
+ * @brief Menyiapkan evaluasi per potongan untuk network fp32
+ * @param network Pointer ke network (harus tetap valid selama evaluasi)
+ * @return Struktur EvaluationPass
+ */
+static struct EvaluationPass
+neural_network_get_evaluation_pass(const struct NeuralNetwork *network)
+{
+    return (struct EvaluationPass) {
+        .model = network,
+        .input_size = network->layer_sizes[0],
+        .output_size = network->layer_sizes[network->total_layers - 1],
+        .arena_size = evaluation_arena_size(*network),
+        .workspace_allocate = neural_network_evaluation_workspace_allocate,
+        .forward_pass = neural_network_evaluation_forward_pass
+    };
+}
+
+/**
+ * @brief Melakukan prediksi untuk banyak baris input sekaligus
+ *
+ * Baris dibagi menjadi potongan EVALUATION_BATCH_ROWS yang dibagikan secara
+ * dinamis ke thread OpenMP (lihat evaluation_process_chunks).
+ *
+ * @param network Neural network yang dipakai
+ * @param input_batch Matrix input (minimal ukuran input layer kolom)
+ * @param output_scores Matrix hasil skor kelas (baris sama dengan input, kolom = ukuran output layer)
+ * @param output_labels Array hasil indeks kelas terbesar per baris (boleh NULL)
+ */
+void
+neural_network_predict_batch(struct NeuralNetwork network, struct Matrix input_batch,
+                             struct Matrix output_scores, size_t *output_labels)
+{
+    evaluation_process_chunks(neural_network_get_evaluation_pass(&network), input_batch,
+                              &output_scores, output_labels, false);
+}
+
+/**
+ * @brief Menghitung akurasi klasifikasi neural network
+ *
+ * Potongan dataset dievaluasi paralel seperti neural_network_predict_batch.
+ *
+ * @param network Neural network yang akan dievaluasi
+ * @param test_dataset Dataset untuk evaluasi
+ * @return Akurasi antara 0.0 hingga 1.0
+ */
+float
+neural_network_calculate_accuracy(struct NeuralNetwork network, struct Matrix test_dataset)
+{
+    size_t correct_predictions = evaluation_process_chunks(neural_network_get_evaluation_pass(&network),
+                                                           test_dataset, NULL, NULL, true);
+
+    return (float)correct_predictions / test_dataset.num_rows;
+}
+
+/**
+ * @brief Mencari nilai minimum dan maksimum satu kolom matrix
+ * @param target_matrix Matrix sumber
+ * @param col_idx Indeks kolom
+ * @param min_value_output Nilai minimum
+ * @param max_value_output Nilai maksimum
+ */
+static void
+matrix_column_minmax(struct Matrix target_matrix, size_t col_idx, float *min_value_output, float *max_value_output)
+{
+    float column_min_value = matrix_at(target_matrix, 0, col_idx);
+    float column_max_value = matrix_at(target_matrix, 0, col_idx);
+
+    for (size_t row_idx = 1; row_idx < target_matrix.num_rows; ++row_idx) {
+        float current_value = matrix_at(target_matrix, row_idx, col_idx);
+        if (current_value < column_min_value) column_min_value = current_value;
+        if (current_value > column_max_value) column_max_value = current_value;
+    }
+
+    *min_value_output = column_min_value;
+    *max_value_output = column_max_value;
+}
+
+/**
+ * @brief Menskalakan satu kolom matrix dari [min, max] ke [new_min, new_max]
+ * @param target_matrix Matrix yang akan dinormalisasi
+ * @param col_idx Indeks kolom
+ * @param column_min_value Nilai minimum asli kolom
+ * @param column_max_value Nilai maksimum asli kolom
+ * @param new_min_value Nilai minimum baru
+ * @param new_max_value Nilai maksimum baru
+ */
+static void
+matrix_scale_column(struct Matrix target_matrix, size_t col_idx, float column_min_value, float column_max_value,
+                    float new_min_value, float new_max_value)
+{
+    // Hindari pembagian dengan nol
+    float value_range = column_max_value - column_min_value;
+    if (value_range == 0.0f) value_range = 1.0f;
+
+    // Terapkan normalisasi min-max
+    for (size_t row_idx = 0; row_idx < target_matrix.num_rows; ++row_idx) {
+        float *current_value_ptr = &matrix_at(target_matrix, row_idx, col_idx);
+        *current_value_ptr = ((*current_value_ptr - column_min_value) / value_range) *
+                             (new_max_value - new_min_value) + new_min_value;
+    }
+}
+
+/**
+ * @brief Normalisasi min-max pada kolom input matrix
+ * @param target_matrix Matrix yang akan dinormalisasi
+ * @param num_input_columns Jumlah kolom input yang akan dinormalisasi
+ * @param new_min_value Nilai minimum baru setelah normalisasi
+ * @param new_max_value Nilai maksimum baru setelah normalisasi
+ */
+void
+matrix_normalize_minmax(struct Matrix target_matrix, size_t num_input_columns, float new_min_value, float new_max_value)
+{
+    // Normalisasi setiap kolom secara terpisah
+    for (size_t col_idx = 0; col_idx < num_input_columns; ++col_idx) {
+        float column_min_value, column_max_value;
+        matrix_column_minmax(target_matrix, col_idx, &column_min_value, &column_max_value);
+        matrix_scale_column(target_matrix, col_idx, column_min_value, column_max_value, new_min_value, new_max_value);
+    }
+}
+
+/**
+ * @brief Normalisasi min-max dan mengembalikan parameter yang dipakai
+ * @param arena_ptr Arena untuk array min/max
+ * @param target_matrix Matrix yang akan dinormalisasi
+ * @param num_input_columns Jumlah kolom input yang akan dinormalisasi
+ * @param new_min_value Nilai minimum baru setelah normalisasi
+ * @param new_max_value Nilai maksimum baru setelah normalisasi
+ * @return Parameter normalisasi
+ */
+struct NormalizationParameters
+matrix_normalize_minmax_with_parameters(struct MemoryArena *arena_ptr, struct Matrix target_matrix,
+                                        size_t num_input_columns, float new_min_value, float new_max_value)
+{
+    struct NormalizationParameters parameters = {
+        .column_count = num_input_columns,
+        .column_min_values = arena_allocate_memory(arena_ptr, sizeof(float) * num_input_columns),
+        .column_max_values = arena_allocate_memory(arena_ptr, sizeof(float) * num_input_columns),
+        .new_min_value = new_min_value,
+        .new_max_value = new_max_value,
+    };
+
+    for (size_t col_idx = 0; col_idx < num_input_columns; ++col_idx)
+        matrix_column_minmax(target_matrix, col_idx, &parameters.column_min_values[col_idx],
+                             &parameters.column_max_values[col_idx]);
+
+    matrix_apply_normalization(target_matrix, parameters);
+    return parameters;
+}
+
+/**
+ * @brief Menerapkan parameter normalisasi yang tersimpan ke data baru
+ * @param target_matrix Matrix yang akan dinormalisasi
+ * @param parameters Parameter normalisasi
+ */
+void
+matrix_apply_normalization(struct Matrix target_matrix, struct NormalizationParameters parameters)
+{
+    assert(parameters.column_count <= target_matrix.num_columns);
+
+    for (size_t col_idx = 0; col_idx < parameters.column_count; ++col_idx) {
+        matrix_scale_column(target_matrix, col_idx, parameters.column_min_values[col_idx],
+                            parameters.column_max_values[col_idx], parameters.new_min_value,
+                            parameters.new_max_value);
+    }
+}
+
+/**
+ * @brief Inisialisasi weights neural network dengan nilai random
+ * @param network Neural network yang akan diinisialisasi
+ * @param min_weight Nilai minimum untuk random weights
+ * @param max_weight Nilai maksimum untuk random weights
+ */
+void
+neural_network_randomize_weights(struct NeuralNetwork network, float min_weight, float max_weight)
+{
+    // Inisialisasi semua weights dengan random, biases dengan nol
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        matrix_fill_random(network.weight_matrices[layer_idx], min_weight, max_weight);
+        row_fill_with_value(network.bias_vectors[layer_idx], 0.0f);
+    }
+}
+
+// ==================[ QUANTIZED INFERENCE - IMPLEMENTATION ]===================
+
+/**
+ * @brief Nilai maksimum weights int8 (simetris, -128 tidak dipakai)
+ */
+#define QUANTIZED_WEIGHT_MAX 127.0f
+
+/**
+ * @brief Nilai maksimum aktivasi terkuantisasi (7 bit, lihat SIMD_INT8_ACTIVATION_ZERO_POINT)
+ */
+#define QUANTIZED_ACTIVATION_MAX 63.0f
+
+/**
+ * @brief Jumlah elemen weights minimum agar kuantisasi layer dibagi ke thread OpenMP
+ */
+#define QUANTIZE_PARALLEL_MIN_ELEMENTS ((size_t)65536)
+
+/**
+ * @brief Membulatkan ke integer terdekat (setengah menjauhi nol)
+ * @param value Nilai yang sudah berada di rentang kuantisasi
+ * @return Nilai integer
+ */
+static inline int32_t
+quantize_round(float value)
+{
+    return (int32_t)(value + (value >= 0.0f ? 0.5f : -0.5f));
+}
+
+/**
+ * @brief Mengkuantisasi satu layer: weights per kolom output dipacking ke panel int8
+ * @param arena_ptr Arena untuk alokasi layer
+ * @param weights Matrix weights (input x output)
+ * @param bias_vector Bias layer
+ * @param activation_type Aktivasi output layer
+ * @return Layer terkuantisasi
+ */
+static struct QuantizedLayer
+quantized_layer_create(struct MemoryArena *arena_ptr, struct Matrix weights, struct Row bias_vector,
+                       enum ActivationType activation_type)
+{
+    struct QuantizedLayer layer;
+    layer.input_size = weights.num_rows;
+    layer.output_size = weights.num_columns;
+    layer.input_groups = (layer.input_size + 3) / 4;
+    layer.padded_output_size = (layer.output_size + SIMD_INT8_GEMM_NR - 1) / SIMD_INT8_GEMM_NR * SIMD_INT8_GEMM_NR;
+    layer.activation_type = activation_type;
+
+    size_t panel_bytes = layer.input_groups * 4 * SIMD_INT8_GEMM_NR;
+    size_t panel_count = layer.padded_output_size / SIMD_INT8_GEMM_NR;
+
+    // Padding kolom dan input harus nol agar tidak ikut terakumulasi
+    layer.packed_weights = arena_allocate_aligned(arena_ptr, panel_bytes * panel_count, ARENA_CACHE_LINE_SIZE);
+    layer.weight_scales = arena_allocate_aligned(arena_ptr, sizeof(float) * layer.padded_output_size,
+                                                 ARENA_CACHE_LINE_SIZE);
+    layer.weight_offsets = arena_allocate_aligned(arena_ptr, sizeof(int32_t) * layer.padded_output_size,
+                                                  ARENA_CACHE_LINE_SIZE);
+    layer.biases = arena_allocate_aligned(arena_ptr, sizeof(float) * layer.padded_output_size, ARENA_CACHE_LINE_SIZE);
+
+    assert(layer.packed_weights != NULL && layer.weight_scales != NULL);
+    assert(layer.weight_offsets != NULL && layer.biases != NULL);
+
+    long output_count = (long)layer.output_size;
+
+    #pragma omp parallel for schedule(static) if (layer.input_size * layer.output_size >= QUANTIZE_PARALLEL_MIN_ELEMENTS)
+    for (long output_idx = 0; output_idx < output_count; ++output_idx) {
+        size_t column_idx = (size_t)output_idx;
+        int8_t *panel = layer.packed_weights + column_idx / SIMD_INT8_GEMM_NR * panel_bytes;
+        size_t lane_idx = column_idx % SIMD_INT8_GEMM_NR;
+
+        float max_abs_weight = 0.0f;
+        for (size_t input_idx = 0; input_idx < layer.input_size; ++input_idx)
+            max_abs_weight = fmaxf(max_abs_weight, fabsf(matrix_at(weights, input_idx, column_idx)));
+
+        float inverse_scale = max_abs_weight > 0.0f ? QUANTIZED_WEIGHT_MAX / max_abs_weight : 0.0f;
+        int32_t weight_sum = 0;
+
+        for (size_t input_idx = 0; input_idx < layer.input_size; ++input_idx) {
+            int32_t quantized_weight = quantize_round(matrix_at(weights, input_idx, column_idx) * inverse_scale);
+            if (quantized_weight > 127) quantized_weight = 127;
+            if (quantized_weight < -127) quantized_weight = -127;
+
+            panel[(input_idx / 4 * SIMD_INT8_GEMM_NR + lane_idx) * 4 + input_idx % 4] = (int8_t)quantized_weight;
+            weight_sum += quantized_weight;
+        }
+
+        layer.weight_scales[column_idx] = max_abs_weight / QUANTIZED_WEIGHT_MAX;
+        layer.weight_offsets[column_idx] = SIMD_INT8_ACTIVATION_ZERO_POINT * weight_sum;
+        layer.biases[column_idx] = bias_vector.element[column_idx];
+    }
+
+    return layer;
+}
+
+/**
+ * @brief Mengkuantisasi network terlatih menjadi weights int8 (post-training)
+ * @param arena_ptr Arena untuk alokasi network terkuantisasi
+ * @param network Neural network sumber
+ * @return Network terkuantisasi
+ */
+struct QuantizedNeuralNetwork
+neural_network_quantize(struct MemoryArena *arena_ptr, struct NeuralNetwork network)
+{
+    assert(network.total_layers > 1);
+
+    struct QuantizedNeuralNetwork quantized_network;
+    quantized_network.total_layers = network.total_layers;
+    quantized_network.layer_sizes = arena_allocate_memory(arena_ptr, sizeof(size_t) * network.total_layers);
+    quantized_network.layers =
+        arena_allocate_memory(arena_ptr, sizeof(struct QuantizedLayer) * (network.total_layers - 1));
+    quantized_network.weight_bytes = 0;
+
+    assert(quantized_network.layer_sizes != NULL && quantized_network.layers != NULL);
+
+    memcpy(quantized_network.layer_sizes, network.layer_sizes, sizeof(size_t) * network.total_layers);
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        struct QuantizedLayer layer =
+            quantized_layer_create(arena_ptr, network.weight_matrices[layer_idx], network.bias_vectors[layer_idx],
+                                   network.activation_types[layer_idx + 1]);
+
+        quantized_network.layers[layer_idx] = layer;
+        quantized_network.weight_bytes += layer.input_groups * 4 * layer.padded_output_size;
+    }
+
+    return quantized_network;
+}
+
+/**
+ * @brief Buffer forward pass int8 milik satu thread evaluasi
+ */
+struct QuantizedBatchWorkspace
+{
+    uint8_t *quantized_activations; // Aktivasi u8 (EVALUATION_BATCH_ROWS x quantized_stride)
+    size_t quantized_stride;        // Bytes per baris (input terbesar, kelipatan 4)
+    float *row_scales;              // Skala kuantisasi per baris
+    float *activations[2];          // Aktivasi fp32 bergantian antar layer
+};
+
+/**
+ * @brief Mencari jumlah grup input dan ukuran output terbesar dari semua layer
+ * @param quantized_network Network terkuantisasi
+ * @param max_input_groups_output Jumlah grup input terbesar
+ * @param max_output_size_output Ukuran output terbesar
+ */
+static void
+quantized_network_get_max_layer_sizes(struct QuantizedNeuralNetwork quantized_network,
+                                      size_t *max_input_groups_output, size_t *max_output_size_output)
+{
+    size_t max_input_groups = 0;
+    size_t max_output_size = 0;
+
+    for (size_t layer_idx = 0; layer_idx < quantized_network.total_layers - 1; ++layer_idx) {
+        struct QuantizedLayer layer = quantized_network.layers[layer_idx];
+        if (layer.input_groups > max_input_groups) max_input_groups = layer.input_groups;
+        if (layer.output_size > max_output_size) max_output_size = layer.output_size;
+    }
+
+    *max_input_groups_output = max_input_groups;
+    *max_output_size_output = max_output_size;
+}
+
+/**
+ * @brief Mengalokasikan workspace forward pass int8 dari arena
+ * @param arena_ptr Arena untuk alokasi
+ * @param quantized_network Network terkuantisasi
+ * @return Workspace untuk EVALUATION_BATCH_ROWS baris
+ */
+static struct QuantizedBatchWorkspace
+quantized_batch_workspace_allocate(struct MemoryArena *arena_ptr, struct QuantizedNeuralNetwork quantized_network)
+{
+    size_t max_input_groups, max_output_size;
+    quantized_network_get_max_layer_sizes(quantized_network, &max_input_groups, &max_output_size);
+
+    struct QuantizedBatchWorkspace workspace;
+    workspace.quantized_stride = max_input_groups * 4;
+    workspace.quantized_activations = arena_allocate_uninitialized(
+        arena_ptr, EVALUATION_BATCH_ROWS * workspace.quantized_stride, ARENA_CACHE_LINE_SIZE);
+    workspace.row_scales = arena_allocate_uninitialized(arena_ptr, sizeof(float) * EVALUATION_BATCH_ROWS,
+                                                        ARENA_CACHE_LINE_SIZE);
+
+    for (size_t buffer_idx = 0; buffer_idx < 2; ++buffer_idx) {
+        workspace.activations[buffer_idx] = arena_allocate_uninitialized(
+            arena_ptr, sizeof(float) * EVALUATION_BATCH_ROWS * max_output_size, ARENA_CACHE_LINE_SIZE);
+    }
+
+    return workspace;
+}
+
+/**
+ * @brief Menghitung ukuran arena yang cukup untuk workspace forward pass int8
+ * @param quantized_network Network terkuantisasi
+ * @return Ukuran arena dalam bytes
+ */
+static size_t
+quantized_evaluation_arena_size(struct QuantizedNeuralNetwork quantized_network)
+{
+    size_t max_input_groups, max_output_size;
+    quantized_network_get_max_layer_sizes(quantized_network, &max_input_groups, &max_output_size);
+
+    return EVALUATION_BATCH_ROWS * (max_input_groups * 4 + sizeof(float) * (1 + 2 * max_output_size))
+         + 4 * ARENA_CACHE_LINE_SIZE + sizeof(struct QuantizedBatchWorkspace) + ARENA_DEFAULT_ALIGNMENT;
+}
+
+/**
+ * @brief Mengkuantisasi aktivasi per baris ke u8 dengan zero point (simetris 7 bit)
+ * @param input Matrix aktivasi fp32 (minimal input_size kolom)
+ * @param input_size Jumlah kolom yang dikuantisasi
+ * @param quantized_stride Bytes per baris output (kelipatan 4, sisa diisi zero point)
+ * @param quantized_output Aktivasi terkuantisasi
+ * @param row_scales Skala setiap baris
+ */
+static void
+quantized_activation_quantize_rows(struct Matrix input, size_t input_size, size_t quantized_stride,
+                                   uint8_t *quantized_output, float *row_scales)
+{
+    for (size_t row_idx = 0; row_idx < input.num_rows; ++row_idx) {
+        const float *input_row = &matrix_at(input, row_idx, 0);
+        uint8_t *quantized_row = quantized_output + row_idx * quantized_stride;
+
+        float max_abs_value = 0.0f;
+        for (size_t column_idx = 0; column_idx < input_size; ++column_idx)
+            max_abs_value = fmaxf(max_abs_value, fabsf(input_row[column_idx]));
+
+        float inverse_scale = max_abs_value > 0.0f ? QUANTIZED_ACTIVATION_MAX / max_abs_value : 0.0f;
+        row_scales[row_idx] = max_abs_value / QUANTIZED_ACTIVATION_MAX;
+
+        for (size_t column_idx = 0; column_idx < input_size; ++column_idx) {
+            int32_t quantized_value = quantize_round(input_row[column_idx] * inverse_scale);
+            quantized_row[column_idx] = (uint8_t)(quantized_value + SIMD_INT8_ACTIVATION_ZERO_POINT);
+        }
+        memset(quantized_row + input_size, SIMD_INT8_ACTIVATION_ZERO_POINT, quantized_stride - input_size);
+    }
+}
+
+/**
+ * @brief Forward pass int8 untuk satu potongan batch
+ *
+ * Setiap layer: aktivasi dikuantisasi per baris, lalu kernel GEMM int8
+ * dipanggil per panel 16 kolom; panel weights dipakai ulang untuk semua
+ * baris potongan selagi masih di cache.
+ *
+ * @param quantized_network Network terkuantisasi
+ * @param workspace Workspace milik thread pemanggil
+ * @param input_batch Input (maksimal EVALUATION_BATCH_ROWS baris)
+ * @return Aktivasi output layer (view ke workspace)
+ */
+static struct Matrix
+quantized_network_forward_pass_batch(struct QuantizedNeuralNetwork quantized_network,
+                                     struct QuantizedBatchWorkspace workspace, struct Matrix input_batch)
+{
+    assert(input_batch.num_rows <= EVALUATION_BATCH_ROWS);
+    assert(input_batch.num_columns >= quantized_network.layer_sizes[0]);
+
+    const struct SimdKernelTable *kernels = simd_get_kernels();
+    bool use_fast_activation = activation_get_precision() == ACTIVATION_PRECISION_FAST;
+    size_t batch_rows = input_batch.num_rows;
+    struct Matrix current_activation = input_batch;
+
+    for (size_t layer_idx = 0; layer_idx < quantized_network.total_layers - 1; ++layer_idx) {
+        struct QuantizedLayer layer = quantized_network.layers[layer_idx];
+        struct Matrix next_activation = { batch_rows, layer.output_size, workspace.activations[layer_idx % 2] };
+        size_t panel_bytes = layer.input_groups * 4 * SIMD_INT8_GEMM_NR;
+
+        quantized_activation_quantize_rows(current_activation, layer.input_size, workspace.quantized_stride,
+                                           workspace.quantized_activations, workspace.row_scales);
+
+        for (size_t column_start = 0; column_start < layer.output_size; column_start += SIMD_INT8_GEMM_NR) {
+            size_t columns = layer.output_size - column_start < SIMD_INT8_GEMM_NR
+                           ? layer.output_size - column_start : SIMD_INT8_GEMM_NR;
+            const int8_t *panel = layer.packed_weights + column_start / SIMD_INT8_GEMM_NR * panel_bytes;
+
+            // row_scales diisi per blok baris di bawah
+            struct QuantizedGemmEpilogue epilogue = {
+                .column_scales = layer.weight_scales + column_start,
+                .column_offsets = layer.weight_offsets + column_start,
+                .bias = layer.biases + column_start,
+                .activation_type = layer.activation_type,
+                .use_fast_activation = use_fast_activation
+            };
+
+            for (size_t row_start = 0; row_start < batch_rows; row_start += SIMD_INT8_GEMM_MR) {
+                size_t rows = batch_rows - row_start < SIMD_INT8_GEMM_MR ? batch_rows - row_start : SIMD_INT8_GEMM_MR;
+                epilogue.row_scales = workspace.row_scales + row_start;
+
+                kernels->gemm_int8_kernel(layer.input_groups,
+                                          workspace.quantized_activations + row_start * workspace.quantized_stride,
+                                          workspace.quantized_stride, panel,
+                                          &matrix_at(next_activation, row_start, column_start),
+                                          next_activation.num_columns, rows, columns, &epilogue);
+            }
+        }
+
+        current_activation = next_activation;
+    }
+
+    return current_activation;
+}
+
+/**
+ * @brief Workspace evaluasi network int8 (lihat struct EvaluationPass)
+ */
+static void *
+quantized_network_evaluation_workspace_allocate(struct MemoryArena *arena_ptr, const void *model)
+{
+    struct QuantizedBatchWorkspace *workspace = arena_allocate_memory(arena_ptr, sizeof(*workspace));
+    assert(workspace != NULL);
+
+    *workspace = quantized_batch_workspace_allocate(arena_ptr, *(const struct QuantizedNeuralNetwork *)model);
+    return workspace;
+}
+
+/**
+ * @brief Forward pass evaluasi network int8 (lihat struct EvaluationPass)
+ */
+static struct Matrix
+quantized_network_evaluation_forward_pass(const void *model, void *workspace, struct Matrix input_batch)
+{
+    return quantized_network_forward_pass_batch(*(const struct QuantizedNeuralNetwork *)model,
+                                                *(struct QuantizedBatchWorkspace *)workspace, input_batch);
+}
+
+/**
+ * @brief Menyiapkan evaluasi per potongan untuk network int8
+ * @param quantized_network Pointer ke network terkuantisasi (harus tetap valid selama evaluasi)
+ * @return Struktur EvaluationPass
+ */
+static struct EvaluationPass
+quantized_network_get_evaluation_pass(const struct QuantizedNeuralNetwork *quantized_network)
+{
+    return (struct EvaluationPass) {
+        .model = quantized_network,
+        .input_size = quantized_network->layer_sizes[0],
+        .output_size = quantized_network->layer_sizes[quantized_network->total_layers - 1],
+        .arena_size = quantized_evaluation_arena_size(*quantized_network),
+        .workspace_allocate = quantized_network_evaluation_workspace_allocate,
+        .forward_pass = quantized_network_evaluation_forward_pass
+    };
+}
+
+/**
+ * @brief Melakukan prediksi int8 untuk banyak baris input sekaligus
+ *
+ * Pembagian kerja sama dengan neural_network_predict_batch: potongan
+ * EVALUATION_BATCH_ROWS dibagikan dinamis, setiap thread memiliki workspace.
+ *
+ * @param quantized_network Network terkuantisasi
+ * @param input_batch Matrix input (minimal ukuran input layer kolom)
+ * @param output_scores Matrix hasil skor kelas (baris sama dengan input, kolom = ukuran output layer)
+ * @param output_labels Array hasil indeks kelas terbesar per baris (boleh NULL)
+ */
+void
+quantized_network_predict_batch(struct QuantizedNeuralNetwork quantized_network, struct Matrix input_batch,
+                                struct Matrix output_scores, size_t *output_labels)
+{
+    evaluation_process_chunks(quantized_network_get_evaluation_pass(&quantized_network), input_batch,
+                              &output_scores, output_labels, false);
+}
+
+/**
+ * @brief Menghitung akurasi klasifikasi network terkuantisasi
+ * @param quantized_network Network terkuantisasi
+ * @param test_dataset Dataset untuk evaluasi
+ * @return Akurasi antara 0.0 hingga 1.0
+ */
+float
+quantized_network_calculate_accuracy(struct QuantizedNeuralNetwork quantized_network, struct Matrix test_dataset)
+{
+    size_t correct_predictions = evaluation_process_chunks(quantized_network_get_evaluation_pass(&quantized_network),
+                                                           test_dataset, NULL, NULL, true);
+
+    return (float)correct_predictions / test_dataset.num_rows;
+}
+
+// ================[ HALF PRECISION INFERENCE - IMPLEMENTATION ]================
+
+/**
+ * @brief Mengonversi network menjadi salinan dengan weights 16-bit
+ * @param arena_ptr Arena untuk alokasi network 16-bit
+ * @param network Neural network sumber (master weights fp32)
+ * @param format Format weights (fp16 atau bf16)
+ * @return Network dengan weights 16-bit
+ */
+struct HalfPrecisionNeuralNetwork
+neural_network_convert_half_precision(struct MemoryArena *arena_ptr, struct NeuralNetwork network,
+                                      enum HalfPrecisionFormat format)
+{
+    assert(network.total_layers > 1);
+
+    size_t total_layers = network.total_layers;
+    struct HalfPrecisionNeuralNetwork half_network;
+    half_network.total_layers = total_layers;
+    half_network.format = format;
+
+    half_network.layer_sizes = arena_allocate_memory(arena_ptr, sizeof(size_t) * total_layers);
+    half_network.activation_types =
+        arena_allocate_memory(arena_ptr, sizeof(*half_network.activation_types) * total_layers);
+    half_network.weight_matrices =
+        arena_allocate_memory(arena_ptr, sizeof(*half_network.weight_matrices) * (total_layers - 1));
+    half_network.bias_vectors =
+        arena_allocate_memory(arena_ptr, sizeof(*half_network.bias_vectors) * (total_layers - 1));
+
+    assert(half_network.layer_sizes != NULL && half_network.activation_types != NULL);
+    assert(half_network.weight_matrices != NULL && half_network.bias_vectors != NULL);
+
+    memcpy(half_network.layer_sizes, network.layer_sizes, sizeof(size_t) * total_layers);
+    memcpy(half_network.activation_types, network.activation_types,
+           sizeof(*half_network.activation_types) * total_layers);
+
+    for (size_t layer_idx = 0; layer_idx < total_layers - 1; ++layer_idx) {
+        struct Matrix weights = network.weight_matrices[layer_idx];
+        half_network.weight_matrices[layer_idx] =
+            half_matrix_allocate(arena_ptr, weights.num_rows, weights.num_columns, format);
+        half_network.bias_vectors[layer_idx] = row_allocate(arena_ptr, network.bias_vectors[layer_idx].num_columns);
+    }
+
+    half_precision_network_update_weights(half_network, network);
+
+    return half_network;
+}
+
+/**
+ * @brief Memperbarui weights 16-bit dan bias dari master weights fp32
+ * @param half_network Network 16-bit (hasil neural_network_convert_half_precision)
+ * @param network Neural network master dengan arsitektur yang sama
+ */
+void
+half_precision_network_update_weights(struct HalfPrecisionNeuralNetwork half_network, struct NeuralNetwork network)
+{
+    assert(half_network.total_layers == network.total_layers);
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        half_matrix_convert_from_matrix(half_network.weight_matrices[layer_idx], network.weight_matrices[layer_idx]);
+        row_copy_data(half_network.bias_vectors[layer_idx], network.bias_vectors[layer_idx]);
+    }
+}
+
+/**
+ * @brief Membuat view arsitektur network 16-bit untuk alokasi aktivasi evaluasi
+ *
+ * Hanya layer_sizes dan total_layers yang diisi; cukup untuk
+ * neural_network_allocate_batch_activations dan evaluation_arena_size.
+ */
+static struct NeuralNetwork
+half_precision_network_get_layout(struct HalfPrecisionNeuralNetwork half_network)
+{
+    struct NeuralNetwork layout = {0};
+    layout.layer_sizes = half_network.layer_sizes;
+    layout.total_layers = half_network.total_layers;
+    return layout;
+}
+
+/**
+ * @brief Forward pass batch dengan weights 16-bit (lihat neural_network_forward_pass_batch)
+ * @param half_network Network 16-bit
+ * @param batch_activations Matrix aktivasi tujuan
+ * @param input_batch Matrix input (minimal ukuran input layer kolom)
+ */
+static void
+half_precision_network_forward_pass_batch(struct HalfPrecisionNeuralNetwork half_network,
+                                          struct BatchActivations batch_activations, struct Matrix input_batch)
+{
+    assert(input_batch.num_rows <= batch_activations.batch_capacity);
+    assert(input_batch.num_columns >= half_network.layer_sizes[0]);
+
+    size_t batch_rows = input_batch.num_rows;
+    struct Matrix input_activation =
+        matrix_create_row_slice(batch_activations.activation_matrices[0], 0, batch_rows);
+
+    for (size_t row_idx = 0; row_idx < batch_rows; ++row_idx)
+        memcpy(&matrix_at(input_activation, row_idx, 0),
+               &matrix_at(input_batch, row_idx, 0),
+               sizeof(*input_activation.element) * input_activation.num_columns);
+
+    for (size_t layer_idx = 0; layer_idx < half_network.total_layers - 1; ++layer_idx) {
+        struct Matrix current_activation =
+            matrix_create_row_slice(batch_activations.activation_matrices[layer_idx], 0, batch_rows);
+        struct Matrix next_activation =
+            matrix_create_row_slice(batch_activations.activation_matrices[layer_idx + 1], 0, batch_rows);
+
+        matrix_multiply_half_bias_activation(next_activation, current_activation,
+                                             half_network.weight_matrices[layer_idx],
+                                             half_network.bias_vectors[layer_idx],
+                                             half_network.activation_types[layer_idx + 1]);
+    }
+}
+
+/**
+ * @brief Workspace evaluasi network 16-bit (lihat struct EvaluationPass)
+ */
+static void *
+half_precision_network_evaluation_workspace_allocate(struct MemoryArena *arena_ptr, const void *model)
+{
+    return evaluation_allocate_batch_activations(
+            arena_ptr, half_precision_network_get_layout(*(const struct HalfPrecisionNeuralNetwork *)model));
+}
+
+/**
+ * @brief Forward pass evaluasi network 16-bit (lihat struct EvaluationPass)
+ */
+static struct Matrix
+half_precision_network_evaluation_forward_pass(const void *model, void *workspace, struct Matrix input_batch)
+{
+    const struct HalfPrecisionNeuralNetwork *half_network = model;
+    struct BatchActivations *batch_activations = workspace;
+
+    half_precision_network_forward_pass_batch(*half_network, *batch_activations, input_batch);
+    return batch_activations->activation_matrices[half_network->total_layers - 1];
+}
+
+/**
+ * @brief Menyiapkan evaluasi per potongan untuk network 16-bit
+ * @param half_network Pointer ke network 16-bit (harus tetap valid selama evaluasi)
+ * @return Struktur EvaluationPass
+ */
+static struct EvaluationPass
+half_precision_network_get_evaluation_pass(const struct HalfPrecisionNeuralNetwork *half_network)
+{
+    return (struct EvaluationPass) {
+        .model = half_network,
+        .input_size = half_network->layer_sizes[0],
+        .output_size = half_network->layer_sizes[half_network->total_layers - 1],
+        .arena_size = evaluation_arena_size(half_precision_network_get_layout(*half_network)),
+        .workspace_allocate = half_precision_network_evaluation_workspace_allocate,
+        .forward_pass = half_precision_network_evaluation_forward_pass
+    };
+}
+
+/**
+ * @brief Melakukan prediksi dengan weights 16-bit untuk banyak baris input sekaligus
+ * @param half_network Network 16-bit
+ * @param input_batch Matrix input (minimal ukuran input layer kolom)
+ * @param output_scores Matrix hasil skor kelas (baris sama dengan input, kolom = ukuran output layer)
+ * @param output_labels Array hasil indeks kelas terbesar per baris (boleh NULL)
+ */
+void
+half_precision_network_predict_batch(struct HalfPrecisionNeuralNetwork half_network, struct Matrix input_batch,
+                                     struct Matrix output_scores, size_t *output_labels)
+{
+    evaluation_process_chunks(half_precision_network_get_evaluation_pass(&half_network), input_batch,
+                              &output_scores, output_labels, false);
+}
+
+/**
+ * @brief Menghitung akurasi klasifikasi network 16-bit
+ * @param half_network Network 16-bit
+ * @param test_dataset Dataset untuk evaluasi
+ * @return Akurasi antara 0.0 hingga 1.0
+ */
+float
+half_precision_network_calculate_accuracy(struct HalfPrecisionNeuralNetwork half_network, struct Matrix test_dataset)
+{
+    size_t correct_predictions = evaluation_process_chunks(half_precision_network_get_evaluation_pass(&half_network),
+                                                           test_dataset, NULL, NULL, true);
+
+    return (float)correct_predictions / test_dataset.num_rows;
+}
+
+// ==============[ PRUNING AND SPARSE INFERENCE - IMPLEMENTATION ]==============
+
+/**
+ * @brief Mencari nilai terkecil ke-(rank + 1) dengan quickselect (array diubah urutannya)
+ * @param values Array nilai
+ * @param count Jumlah elemen
+ * @param rank Indeks urutan yang dicari (0 = nilai terkecil)
+ * @return Nilai pada urutan rank
+ */
+static float
+prune_select_rank(float *values, size_t count, size_t rank)
+{
+    assert(rank < count);
+
+    size_t left = 0;
+    size_t right = count - 1;
+
+    while (left < right) {
+        // Pivot median-of-three agar data yang sudah terurut tidak menjadi kasus terburuk
+        size_t middle = left + (right - left) / 2;
+        float pivot = values[middle];
+        if ((values[left] <= pivot) == (pivot <= values[right])) pivot = values[middle];
+        else if ((pivot <= values[left]) == (values[left] <= values[right])) pivot = values[left];
+        else pivot = values[right];
+
+        size_t low = left;
+        size_t high = right;
+        while (low <= high) {
+            while (values[low] < pivot) ++low;
+            while (values[high] > pivot) --high;
+            if (low <= high) {
+                float temporary = values[low];
+                values[low] = values[high];
+                values[high] = temporary;
+                ++low;
+                if (high == 0) break;
+                --high;
+            }
+        }
+
+        if (rank <= high) right = high;
+        else if (rank >= low) left = low;
+        else return values[rank];
+    }
+
+    return values[rank];
+}
+
+/**
+ * @brief Memangkas weights dengan magnitude terkecil di setiap layer
+ *
+ * Threshold setiap layer adalah magnitude terkecil ke-k (quickselect pada
+ * salinan |w|); weights di bawah threshold dipangkas, lalu weights yang sama
+ * dengan threshold dipangkas berurutan sampai tepat k weights.
+ *
+ * @param arena_ptr Arena untuk alokasi mask
+ * @param network Neural network (harus memiliki parameter_buffer)
+ * @param target_sparsity Fraksi weights yang dipangkas per layer (0.0 - 1.0)
+ * @return Mask pruning
+ */
+struct PruningMask
+neural_network_prune_magnitude(struct MemoryArena *arena_ptr, struct NeuralNetwork network, float target_sparsity)
+{
+    assert(network.parameter_buffer != NULL);
+    assert(target_sparsity >= 0.0f && target_sparsity <= 1.0f);
+
+    struct PruningMask mask;
+    mask.parameter_count = network.parameter_count;
+    mask.pruned_count = 0;
+    mask.parameter_mask = arena_allocate_uninitialized(arena_ptr, sizeof(float) * network.parameter_count,
+                                                       ARENA_CACHE_LINE_SIZE);
+    assert(mask.parameter_mask != NULL);
+
+    for (size_t parameter_idx = 0; parameter_idx < network.parameter_count; ++parameter_idx)
+        mask.parameter_mask[parameter_idx] = 1.0f;
+
+    size_t max_weight_count = 0;
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        struct Matrix weights = network.weight_matrices[layer_idx];
+        if (weights.num_rows * weights.num_columns > max_weight_count)
+            max_weight_count = weights.num_rows * weights.num_columns;
+    }
+
+    struct MemoryArena magnitude_arena = arena_create(sizeof(float) * max_weight_count + ARENA_CACHE_LINE_SIZE);
+    float *magnitudes = arena_allocate_uninitialized(&magnitude_arena, sizeof(float) * max_weight_count,
+                                                     ARENA_CACHE_LINE_SIZE);
+    assert(magnitudes != NULL);
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        struct Matrix weights = network.weight_matrices[layer_idx];
+        size_t weight_count = weights.num_rows * weights.num_columns;
+        size_t prune_count = (size_t)((double)target_sparsity * (double)weight_count + 0.5);
+        float *layer_mask = mask.parameter_mask + (weights.element - network.parameter_buffer);
+
+        if (prune_count == 0) continue;
+
+        for (size_t weight_idx = 0; weight_idx < weight_count; ++weight_idx)
+            magnitudes[weight_idx] = fabsf(weights.element[weight_idx]);
+
+        float threshold = prune_select_rank(magnitudes, weight_count, prune_count - 1);
+        size_t remaining_count = prune_count;
+
+        for (size_t weight_idx = 0; weight_idx < weight_count; ++weight_idx) {
+            if (fabsf(weights.element[weight_idx]) < threshold) {
+                weights.element[weight_idx] = 0.0f;
+                layer_mask[weight_idx] = 0.0f;
+                --remaining_count;
+            }
+        }
+        for (size_t weight_idx = 0; weight_idx < weight_count && remaining_count > 0; ++weight_idx) {
+            if (layer_mask[weight_idx] != 0.0f && fabsf(weights.element[weight_idx]) == threshold) {
+                weights.element[weight_idx] = 0.0f;
+                layer_mask[weight_idx] = 0.0f;
+                --remaining_count;
+            }
+        }
+
+        mask.pruned_count += prune_count;
+    }
+
+    arena_destroy(&magnitude_arena);
+
+    return mask;
+}
+
+/**
+ * @brief Menghitung fraksi weights yang bernilai nol di seluruh layer
+ * @param network Neural network
+ * @return Sparsity antara 0.0 hingga 1.0
+ */
+float
+neural_network_get_weight_sparsity(struct NeuralNetwork network)
+{
+    size_t zero_count = 0;
+    size_t weight_count = 0;
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        struct Matrix weights = network.weight_matrices[layer_idx];
+        size_t layer_weight_count = weights.num_rows * weights.num_columns;
+
+        for (size_t weight_idx = 0; weight_idx < layer_weight_count; ++weight_idx)
+            if (weights.element[weight_idx] == 0.0f) ++zero_count;
+
+        weight_count += layer_weight_count;
+    }
+
+    return weight_count > 0 ? (float)zero_count / weight_count : 0.0f;
+}
+
+/**
+ * @brief Membuat network inferensi sparse dari network (biasanya hasil pruning)
+ * @param arena_ptr Arena untuk alokasi
+ * @param network Neural network sumber
+ * @return Network sparse
+ */
+struct SparseNeuralNetwork
+neural_network_create_sparse(struct MemoryArena *arena_ptr, struct NeuralNetwork network)
+{
+    assert(network.total_layers > 1);
+
+    struct SparseNeuralNetwork sparse_network;
+    sparse_network.total_layers = network.total_layers;
+    sparse_network.layer_sizes = arena_allocate_memory(arena_ptr, sizeof(size_t) * network.total_layers);
+    sparse_network.layers = arena_allocate_memory(arena_ptr, sizeof(struct SparseLayer) * (network.total_layers - 1));
+    sparse_network.weight_bytes = 0;
+
+    assert(sparse_network.layer_sizes != NULL && sparse_network.layers != NULL);
+
+    memcpy(sparse_network.layer_sizes, network.layer_sizes, sizeof(size_t) * network.total_layers);
+
+    for (size_t layer_idx = 0; layer_idx < network.total_layers - 1; ++layer_idx) {
+        struct Matrix weights = network.weight_matrices[layer_idx];
+        size_t weight_count = weights.num_rows * weights.num_columns;
+        size_t nonzero_count = 0;
+
+        for (size_t weight_idx = 0; weight_idx < weight_count; ++weight_idx)
+            if (weights.element[weight_idx] != 0.0f) ++nonzero_count;
+
+        struct SparseLayer layer = {0};
+        layer.use_sparse_kernel = (float)nonzero_count <= SPARSE_KERNEL_MAX_DENSITY * (float)weight_count;
+        layer.activation_type = network.activation_types[layer_idx + 1];
+        layer.biases = row_allocate(arena_ptr, weights.num_columns);
+        row_copy_data(layer.biases, network.bias_vectors[layer_idx]);
+
+        if (layer.use_sparse_kernel) {
+            layer.sparse_weights = sparse_matrix_create_transposed(arena_ptr, weights);
+            sparse_network.weight_bytes += (sizeof(float) + sizeof(uint32_t)) * layer.sparse_weights.nonzero_count
+                                         + sizeof(size_t) * (layer.sparse_weights.num_rows + 1);
+        } else {
+            layer.dense_weights = matrix_allocate(arena_ptr, weights.num_rows, weights.num_columns);
+            matrix_copy_data(layer.dense_weights, weights);
+            sparse_network.weight_bytes += sizeof(float) * weight_count;
+        }
+
+        sparse_network.layers[layer_idx] = layer;
+    }
+
+    return sparse_network;
+}
+
+/**
+ * @brief Membuat view arsitektur network sparse untuk alokasi aktivasi evaluasi
+ *
+ * Sama dengan half_precision_network_get_layout: hanya layer_sizes dan
+ * total_layers yang diisi.
+ */
+static struct NeuralNetwork
+sparse_network_get_layout(struct SparseNeuralNetwork sparse_network)
+{
+    struct NeuralNetwork layout = {0};
+    layout.layer_sizes = sparse_network.layer_sizes;
+    layout.total_layers = sparse_network.total_layers;
+    return layout;
+}
+
+/**
+ * @brief Forward pass batch network sparse (lihat neural_network_forward_pass_batch)
+ * @param sparse_network Network sparse
+ * @param batch_activations Matrix aktivasi tujuan
+ * @param input_batch Matrix input (minimal ukuran input layer kolom)
+ */
+static void
+sparse_network_forward_pass_batch(struct SparseNeuralNetwork sparse_network,
+                                  struct BatchActivations batch_activations, struct Matrix input_batch)
+{
+    assert(input_batch.num_rows <= batch_activations.batch_capacity);
+    assert(input_batch.num_columns >= sparse_network.layer_sizes[0]);
+
+    size_t batch_rows = input_batch.num_rows;
+    struct Matrix input_activation =
+        matrix_create_row_slice(batch_activations.activation_matrices[0], 0, batch_rows);
+
+    for (size_t row_idx = 0; row_idx < batch_rows; ++row_idx)
+        memcpy(&matrix_at(input_activation, row_idx, 0),
+               &matrix_at(input_batch, row_idx, 0),
+               sizeof(*input_activation.element) * input_activation.num_columns);
+
+    for (size_t layer_idx = 0; layer_idx < sparse_network.total_layers - 1; ++layer_idx) {
+        struct SparseLayer layer = sparse_network.layers[layer_idx];
+        struct Matrix current_activation =
+            matrix_create_row_slice(batch_activations.activation_matrices[layer_idx], 0, batch_rows);
+        struct Matrix next_activation =
+            matrix_create_row_slice(batch_activations.activation_matrices[layer_idx + 1], 0, batch_rows);
+
+        if (layer.use_sparse_kernel) {
+            sparse_matrix_multiply_bias_activation(next_activation, current_activation, layer.sparse_weights,
+                                                   layer.biases, layer.activation_type);
+        } else {
+            matrix_multiply_bias_activation(next_activation, current_activation, layer.dense_weights,
+                                            layer.biases, layer.activation_type);
+        }
+    }
+}
+
+/**
+ * @brief Workspace evaluasi network sparse (lihat struct EvaluationPass)
+ */
+static void *
+sparse_network_evaluation_workspace_allocate(struct MemoryArena *arena_ptr, const void *model)
+{
+    return evaluation_allocate_batch_activations(
+            arena_ptr, sparse_network_get_layout(*(const struct SparseNeuralNetwork *)model));
+}
+
+/**
+ * @brief Forward pass evaluasi network sparse (lihat struct EvaluationPass)
+ */
+static struct Matrix
+sparse_network_evaluation_forward_pass(const void *model, void *workspace, struct Matrix input_batch)
+{
+    const struct SparseNeuralNetwork *sparse_network = model;
+    struct BatchActivations *batch_activations = workspace;
+
+    sparse_network_forward_pass_batch(*sparse_network, *batch_activations, input_batch);
+    return batch_activations->activation_matrices[sparse_network->total_layers - 1];
+}
+
+/**
+ * @brief Menyiapkan evaluasi per potongan untuk network sparse
+ * @param sparse_network Pointer ke network sparse (harus tetap valid selama evaluasi)
+ * @return Struktur EvaluationPass
+ */
+static struct EvaluationPass
+sparse_network_get_evaluation_pass(const struct SparseNeuralNetwork *sparse_network)
+{
+    return (struct EvaluationPass) {
+        .model = sparse_network,
+        .input_size = sparse_network->layer_sizes[0],
+        .output_size = sparse_network->layer_sizes[sparse_network->total_layers - 1],
+        .arena_size = evaluation_arena_size(sparse_network_get_layout(*sparse_network)),
+        .workspace_allocate = sparse_network_evaluation_workspace_allocate,
+        .forward_pass = sparse_network_evaluation_forward_pass
+    };
+}
+
+/**
+ * @brief Melakukan prediksi dengan network sparse untuk banyak baris input sekaligus
+ * @param sparse_network Network sparse
+ * @param input_batch Matrix input (minimal ukuran input layer kolom)
+ * @param output_scores Matrix hasil skor kelas (baris sama dengan input, kolom = ukuran output layer)
+ * @param output_labels Array hasil indeks kelas terbesar per baris (boleh NULL)
+ */
+void
+sparse_network_predict_batch(struct SparseNeuralNetwork sparse_network, struct Matrix input_batch,
+                             struct Matrix output_scores, size_t *output_labels)
+{
+    evaluation_process_chunks(sparse_network_get_evaluation_pass(&sparse_network), input_batch,
+                              &output_scores, output_labels, false);
+}
+
+/**
+ * @brief Menghitung akurasi klasifikasi network sparse
+ * @param sparse_network Network sparse
+ * @param test_dataset Dataset untuk evaluasi
+ * @return Akurasi antara 0.0 hingga 1.0
+ */
+float
+sparse_network_calculate_accuracy(struct SparseNeuralNetwork sparse_network, struct Matrix test_dataset)
+{
+    size_t correct_predictions = evaluation_process_chunks(sparse_network_get_evaluation_pass(&sparse_network),
+                                                           test_dataset, NULL, NULL, true);
+
+    return (float)correct_predictions / test_dataset.num_rows;
 }
 
 /* vim: set ts=4 sw=4 sts=4 et */
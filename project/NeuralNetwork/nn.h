@@ -28,9 +28,22 @@ extern "C" {
 // ==================================[ MACROS ]=================================
 
 /**
- * @brief Makro untuk menghasilkan bilangan float random antara 0-1
+ * @brief Ukuran cache line; alignment yang disarankan untuk buffer SIMD dari arena
  */
-#define RAND_FLOAT() ((float)(rand()) / (float)(RAND_MAX))
+#define ARENA_CACHE_LINE_SIZE ((size_t)64)
+
+/**
+ * @brief Ukuran huge page (x86-64 dan AArch64 dengan halaman dasar 4 KB)
+ */
+#define ARENA_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+/**
+ * @brief Density maksimum (nonzero / total weights) di mana layer memakai kernel CSR
+ *
+ * Di atas batas ini GEMM dense yang ter-blok lebih cepat dari sparse x dense;
+ * nilai dikalibrasi dengan benchmark/bench_sparse.c.
+ */
+#define SPARSE_KERNEL_MAX_DENSITY 0.3f
 
 /**
  * @brief Makro untuk mengakses elemen matrix
@@ -61,21 +74,127 @@ enum ActivationType
     ACTIVATION_NONE     // Tanpa aktivasi (linear)
 };
 
+/**
+ * @brief Enum untuk presisi fungsi aktivasi sigmoid dan tanh
+ *
+ * Mode FAST memakai aproksimasi exp polinomial yang divektorisasi (tanpa
+ * memanggil libm). Error maksimum terhadap referensi double pada [-20, 20]:
+ * sigmoid absolut <= 9.0e-8 (relatif <= 1.9e-7),
+ * tanh absolut <= 7.9e-8 (relatif <= 1.5e-7).
+ * ReLU dan turunan semua aktivasi identik di kedua mode.
+ */
+enum ActivationPrecision
+{
+    ACTIVATION_PRECISION_EXACT, // Memakai expf/tanhf dari libm
+    ACTIVATION_PRECISION_FAST   // Aproksimasi polinomial yang divektorisasi
+};
+
+/**
+ * @brief Sumber memori chunk arena
+ */
+enum ArenaBackend
+{
+    ARENA_BACKEND_MALLOC,                   // Halaman biasa dari heap
+    ARENA_BACKEND_HUGETLB,                  // mmap dengan MAP_HUGETLB (huge page yang dipesan sistem)
+    ARENA_BACKEND_TRANSPARENT_HUGE_PAGES,   // mmap biasa dengan madvise(MADV_HUGEPAGE)
+    ARENA_BACKEND_COUNT
+};
+
+/**
+ * @brief Format penyimpanan weights 16-bit
+ */
+enum HalfPrecisionFormat
+{
+    HALF_PRECISION_FP16,    // IEEE 754 binary16 (10 bit mantissa, range +-65504)
+    HALF_PRECISION_BF16     // bfloat16 (range sama dengan fp32, 7 bit mantissa)
+};
+
 // ================================[ STRUCTURES ]===============================
 
+/**
+ * @brief State generator random xoshiro256** untuk satu stream
+ *
+ * Setiap stream independen dan tidak memakai state global, sehingga aman
+ * dipakai per thread tanpa lock. Stream dengan seed dan stream_id yang sama
+ * selalu menghasilkan urutan yang sama.
+ */
+struct RandomStream
+{
+    uint64_t state[4];  // State 256-bit (tidak pernah semuanya nol)
+};
+
+/**
+ * @brief Satu blok memori milik arena (opaque, lihat nn.c)
+ */
+struct ArenaChunk;
+
+/**
+ * @brief Jumlah maksimum tag berbeda di histogram statistik arena
+ */
+#define ARENA_STATISTICS_MAX_TAGS 16
+
+/**
+ * @brief Statistik alokasi untuk satu tag (lihat arena_set_tag)
+ */
+struct ArenaTagStatistics
+{
+    const char *tag;            // Nama tag (NULL untuk alokasi tanpa tag)
+    size_t allocation_count;    // Jumlah alokasi
+    size_t requested_bytes;     // Total byte yang diminta
+};
+
+/**
+ * @brief Statistik pemakaian arena (lihat arena_enable_statistics)
+ *
+ * padded_bytes - requested_bytes adalah byte yang terbuang untuk alignment.
+ * peak_used_bytes adalah ukuran arena_create yang cukup agar arena tidak
+ * perlu tumbuh.
+ */
+struct ArenaStatistics
+{
+    size_t allocation_count;    // Jumlah alokasi sejak statistik diaktifkan
+    size_t requested_bytes;     // Total byte yang diminta
+    size_t padded_bytes;        // Total byte termasuk padding alignment
+    size_t used_bytes;          // Byte terpakai saat ini
+    size_t peak_used_bytes;     // High-water mark used_bytes
+    size_t reserved_bytes;      // Kapasitas semua chunk milik arena
+    size_t chunk_count;         // Jumlah chunk milik arena
+    size_t tag_count;           // Jumlah entri valid di tags
+    struct ArenaTagStatistics tags[ARENA_STATISTICS_MAX_TAGS]; // Histogram per tag (tag berlebih masuk entri terakhir)
+};
+
 /**
  * @brief Struktur arena untuk manajemen memori efisien
  *
  * Arena allocator memungkinkan alokasi memori yang cepat dan mudah
- * untuk reset semua alokasi sekaligus
+ * untuk reset semua alokasi sekaligus. Saat chunk aktif penuh, arena
+ * menyambung chunk baru, sehingga ukuran awal cukup berupa perkiraan.
+ * Alamat yang sudah dialokasikan tidak pernah berpindah.
  */
 struct MemoryArena
 {
-    size_t total_capacity;      // Kapasitas total arena dalam satuan buffer
-    size_t used_buffers;        // Jumlah buffer yang sudah digunakan
-    uintptr_t *memory_buffer;   // Pointer ke buffer memori
+    struct ArenaChunk *current_chunk;   // Chunk aktif (chunk lama terhubung di belakangnya)
+    struct ArenaChunk *free_chunks;     // Chunk yang dilepas restore/reset, dipakai ulang sebelum malloc
+    size_t chunk_size;                  // Kapasitas minimum chunk baru dalam bytes
+    bool use_huge_pages;                // Chunk besar dialokasikan dengan huge page (arena_create_huge_pages)
+    struct ArenaStatistics *statistics; // Statistik pemakaian (NULL jika tidak diaktifkan)
+    const char *current_tag;            // Tag untuk alokasi berikutnya (lihat arena_set_tag)
+};
+
+/**
+ * @brief Posisi arena yang disimpan arena_save untuk dikembalikan arena_restore
+ */
+struct ArenaMarker
+{
+    struct ArenaChunk *chunk;   // Chunk aktif saat marker dibuat (NULL jika arena kosong)
+    size_t used_bytes;          // Byte terpakai di chunk tersebut
 };
 
+/**
+ * @brief Pool arena scratch per thread (opaque, lihat scratch_arena_pool_create)
+ */
+struct ScratchArenaPool;
+
 /**
  * @brief Struktur untuk merepresentasikan matrix 2D
  */
@@ -95,20 +214,278 @@ struct Row
     float *element;     // Pointer ke elemen-elemen row
 };
 
+/**
+ * @brief Matrix dengan elemen 16-bit (fp16 atau bf16), layout sama dengan Matrix
+ */
+struct HalfMatrix
+{
+    size_t num_rows;                    // Jumlah baris
+    size_t num_columns;                 // Jumlah kolom
+    uint16_t *element;                  // Pointer ke elemen 16-bit
+    enum HalfPrecisionFormat format;    // Format elemen
+};
+
 /**
  * @brief Struktur utama Neural Network
  *
- * Berisi semua komponen yang diperlukan untuk neural network:
- * arsitektur, weights, biases, aktivasi, dan tipe aktivasi
+ * Berisi model saja: arsitektur, weights, biases, dan tipe aktivasi.
+ * Forward pass tidak menulis ke struktur ini, sehingga satu model bisa
+ * dipakai bersamaan oleh banyak thread, masing-masing dengan context sendiri.
+ *
+ * Network dari neural_network_allocate menyimpan semua parameter berurutan
+ * (W0, b0, W1, b1, ...) di parameter_buffer; setiap blok dimulai di batas
+ * 64 byte dan sisa bloknya berisi padding nol.
+ * weight_matrices/bias_vectors adalah view ke buffer itu. Network yang
+ * disusun manual boleh memakai parameter_buffer = NULL.
  */
 struct NeuralNetwork
 {
     size_t *layer_sizes;                    // Array ukuran setiap layer
     size_t total_layers;                    // Jumlah layer
-    struct Matrix *weight_matrices;         // Array matrix weights antar layer
-    struct Row *bias_vectors;               // Array bias untuk setiap layer
-    struct Row *activation_vectors;         // Array aktivasi untuk setiap layer
+    struct Matrix *weight_matrices;         // Array matrix weights antar layer (view)
+    struct Row *bias_vectors;               // Array bias untuk setiap layer (view)
+    enum ActivationType *activation_types;  // Array tipe aktivasi untuk setiap layer
+    float *parameter_buffer;                // Buffer flat semua weights dan biases (boleh NULL)
+    size_t parameter_count;                 // Jumlah float di parameter_buffer
+};
+
+/**
+ * @brief Satu layer network terkuantisasi int8 (lihat neural_network_quantize)
+ *
+ * Weights disimpan per panel 16 kolom output dengan layout
+ * [input_groups][16 kolom][4 input], setiap panel dimulai di batas 64 byte.
+ * Input dibulatkan ke kelipatan 4 dan output ke kelipatan 16, sisanya nol.
+ */
+struct QuantizedLayer
+{
+    size_t input_size;                      // Jumlah input layer
+    size_t output_size;                     // Jumlah output layer
+    size_t input_groups;                    // Jumlah grup 4 input (dibulatkan ke atas)
+    size_t padded_output_size;              // output_size dibulatkan ke kelipatan 16
+    int8_t *packed_weights;                 // Weights int8 terpacking per panel
+    float *weight_scales;                   // Skala weights per kolom output (padded)
+    int32_t *weight_offsets;                // Koreksi zero point aktivasi per kolom output (padded)
+    float *biases;                          // Bias fp32 per kolom output (padded)
+    enum ActivationType activation_type;    // Aktivasi output layer
+};
+
+/**
+ * @brief Neural network terkuantisasi int8 untuk inferensi
+ *
+ * Weights int8 dengan satu skala per kolom output (per output channel);
+ * aktivasi dikuantisasi dinamis per baris saat forward pass. Akumulasi
+ * int32, lalu dequantize, bias, dan aktivasi dilakukan dalam fp32.
+ */
+struct QuantizedNeuralNetwork
+{
+    size_t *layer_sizes;            // Array ukuran setiap layer
+    size_t total_layers;            // Jumlah layer
+    struct QuantizedLayer *layers;  // Array layer (total_layers - 1)
+    size_t weight_bytes;            // Total bytes weights int8 terpacking
+};
+
+/**
+ * @brief Neural network dengan weights 16-bit untuk inferensi
+ *
+ * Weights disimpan fp16/bf16 dan dilebarkan ke fp32 saat packing GEMM;
+ * bias, aktivasi, dan akumulasi tetap fp32. Untuk training, NeuralNetwork
+ * fp32 berperan sebagai master weights dan salinan 16-bit diperbarui
+ * dengan half_precision_network_update_weights.
+ */
+struct HalfPrecisionNeuralNetwork
+{
+    size_t *layer_sizes;                    // Array ukuran setiap layer
+    size_t total_layers;                    // Jumlah layer
+    struct HalfMatrix *weight_matrices;     // Array matrix weights 16-bit antar layer
+    struct Row *bias_vectors;               // Array bias fp32 untuk setiap layer
     enum ActivationType *activation_types;  // Array tipe aktivasi untuk setiap layer
+    enum HalfPrecisionFormat format;        // Format weights
+};
+
+/**
+ * @brief Mask hasil pruning dengan layout sama dengan parameter_buffer network
+ */
+struct PruningMask
+{
+    float *parameter_mask;      // 1 untuk parameter yang dipertahankan, 0 untuk weights yang dipangkas
+    size_t parameter_count;     // Jumlah elemen mask (sama dengan network.parameter_count)
+    size_t pruned_count;        // Jumlah weights yang dipangkas
+};
+
+/**
+ * @brief Matrix sparse dalam format CSR (compressed sparse row)
+ *
+ * Untuk weights layer, yang disimpan adalah transpose W: baris = neuron
+ * output, kolom = indeks input, sehingga satu baris CSR menghasilkan satu
+ * output untuk seluruh baris batch.
+ */
+struct SparseMatrix
+{
+    size_t num_rows;            // Jumlah baris
+    size_t num_columns;         // Jumlah kolom
+    size_t nonzero_count;       // Jumlah elemen nonzero
+    size_t *row_offsets;        // Awal nonzero setiap baris (num_rows + 1 elemen)
+    uint32_t *column_indexes;   // Indeks kolom setiap nonzero
+    float *values;              // Nilai setiap nonzero
+};
+
+/**
+ * @brief Satu layer network sparse: CSR atau dense, dipilih dari density weights
+ */
+struct SparseLayer
+{
+    bool use_sparse_kernel;                 // true jika density <= SPARSE_KERNEL_MAX_DENSITY
+    struct SparseMatrix sparse_weights;     // Transpose weights dalam CSR (jika use_sparse_kernel)
+    struct Matrix dense_weights;            // Salinan weights dense (jika tidak)
+    struct Row biases;                      // Bias layer
+    enum ActivationType activation_type;    // Aktivasi output layer
+};
+
+/**
+ * @brief Neural network untuk inferensi dengan weights sparse (hasil pruning)
+ */
+struct SparseNeuralNetwork
+{
+    size_t *layer_sizes;        // Array ukuran setiap layer
+    size_t total_layers;        // Jumlah layer
+    struct SparseLayer *layers; // Array layer (total_layers - 1)
+    size_t weight_bytes;        // Total bytes weights (CSR: nilai + indeks + offset baris)
+};
+
+/**
+ * @brief Context eksekusi forward pass untuk satu sample
+ *
+ * Memiliki buffer aktivasi setiap layer. Setiap thread yang menjalankan
+ * inferensi memakai context-nya sendiri.
+ */
+struct NeuralNetworkContext
+{
+    size_t total_layers;            // Jumlah layer (harus sama dengan network)
+    struct Row *activation_vectors; // Array aktivasi untuk setiap layer
+};
+
+/**
+ * @brief Struktur aktivasi untuk forward pass dalam mode batch
+ *
+ * Setiap layer memiliki satu matrix berukuran batch_capacity x ukuran layer,
+ * sehingga satu layer cukup diproses dengan satu perkalian matrix (GEMM)
+ * untuk seluruh sample dalam batch
+ */
+struct BatchActivations
+{
+    size_t batch_capacity;              // Jumlah baris maksimum per batch
+    struct Matrix *activation_matrices; // Array matrix aktivasi untuk setiap layer
+};
+
+struct GradientWorkspace;
+
+/**
+ * @brief Stream dataset out-of-core dengan thread loader (opaque, lihat dataset_stream_open)
+ */
+struct DatasetStream;
+
+/**
+ * @brief Workspace training yang dialokasikan sekali per training
+ *
+ * Berisi gradient network, aktivasi, dan error untuk setiap partisi thread,
+ * sehingga setiap mini-batch tidak perlu mengalokasikan dan mengosongkan
+ * buffer seukuran model lagi.
+ */
+struct TrainingWorkspace
+{
+    size_t batch_capacity;                  // Jumlah baris maksimum per batch
+    size_t partition_count;                 // Jumlah partisi (thread) maksimum
+    size_t partition_capacity;              // Jumlah baris maksimum per partisi
+    struct GradientWorkspace *partitions;   // Workspace setiap partisi (internal nn.c)
+};
+
+/**
+ * @brief Enum untuk algoritma optimizer
+ */
+enum OptimizerType
+{
+    OPTIMIZER_SGD,      // Gradient descent biasa
+    OPTIMIZER_MOMENTUM, // SGD dengan momentum
+    OPTIMIZER_RMSPROP,  // RMSProp (learning rate adaptif per parameter)
+    OPTIMIZER_ADAM      // Adam (momentum + RMSProp dengan koreksi bias)
+};
+
+/**
+ * @brief Struktur optimizer beserta state-nya
+ *
+ * State (velocity / moment) berukuran sama dengan parameter_buffer network
+ * dan dialokasikan dari arena. Hyperparameter boleh diubah setelah
+ * optimizer_create dan sebelum step pertama. parameter_mask dapat diisi
+ * dengan mask dari neural_network_prune_magnitude untuk fine-tuning network
+ * yang sudah dipangkas: parameter dikalikan mask setelah setiap update.
+ */
+struct Optimizer
+{
+    enum OptimizerType optimizer_type;  // Algoritma yang dipakai
+    float learning_rate;                // Learning rate
+    float beta1;                        // Momentum (MOMENTUM) / decay moment pertama (ADAM)
+    float beta2;                        // Decay rata-rata kuadrat gradient (RMSPROP, ADAM)
+    float epsilon;                      // Penyebut minimum (RMSPROP, ADAM)
+    size_t step_count;                  // Jumlah step yang sudah dijalankan
+    size_t parameter_count;             // Jumlah parameter network
+    float *first_moment;                // Velocity (MOMENTUM) / moment pertama (ADAM)
+    float *second_moment;               // Rata-rata kuadrat gradient (RMSPROP, ADAM)
+    const float *parameter_mask;        // Mask pruning yang diterapkan setiap step (NULL jika tidak ada)
+};
+
+/**
+ * @brief File yang dipetakan ke memori
+ *
+ * Pada sistem POSIX isinya adalah halaman file yang di-mmap (dibagi lewat
+ * page cache antar proses); di sistem lain file dibaca ke buffer heap yang
+ * 64-byte aligned.
+ */
+struct MappedFile
+{
+    void *base_address;         // Awal mapping / buffer file
+    size_t mapped_size;         // Ukuran mapping dalam bytes
+    bool is_memory_mapped;      // true jika base_address berasal dari mmap
+};
+
+/**
+ * @brief Statistik pemuatan dataset CSV
+ */
+struct CsvLoadStatistics
+{
+    size_t row_count;           // Jumlah baris data yang dimuat
+    size_t column_count;        // Jumlah kolom numerik di file
+    size_t skipped_row_count;   // Baris yang dilewati karena tidak valid
+    size_t file_bytes;          // Ukuran file dalam bytes
+    double elapsed_seconds;     // Waktu pemuatan (dua pass) dalam detik
+};
+
+/**
+ * @brief Parameter normalisasi min-max per kolom input
+ *
+ * Disimpan bersama dataset biner agar data baru (misalnya input inference)
+ * bisa dinormalisasi dengan skala yang sama seperti data training.
+ */
+struct NormalizationParameters
+{
+    size_t column_count;        // Jumlah kolom yang dinormalisasi
+    float *column_min_values;   // Nilai minimum asli setiap kolom
+    float *column_max_values;   // Nilai maksimum asli setiap kolom
+    float new_min_value;        // Nilai minimum setelah normalisasi
+    float new_max_value;        // Nilai maksimum setelah normalisasi
+};
+
+/**
+ * @brief Dataset yang dimuat dari file biner tanpa disalin
+ *
+ * data dan parameter normalisasi menunjuk langsung ke mapping file.
+ */
+struct BinaryDataset
+{
+    struct Matrix data;                             // Baris: input diikuti output (one-hot)
+    size_t input_column_count;                      // Jumlah kolom input
+    size_t output_column_count;                     // Jumlah kolom output
+    struct NormalizationParameters normalization;   // Normalisasi yang sudah diterapkan ke input
+    struct MappedFile mapping;                      // Mapping file (lepas dengan dataset_unload_binary)
 };
 
 /**
@@ -119,10 +496,27 @@ struct NeuralNetwork
 struct BatchProcessor
 {
     size_t current_start_idx;   // Indeks awal batch saat ini
-    float accumulated_cost;     // Akumulasi cost dari batch
+    float accumulated_cost;     // Akumulasi cost batch (sebelum update parameter)
     bool is_epoch_finished;     // Flag apakah sudah selesai semua batch
 };
 
+/**
+ * @brief Sampler mini-batch berbasis permutasi indeks
+ *
+ * Yang diacak setiap epoch hanya array indeks uint32_t; baris dataset
+ * dikumpulkan ke batch_buffer sebelum forward pass. Dataset tidak pernah
+ * ditulis, sehingga bisa read-only dan dipakai bersama banyak sampler.
+ */
+struct BatchSampler
+{
+    size_t row_count;           // Jumlah baris dataset
+    size_t batch_size;          // Jumlah baris per batch (batch terakhir bisa lebih kecil)
+    size_t current_position;    // Posisi berikutnya di permutasi
+    uint32_t *permutation;      // Urutan baris epoch ini
+    struct Matrix batch_buffer; // Buffer batch kontigu, 64-byte aligned
+    struct RandomStream random_stream; // Stream untuk shuffle permutasi
+};
+
 // ===========================[ ACTIVATION FUNCTIONS ]==========================
 
 /**
@@ -162,116 +556,520 @@ float activation_apply(float input_value, enum ActivationType activation_type);
  */
 float activation_compute_derivative(float activated_value, enum ActivationType activation_type);
 
-// ============================[ MEMORY MANAGEMENT ]============================
-
 /**
- * @brief Membuat arena baru dengan ukuran tertentu
- * @param size_in_bytes Ukuran arena dalam bytes
- * @return Struktur MemoryArena yang siap digunakan
+ * @brief Menerapkan fungsi aktivasi ke seluruh array sekaligus (in-place)
+ *
+ * Memakai kernel SIMD aktif dan presisi yang diatur activation_set_precision.
+ *
+ * @param values Array nilai yang akan diproses
+ * @param count Jumlah elemen
+ * @param activation_type Tipe aktivasi yang akan diterapkan
  */
-struct MemoryArena arena_create(size_t size_in_bytes);
+void activation_apply_array(float *values, size_t count, enum ActivationType activation_type);
 
 /**
- * @brief Mengalokasikan memori dari arena
- * @param arena_ptr Pointer ke arena (NULL untuk malloc biasa)
- * @param size_in_bytes Ukuran memori yang dibutuhkan dalam bytes
- * @return Pointer ke memori yang dialokasikan, atau NULL jika gagal
+ * @brief Mengalikan setiap gradient dengan turunan aktivasi (untuk backpropagation)
+ * @param gradient_values Array gradient (hasil disimpan di sini)
+ * @param activated_values Array nilai yang sudah melalui aktivasi
+ * @param count Jumlah elemen
+ * @param activation_type Tipe aktivasi
  */
-void *arena_allocate_memory(struct MemoryArena *arena_ptr, size_t size_in_bytes);
+void activation_multiply_derivative_array(float *gradient_values,
+                                          const float *activated_values,
+                                          size_t count,
+                                          enum ActivationType activation_type);
 
 /**
- * @brief Mereset arena untuk menggunakan ulang memori
- * @param arena_ptr Pointer ke arena yang akan direset
+ * @brief Mengatur presisi sigmoid dan tanh untuk semua operasi array/matrix
+ *
+ * Nilai awal adalah ACTIVATION_PRECISION_EXACT, atau ACTIVATION_PRECISION_FAST
+ * jika library dibangun dengan opsi CMake NN_FAST_ACTIVATION=ON.
+ *
+ * @param precision Presisi yang akan dipakai
  */
-void arena_reset(struct MemoryArena *arena_ptr);
-
-// ============================[ MATRIX OPERATIONS ]============================
+void activation_set_precision(enum ActivationPrecision precision);
 
 /**
- * @brief Mengalokasikan matrix baru
- * @param arena_ptr Arena untuk alokasi memori
- * @param num_rows Jumlah baris
- * @param num_columns Jumlah kolom
- * @return Matrix yang telah dialokasikan
+ * @brief Mendapatkan presisi sigmoid dan tanh yang sedang dipakai
+ * @return Presisi aktif
  */
-struct Matrix matrix_allocate(struct MemoryArena *arena_ptr, size_t num_rows, size_t num_columns);
+enum ActivationPrecision activation_get_precision(void);
+
+// ============================[ MEMORY MANAGEMENT ]============================
 
 /**
- * @brief Mendapatkan row tertentu dari matrix
- * @param source_matrix Matrix sumber
- * @param row_index Indeks baris yang diinginkan
- * @return Struktur Row yang merepresentasikan baris tersebut
+ * @brief Membuat arena baru dengan ukuran tertentu
+ * @param size_in_bytes Ukuran chunk pertama dan minimum chunk berikutnya (0 untuk 1 MB)
+ * @return Struktur MemoryArena yang siap digunakan
  */
-struct Row matrix_get_row(struct Matrix source_matrix, size_t row_index);
+struct MemoryArena arena_create(size_t size_in_bytes);
 
 /**
- * @brief Mengkonversi row menjadi matrix 1x N
- * @param source_row Row yang akan dikonversi
- * @return Matrix dengan 1 baris
+ * @brief Membuat arena yang chunk-nya memakai huge page
+ *
+ * Chunk minimal ARENA_HUGE_PAGE_SIZE dialokasikan dengan mmap MAP_HUGETLB.
+ * Jika sistem tidak menyediakan huge page yang dipesan, chunk dipetakan
+ * dengan alignment 2 MB dan madvise(MADV_HUGEPAGE) untuk transparent huge
+ * page; jika itu pun gagal (atau tanpa mmap), dipakai malloc biasa. Backend
+ * yang benar-benar dipakai dihitung oleh arena_get_backend_chunk_count.
+ * Cocok untuk parameter model dan dataset besar, yang akses GEMM dan
+ * shuffle-nya sering meleset di TLB dengan halaman 4 KB.
+ *
+ * @param size_in_bytes Ukuran chunk pertama dan minimum chunk berikutnya (0 untuk 1 MB)
+ * @return Struktur MemoryArena yang siap digunakan
  */
-struct Matrix row_convert_to_matrix(struct Row source_row);
+struct MemoryArena arena_create_huge_pages(size_t size_in_bytes);
 
 /**
- * @brief Membuat slice (potongan) dari row
- * @param source_row Row sumber
- * @param start_index Indeks awal
- * @param slice_length Jumlah kolom yang diambil
- * @return Row baru yang merupakan potongan dari row asli
+ * @brief Jumlah chunk arena (seluruh proses) yang dialokasikan dengan backend tertentu
+ * @param backend Backend
+ * @return Jumlah chunk sejak program mulai
  */
-struct Row row_create_slice(struct Row source_row, size_t start_index, size_t slice_length);
+size_t arena_get_backend_chunk_count(enum ArenaBackend backend);
 
 /**
- * @brief Mencari indeks dengan nilai maksimum dalam row
- * @param input_row Row yang akan dicari nilai maksimumnya
- * @return Indeks elemen dengan nilai terbesar
+ * @brief Nama backend arena (untuk logging)
+ * @param backend Backend
+ * @return Nama backend
  */
-size_t row_find_max_index(struct Row input_row);
+const char *arena_get_backend_name(enum ArenaBackend backend);
 
 /**
- * @brief Membuat slice dari beberapa baris matrix
- * @param source_matrix Matrix sumber
- * @param start_row Baris awal
- * @param num_rows Jumlah baris yang diambil
- * @return Matrix baru yang merupakan potongan dari matrix asli
+ * @brief Mengalokasikan memori dari arena (diisi nol)
+ * @param arena_ptr Pointer ke arena (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param size_in_bytes Ukuran memori yang dibutuhkan dalam bytes
+ * @return Pointer ke memori yang dialokasikan, atau NULL jika gagal
  */
-struct Matrix matrix_create_row_slice(struct Matrix source_matrix, size_t start_row, size_t num_rows);
+void *arena_allocate_memory(struct MemoryArena *arena_ptr, size_t size_in_bytes);
 
 /**
- * @brief Mengisi semua elemen matrix dengan nilai tertentu
- * @param target_matrix Matrix yang akan diisi
- * @param fill_value Nilai yang akan diisikan
+ * @brief Mengalokasikan memori dengan alignment tertentu (diisi nol)
+ * @param arena_ptr Pointer ke arena (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param size_in_bytes Ukuran memori yang dibutuhkan dalam bytes
+ * @param alignment Alignment dalam bytes (pangkat dua, misalnya ARENA_CACHE_LINE_SIZE)
+ * @return Pointer ke memori yang dialokasikan, atau NULL jika gagal
  */
-void matrix_fill_with_value(struct Matrix target_matrix, float fill_value);
+void *arena_allocate_aligned(struct MemoryArena *arena_ptr, size_t size_in_bytes, size_t alignment);
 
 /**
- * @brief Mengisi matrix dengan nilai random dalam range tertentu
- * @param target_matrix Matrix yang akan diisi
- * @param min_value Nilai minimum
- * @param max_value Nilai maksimum
+ * @brief Mengalokasikan memori dengan alignment tertentu tanpa mengisi nol
+ *
+ * Untuk buffer yang selalu ditulis penuh sebelum dibaca (aktivasi, buffer
+ * batch), sehingga tidak ada sapuan memset yang sia-sia.
+ *
+ * @param arena_ptr Pointer ke arena (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param size_in_bytes Ukuran memori yang dibutuhkan dalam bytes
+ * @param alignment Alignment dalam bytes (pangkat dua)
+ * @return Pointer ke memori yang dialokasikan, atau NULL jika gagal
  */
-void matrix_fill_random(struct Matrix target_matrix, float min_value, float max_value);
+void *arena_allocate_uninitialized(struct MemoryArena *arena_ptr, size_t size_in_bytes, size_t alignment);
 
 /**
- * @brief Menjumlahkan dua matrix (element-wise)
- * @param destination_matrix Matrix pertama (hasil akan disimpan di sini)
- * @param source_matrix Matrix kedua
+ * @brief Membebaskan memori yang dialokasikan dengan arena_ptr NULL
+ *
+ * Memori heap yang aligned tidak selalu boleh dibebaskan dengan free (MSVC
+ * memakai _aligned_malloc), jadi semua alokasi tanpa arena dibebaskan lewat
+ * fungsi ini, termasuk elemen matrix dan buffer hasil loader.
+ *
+ * @param memory Pointer dari alokasi dengan arena_ptr NULL (boleh NULL)
  */
-void matrix_add_elementwise(struct Matrix destination_matrix, struct Matrix source_matrix);
+void arena_free_memory(void *memory);
 
 /**
- * @brief Perkalian matrix (dot product)
- * @param result_matrix Matrix tujuan untuk hasil
- * @param matrix_a Matrix pertama
- * @param matrix_b Matrix kedua
+ * @brief Menyimpan posisi arena saat ini
+ * @param arena_ptr Pointer ke arena
+ * @return Marker untuk arena_restore
  */
-void matrix_multiply_dot_product(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b);
+struct ArenaMarker arena_save(struct MemoryArena *arena_ptr);
 
 /**
- * @brief Menyalin isi source_matrix ke destination_matrix
- * @param destination_matrix Matrix tujuan
- * @param source_matrix Matrix sumber
+ * @brief Melepas semua alokasi sejak marker dibuat
+ *
+ * Chunk yang ditambahkan setelah marker disimpan untuk dipakai ulang,
+ * tidak dikembalikan ke sistem.
+ *
+ * @param arena_ptr Pointer ke arena
+ * @param marker Marker dari arena_save pada arena yang sama
  */
-void matrix_copy_data(struct Matrix destination_matrix, struct Matrix source_matrix);
+void arena_restore(struct MemoryArena *arena_ptr, struct ArenaMarker marker);
+
+/**
+ * @brief Mereset arena untuk menggunakan ulang memori
+ * @param arena_ptr Pointer ke arena yang akan direset
+ */
+void arena_reset(struct MemoryArena *arena_ptr);
+
+/**
+ * @brief Membebaskan seluruh memori milik arena
+ * @param arena_ptr Pointer ke arena yang akan dibebaskan
+ */
+void arena_destroy(struct MemoryArena *arena_ptr);
+
+/**
+ * @brief Mengaktifkan statistik pemakaian arena
+ *
+ * Tanpa statistik, jalur alokasi hanya menambah satu pemeriksaan pointer.
+ * Alokasi sebelum statistik diaktifkan dihitung sebagai used_bytes saja.
+ *
+ * @param arena_ptr Pointer ke arena
+ */
+void arena_enable_statistics(struct MemoryArena *arena_ptr);
+
+/**
+ * @brief Mengatur tag untuk alokasi berikutnya di histogram statistik
+ *
+ * Tag tidak disalin, jadi harus tetap valid selama arena hidup (misalnya
+ * string literal).
+ *
+ * @param arena_ptr Pointer ke arena
+ * @param tag Nama tag (NULL untuk tanpa tag)
+ * @return Tag sebelumnya, untuk dikembalikan setelah selesai
+ */
+const char *arena_set_tag(struct MemoryArena *arena_ptr, const char *tag);
+
+/**
+ * @brief Mengambil salinan statistik arena
+ * @param arena_ptr Pointer ke arena
+ * @param statistics_output Statistik (semua nol jika statistik tidak diaktifkan)
+ * @return true jika statistik diaktifkan
+ */
+bool arena_get_statistics(const struct MemoryArena *arena_ptr, struct ArenaStatistics *statistics_output);
+
+/**
+ * @brief Mencetak statistik arena ke console
+ * @param arena_ptr Pointer ke arena
+ * @param arena_name Nama arena (untuk label)
+ */
+void arena_print_statistics(const struct MemoryArena *arena_ptr, const char *arena_name);
+
+/**
+ * @brief Membuat pool arena scratch, satu arena per worker
+ *
+ * Setiap arena menempati cache line sendiri dan chunk pertamanya dialokasikan
+ * serta disentuh pertama kali oleh thread OpenMP bernomor sama, sehingga
+ * halamannya berada di node NUMA thread tersebut. Alokasi dari arena yang
+ * dipinjam tetap pointer bump biasa tanpa lock.
+ *
+ * @param arena_count Jumlah arena (0 untuk omp_get_max_threads())
+ * @param arena_size_in_bytes Ukuran chunk pertama setiap arena
+ * @return Pool baru
+ */
+struct ScratchArenaPool *scratch_arena_pool_create(size_t arena_count, size_t arena_size_in_bytes);
+
+/**
+ * @brief Meminjam arena dari pool (thread-safe, tidak pernah menunggu)
+ *
+ * Arena bernomor sama dengan thread OpenMP pemanggil dicoba lebih dulu;
+ * hanya pemeriksaan flag slot yang berada di dalam critical section.
+ *
+ * @param pool Pool arena
+ * @return Arena yang dipinjam, atau NULL jika semua arena sedang dipinjam
+ */
+struct MemoryArena *scratch_arena_pool_acquire(struct ScratchArenaPool *pool);
+
+/**
+ * @brief Mengembalikan arena ke pool dan melepas semua alokasi selama dipinjam
+ * @param pool Pool arena
+ * @param arena_ptr Arena dari scratch_arena_pool_acquire
+ */
+void scratch_arena_pool_release(struct ScratchArenaPool *pool, struct MemoryArena *arena_ptr);
+
+/**
+ * @brief Membebaskan pool beserta semua arenanya
+ * @param pool Pool arena (tidak boleh ada arena yang masih dipinjam)
+ */
+void scratch_arena_pool_destroy(struct ScratchArenaPool *pool);
+
+/**
+ * @brief Memetakan seluruh file ke memori
+ *
+ * Mapping read-only dibagi antar proses lewat page cache. Mapping
+ * copy-on-write boleh ditulis: halaman yang diubah menjadi salinan privat
+ * proses ini dan file tidak berubah.
+ *
+ * @param filename Path file
+ * @param is_copy_on_write true untuk mapping privat yang boleh ditulis
+ * @param mapping_output Mapping hasil (base_address minimal 64-byte aligned)
+ * @return true jika berhasil
+ */
+bool mapped_file_open(const char *filename, bool is_copy_on_write, struct MappedFile *mapping_output);
+
+/**
+ * @brief Melepas mapping file (semua pointer ke dalam mapping menjadi tidak valid)
+ * @param mapping Mapping dari mapped_file_open
+ */
+void mapped_file_close(struct MappedFile *mapping);
+
+// ==========================[ RANDOM NUMBER GENERATION ]=======================
+
+/**
+ * @brief Mengatur seed global untuk inisialisasi weights dan shuffle
+ *
+ * Setiap pemanggilan matrix_fill_random, matrix_shuffle_rows, dan
+ * batch_sampler_create mengambil stream_id berikutnya dari counter atomik,
+ * sehingga urutan pemanggilan yang sama dengan seed yang sama selalu
+ * menghasilkan nilai yang sama, berapa pun jumlah thread-nya. Fungsi ini
+ * juga mereset counter stream_id.
+ *
+ * @param seed Seed global
+ */
+void random_set_global_seed(uint64_t seed);
+
+/**
+ * @brief Membuat stream baru dari seed global dan stream_id berikutnya (thread-safe)
+ * @return Stream random
+ */
+struct RandomStream random_stream_create_from_global_seed(void);
+
+/**
+ * @brief Membuat stream random dari seed dan nomor stream
+ *
+ * State diturunkan lewat splitmix64, sehingga stream_id yang berurutan
+ * menghasilkan stream yang tidak berkorelasi.
+ *
+ * @param seed Seed
+ * @param stream_id Nomor stream (misalnya indeks thread atau indeks layer)
+ * @return Stream random
+ */
+struct RandomStream random_stream_create(uint64_t seed, uint64_t stream_id);
+
+/**
+ * @brief Mengambil 64 bit random berikutnya
+ * @param random_stream Stream random
+ * @return Bilangan random 64-bit
+ */
+uint64_t random_stream_next(struct RandomStream *random_stream);
+
+/**
+ * @brief Mengambil float random uniform di [0, 1)
+ * @param random_stream Stream random
+ * @return Float random dengan resolusi 2^-24
+ */
+float random_stream_next_float(struct RandomStream *random_stream);
+
+/**
+ * @brief Mengambil indeks random uniform di [0, bound) tanpa bias modulo
+ * @param random_stream Stream random
+ * @param bound Batas atas eksklusif (harus > 0)
+ * @return Indeks random
+ */
+size_t random_stream_next_index(struct RandomStream *random_stream, size_t bound);
+
+// ============================[ MATRIX OPERATIONS ]============================
+
+/**
+ * @brief Mengalokasikan matrix baru (diisi nol, elemen 64-byte aligned)
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param num_rows Jumlah baris
+ * @param num_columns Jumlah kolom
+ * @return Matrix yang telah dialokasikan
+ */
+struct Matrix matrix_allocate(struct MemoryArena *arena_ptr, size_t num_rows, size_t num_columns);
+
+/**
+ * @brief Mengalokasikan matrix baru tanpa mengisi nol (elemen 64-byte aligned)
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param num_rows Jumlah baris
+ * @param num_columns Jumlah kolom
+ * @return Matrix yang elemennya belum diinisialisasi
+ */
+struct Matrix matrix_allocate_uninitialized(struct MemoryArena *arena_ptr, size_t num_rows, size_t num_columns);
+
+/**
+ * @brief Mengalokasikan matrix 16-bit tanpa mengisi nol
+ * @param arena_ptr Arena untuk alokasi (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param num_rows Jumlah baris
+ * @param num_columns Jumlah kolom
+ * @param format Format elemen (fp16 atau bf16)
+ * @return Matrix 16-bit yang elemennya belum diinisialisasi
+ */
+struct HalfMatrix half_matrix_allocate(struct MemoryArena *arena_ptr, size_t num_rows, size_t num_columns,
+                                       enum HalfPrecisionFormat format);
+
+/**
+ * @brief Mengisi matrix 16-bit dari matrix fp32 (round to nearest even)
+ * @param destination_matrix Matrix 16-bit tujuan
+ * @param source_matrix Matrix fp32 sumber (ukuran sama)
+ */
+void half_matrix_convert_from_matrix(struct HalfMatrix destination_matrix, struct Matrix source_matrix);
+
+/**
+ * @brief Mendapatkan row tertentu dari matrix
+ * @param source_matrix Matrix sumber
+ * @param row_index Indeks baris yang diinginkan
+ * @return Struktur Row yang merepresentasikan baris tersebut
+ */
+struct Row matrix_get_row(struct Matrix source_matrix, size_t row_index);
+
+/**
+ * @brief Mengkonversi row menjadi matrix 1x N
+ * @param source_row Row yang akan dikonversi
+ * @return Matrix dengan 1 baris
+ */
+struct Matrix row_convert_to_matrix(struct Row source_row);
+
+/**
+ * @brief Membuat slice (potongan) dari row
+ * @param source_row Row sumber
+ * @param start_index Indeks awal
+ * @param slice_length Jumlah kolom yang diambil
+ * @return Row baru yang merupakan potongan dari row asli
+ */
+struct Row row_create_slice(struct Row source_row, size_t start_index, size_t slice_length);
+
+/**
+ * @brief Mencari indeks dengan nilai maksimum dalam row
+ * @param input_row Row yang akan dicari nilai maksimumnya
+ * @return Indeks elemen dengan nilai terbesar
+ */
+size_t row_find_max_index(struct Row input_row);
+
+/**
+ * @brief Membuat slice dari beberapa baris matrix
+ * @param source_matrix Matrix sumber
+ * @param start_row Baris awal
+ * @param num_rows Jumlah baris yang diambil
+ * @return Matrix baru yang merupakan potongan dari matrix asli
+ */
+struct Matrix matrix_create_row_slice(struct Matrix source_matrix, size_t start_row, size_t num_rows);
+
+/**
+ * @brief Mengisi semua elemen matrix dengan nilai tertentu
+ * @param target_matrix Matrix yang akan diisi
+ * @param fill_value Nilai yang akan diisikan
+ */
+void matrix_fill_with_value(struct Matrix target_matrix, float fill_value);
+
+/**
+ * @brief Mengisi matrix dengan nilai random dalam range tertentu
+ *
+ * Memakai stream berikutnya dari seed global (lihat random_set_global_seed).
+ *
+ * @param target_matrix Matrix yang akan diisi
+ * @param min_value Nilai minimum
+ * @param max_value Nilai maksimum
+ */
+void matrix_fill_random(struct Matrix target_matrix, float min_value, float max_value);
+
+/**
+ * @brief Mengisi matrix dengan nilai random dari seed dan stream tertentu
+ *
+ * Generator berbasis counter: setiap elemen adalah hash dari indeksnya,
+ * sehingga pengisian divektorisasi dan dibagi ke beberapa thread tanpa
+ * mengubah hasil. Nilai identik di semua instruction set dan jumlah thread.
+ *
+ * @param target_matrix Matrix yang akan diisi
+ * @param min_value Nilai minimum
+ * @param max_value Nilai maksimum (eksklusif)
+ * @param seed Seed
+ * @param stream_id Nomor stream
+ */
+void matrix_fill_random_with_seed(struct Matrix target_matrix,
+                                  float min_value,
+                                  float max_value,
+                                  uint64_t seed,
+                                  uint64_t stream_id);
+
+/**
+ * @brief Menjumlahkan dua matrix (element-wise)
+ * @param destination_matrix Matrix pertama (hasil akan disimpan di sini)
+ * @param source_matrix Matrix kedua
+ */
+void matrix_add_elementwise(struct Matrix destination_matrix, struct Matrix source_matrix);
+
+/**
+ * @brief Perkalian matrix (dot product)
+ * @param result_matrix Matrix tujuan untuk hasil
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua
+ */
+void matrix_multiply_dot_product(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b);
+
+/**
+ * @brief Perkalian matrix dengan matrix pertama ditranspose (A^T * B)
+ * @param result_matrix Matrix tujuan untuk hasil
+ * @param matrix_a Matrix pertama (akan dibaca sebagai transpose)
+ * @param matrix_b Matrix kedua
+ */
+void matrix_multiply_transpose_a(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b);
+
+/**
+ * @brief Perkalian matrix dengan matrix kedua ditranspose (A * B^T)
+ * @param result_matrix Matrix tujuan untuk hasil
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua (akan dibaca sebagai transpose)
+ */
+void matrix_multiply_transpose_b(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b);
+
+/**
+ * @brief Melakukan result = aktivasi(A * B + bias) dalam satu GEMM
+ *
+ * Bias dan aktivasi dijalankan di epilogue kernel GEMM, tanpa sapuan
+ * tambahan atas matrix hasil. Presisi aktivasi mengikuti activation_get_precision().
+ *
+ * @param result_matrix Matrix untuk menyimpan hasil
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua
+ * @param bias_row Bias yang ditambahkan ke setiap baris hasil
+ * @param activation_type Tipe fungsi aktivasi
+ */
+void matrix_multiply_bias_activation(struct Matrix result_matrix, struct Matrix matrix_a, struct Matrix matrix_b,
+                                     struct Row bias_row, enum ActivationType activation_type);
+
+/**
+ * @brief Melakukan result = aktivasi(A * B + bias) dengan B disimpan 16-bit
+ *
+ * Elemen B dilebarkan ke fp32 saat packing panel (F16C untuk fp16), sehingga
+ * micro-kernel, bias, dan akumulasi tetap fp32.
+ *
+ * @param result_matrix Matrix tujuan untuk hasil
+ * @param matrix_a Matrix pertama
+ * @param matrix_b Matrix kedua (fp16 atau bf16)
+ * @param bias_row Bias yang ditambahkan ke setiap baris hasil
+ * @param activation_type Tipe fungsi aktivasi
+ */
+void matrix_multiply_half_bias_activation(struct Matrix result_matrix, struct Matrix matrix_a,
+                                          struct HalfMatrix matrix_b, struct Row bias_row,
+                                          enum ActivationType activation_type);
+
+/**
+ * @brief Membuat transpose matrix dalam format CSR (hanya elemen nonzero)
+ * @param arena_ptr Arena untuk alokasi
+ * @param source_matrix Matrix dense sumber (maksimal UINT32_MAX baris)
+ * @return Matrix CSR berukuran source_matrix.num_columns x source_matrix.num_rows
+ */
+struct SparseMatrix sparse_matrix_create_transposed(struct MemoryArena *arena_ptr, struct Matrix source_matrix);
+
+/**
+ * @brief Melakukan result = aktivasi(A * W + bias) dengan W^T disimpan dalam CSR
+ *
+ * Baris A diproses per blok SIMD_SPARSE_MAX_LANES: blok ditranspose, lalu
+ * setiap baris CSR menghasilkan satu kolom output untuk seluruh blok dengan
+ * akumulator di register. Jumlah operasi sebanding dengan nonzero_count.
+ *
+ * @param result_matrix Matrix tujuan untuk hasil
+ * @param matrix_a Matrix pertama
+ * @param transposed_weights Transpose W dalam CSR (dari sparse_matrix_create_transposed)
+ * @param bias_row Bias yang ditambahkan ke setiap baris hasil
+ * @param activation_type Tipe fungsi aktivasi
+ */
+void sparse_matrix_multiply_bias_activation(struct Matrix result_matrix, struct Matrix matrix_a,
+                                            struct SparseMatrix transposed_weights, struct Row bias_row,
+                                            enum ActivationType activation_type);
+
+/**
+ * @brief Menambahkan satu row ke setiap baris matrix (broadcast)
+ * @param destination_matrix Matrix yang akan ditambah
+ * @param source_row Row yang ditambahkan ke setiap baris
+ */
+void matrix_add_row_broadcast(struct Matrix destination_matrix, struct Row source_row);
+
+/**
+ * @brief Menyalin isi source_matrix ke destination_matrix
+ * @param destination_matrix Matrix tujuan
+ * @param source_matrix Matrix sumber
+ */
+void matrix_copy_data(struct Matrix destination_matrix, struct Matrix source_matrix);
 
 /**
  * @brief Menerapkan fungsi aktivasi ke semua elemen matrix
@@ -280,6 +1078,17 @@ void matrix_copy_data(struct Matrix destination_matrix, struct Matrix source_mat
  */
 void matrix_apply_activation(struct Matrix target_matrix, enum ActivationType activation_type);
 
+/**
+ * @brief Mendapatkan nama instruction set yang dipakai kernel matrix
+ *
+ * Kernel dipilih sekali saat program mulai berdasarkan CPUID (instruction set
+ * terlebar yang didukung). Variabel environment NN_SIMD_ISA (scalar, sse2,
+ * avx2, avx512, avx512vnni) dapat membatasi pilihan tersebut.
+ *
+ * @return Nama instruction set ("scalar", "sse2", "avx2", "avx512", atau "avx512vnni")
+ */
+const char *matrix_get_kernel_isa_name(void);
+
 /**
  * @brief Mencetak matrix ke console
  * @param input_matrix Matrix yang akan dicetak
@@ -306,17 +1115,178 @@ void matrix_normalize_minmax(struct Matrix target_matrix,
                              float new_min_value,
                              float new_max_value);
 
+/**
+ * @brief Normalisasi min-max seperti matrix_normalize_minmax dan mengembalikan parameternya
+ * @param arena_ptr Arena untuk array min/max
+ * @param target_matrix Matrix yang akan dinormalisasi
+ * @param num_input_columns Jumlah kolom input yang akan dinormalisasi
+ * @param new_min_value Nilai minimum baru
+ * @param new_max_value Nilai maksimum baru
+ * @return Parameter normalisasi yang dipakai
+ */
+struct NormalizationParameters matrix_normalize_minmax_with_parameters(struct MemoryArena *arena_ptr,
+                                                                      struct Matrix target_matrix,
+                                                                      size_t num_input_columns,
+                                                                      float new_min_value,
+                                                                      float new_max_value);
+
+/**
+ * @brief Menerapkan parameter normalisasi yang tersimpan ke data baru
+ * @param target_matrix Matrix yang akan dinormalisasi (minimal parameters.column_count kolom)
+ * @param parameters Parameter normalisasi
+ */
+void matrix_apply_normalization(struct Matrix target_matrix, struct NormalizationParameters parameters);
+
 // ============================[ DATASET OPERATIONS ]===========================
 
 /**
- * @brief Memuat dataset dari file CSV
+ * @brief Memuat dataset klasifikasi dari file CSV
+ *
+ * Semua kolom kecuali yang terakhir adalah fitur; kolom terakhir adalah label
+ * class (bilangan bulat >= 0) yang diubah ke one-hot. Jumlah baris, fitur,
+ * dan class ditentukan dari isi file. Baris yang tidak valid dilewati dan
+ * jumlahnya dilaporkan ke stderr.
+ *
  * @param arena_ptr Arena untuk alokasi memori
  * @param csv_filename Nama file CSV
  * @param skip_header_lines Jumlah baris yang akan dilewati (biasanya header)
- * @return Matrix berisi data dari CSV
+ * @return Matrix berisi fitur diikuti kolom one-hot
  */
 struct Matrix dataset_load_from_csv(struct MemoryArena *arena_ptr, const char *csv_filename, size_t skip_header_lines);
 
+/**
+ * @brief Memuat file CSV numerik dengan jumlah baris dan kolom sembarang
+ *
+ * File dibaca per chunk besar dua kali: pass pertama menghitung baris (dan
+ * class untuk one-hot) agar matrix bisa dialokasikan sekali dengan ukuran
+ * pas, pass kedua mem-parse angka dengan parser float khusus tanpa sscanf.
+ * Jumlah kolom diambil dari baris data pertama; baris dengan jumlah kolom
+ * berbeda atau nilai non-numerik dilewati.
+ *
+ * @param arena_ptr Arena untuk alokasi memori (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param csv_filename Nama file CSV
+ * @param skip_header_lines Jumlah baris yang akan dilewati (biasanya header)
+ * @param one_hot_last_column true untuk mengubah kolom terakhir (label) ke one-hot
+ * @param statistics_output Statistik pemuatan (boleh NULL)
+ * @return Matrix berisi data dari CSV
+ */
+struct Matrix dataset_load_csv_matrix(struct MemoryArena *arena_ptr,
+                                      const char *csv_filename,
+                                      size_t skip_header_lines,
+                                      bool one_hot_last_column,
+                                      struct CsvLoadStatistics *statistics_output);
+
+/**
+ * @brief Memuat file CSV numerik secara paralel dari file yang di-mmap
+ *
+ * Hasilnya sama dengan dataset_load_csv_matrix. File dipotong menjadi satu
+ * chunk per thread OpenMP (minimal 1 MiB) di batas baris; setiap thread
+ * mem-parse chunk-nya ke buffer thread-local, lalu buffer digabung ke satu
+ * matrix dengan prefix sum jumlah baris (urutan baris tetap).
+ * Butuh memori sementara sebesar matrix hasil di luar arena.
+ *
+ * @param arena_ptr Arena untuk alokasi memori (NULL untuk heap, dibebaskan dengan arena_free_memory)
+ * @param csv_filename Nama file CSV
+ * @param skip_header_lines Jumlah baris yang akan dilewati (biasanya header)
+ * @param one_hot_last_column true untuk mengubah kolom terakhir (label) ke one-hot
+ * @param statistics_output Statistik pemuatan (boleh NULL)
+ * @return Matrix berisi data dari CSV
+ */
+struct Matrix dataset_load_csv_matrix_parallel(struct MemoryArena *arena_ptr,
+                                               const char *csv_filename,
+                                               size_t skip_header_lines,
+                                               bool one_hot_last_column,
+                                               struct CsvLoadStatistics *statistics_output);
+
+/**
+ * @brief Versi format file dataset biner yang ditulis dataset_save_binary
+ */
+#define DATASET_BINARY_FORMAT_VERSION 1
+
+/**
+ * @brief Menyimpan dataset yang sudah diproses ke file biner
+ *
+ * Isi file: header (magic, versi, penanda endian, jumlah baris, kolom input
+ * dan output, offset data), parameter normalisasi (min lalu max per kolom),
+ * padding hingga batas 64 byte, lalu baris float32 berurutan.
+ *
+ * @param dataset Dataset (input diikuti output)
+ * @param input_column_count Jumlah kolom input
+ * @param normalization Normalisasi yang sudah diterapkan (column_count 0 jika tidak ada)
+ * @param dataset_filename Path file tujuan
+ * @return true jika berhasil ditulis
+ */
+bool dataset_save_binary(struct Matrix dataset,
+                         size_t input_column_count,
+                         struct NormalizationParameters normalization,
+                         const char *dataset_filename);
+
+/**
+ * @brief Memuat dataset biner dengan mmap tanpa menyalin data
+ *
+ * Mapping bersifat copy-on-write, sehingga dataset boleh diubah di tempat
+ * (misalnya matrix_shuffle_rows) tanpa mengubah file; halaman yang ditulis
+ * menjadi salinan privat proses.
+ *
+ * @param dataset_filename Path file dataset
+ * @param dataset_output Dataset hasil load
+ * @return true jika file valid dan berhasil dimuat
+ */
+bool dataset_load_binary(const char *dataset_filename, struct BinaryDataset *dataset_output);
+
+/**
+ * @brief Melepas dataset biner (data tidak boleh dipakai lagi)
+ * @param dataset Dataset dari dataset_load_binary
+ */
+void dataset_unload_binary(struct BinaryDataset *dataset);
+
+/**
+ * @brief Membuka stream dataset biner untuk training out-of-core
+ *
+ * Thread loader membaca chunk berikutnya dari file dan mengacaknya lewat
+ * shuffle buffer berukuran tetap selagi chunk saat ini dilatih, sehingga
+ * I/O tumpang tindih dengan komputasi dan memori tidak bergantung pada
+ * ukuran dataset. Tanpa pthread, chunk dibaca saat diminta.
+ *
+ * @param dataset_filename Path file dataset biner (lihat dataset_save_binary)
+ * @param chunk_rows Jumlah baris per chunk (sebaiknya kelipatan ukuran batch)
+ * @param chunk_buffer_count Jumlah buffer chunk (2 = double buffering, 3 = triple buffering)
+ * @param shuffle_buffer_rows Ukuran shuffle buffer dalam baris (0 tanpa shuffle)
+ * @param shuffle_seed Seed shuffle
+ * @return Stream, atau NULL jika file tidak valid
+ */
+struct DatasetStream *dataset_stream_open(const char *dataset_filename,
+                                          size_t chunk_rows,
+                                          size_t chunk_buffer_count,
+                                          size_t shuffle_buffer_rows,
+                                          uint64_t shuffle_seed);
+
+/**
+ * @brief Mengambil chunk berikutnya dari stream
+ * @param stream Stream dataset
+ * @param chunk_output Chunk (valid sampai pemanggilan berikutnya)
+ * @return false di akhir epoch (pemanggilan berikutnya memulai epoch baru)
+ */
+bool dataset_stream_next_chunk(struct DatasetStream *stream, struct Matrix *chunk_output);
+
+/**
+ * @brief Mendapatkan jumlah baris dan kolom dataset di stream
+ * @param stream Stream dataset
+ * @param row_count_output Jumlah baris per epoch (boleh NULL)
+ * @param input_column_count_output Jumlah kolom input (boleh NULL)
+ * @param output_column_count_output Jumlah kolom output (boleh NULL)
+ */
+void dataset_stream_get_shape(const struct DatasetStream *stream,
+                              size_t *row_count_output,
+                              size_t *input_column_count_output,
+                              size_t *output_column_count_output);
+
+/**
+ * @brief Menghentikan thread loader dan membebaskan stream
+ * @param stream Stream dataset (boleh NULL)
+ */
+void dataset_stream_close(struct DatasetStream *stream);
+
 // ========================[ NEURAL NETWORK OPERATIONS ]========================
 
 /**
@@ -330,11 +1300,51 @@ struct NeuralNetwork neural_network_allocate(struct MemoryArena *arena_ptr,
                                              size_t *layer_architecture,
                                              size_t total_layers);
 
+/**
+ * @brief Mengalokasikan context eksekusi (buffer aktivasi) untuk satu pemanggil
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param network Neural network yang akan dijalankan dengan context ini
+ * @return Context yang siap digunakan
+ */
+struct NeuralNetworkContext neural_network_allocate_context(struct MemoryArena *arena_ptr,
+                                                            struct NeuralNetwork network);
+
 /**
  * @brief Melakukan forward propagation
+ *
+ * Input dibaca dari context.activation_vectors[0] dan output ditulis ke
+ * context.activation_vectors[total_layers - 1]. Network tidak diubah.
+ *
+ * @param network Neural network yang akan diproses
+ * @param context Context eksekusi milik pemanggil
+ */
+void neural_network_forward_pass(struct NeuralNetwork network, struct NeuralNetworkContext context);
+
+/**
+ * @brief Mengalokasikan matrix aktivasi untuk forward pass mode batch
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param network Neural network yang akan diproses
+ * @param batch_capacity Jumlah baris maksimum per batch
+ * @return Struktur BatchActivations yang siap digunakan
+ */
+struct BatchActivations neural_network_allocate_batch_activations(struct MemoryArena *arena_ptr,
+                                                                  struct NeuralNetwork network,
+                                                                  size_t batch_capacity);
+
+/**
+ * @brief Melakukan forward propagation untuk beberapa sample sekaligus
+ *
+ * Kolom pertama input_batch (sebanyak ukuran input layer) disalin ke
+ * aktivasi layer input, lalu setiap layer dihitung dengan satu GEMM.
+ * Hasil untuk baris ke-i berada di baris ke-i matrix aktivasi output.
+ *
  * @param network Neural network yang akan diproses
+ * @param batch_activations Matrix aktivasi tujuan
+ * @param input_batch Matrix input (B baris, minimal ukuran input layer kolom)
  */
-void neural_network_forward_pass(struct NeuralNetwork network);
+void neural_network_forward_pass_batch(struct NeuralNetwork network,
+                                       struct BatchActivations batch_activations,
+                                       struct Matrix input_batch);
 
 /**
  * @brief Mengisi semua weights dan biases dengan nol
@@ -342,8 +1352,50 @@ void neural_network_forward_pass(struct NeuralNetwork network);
  */
 void neural_network_zero_weights(struct NeuralNetwork network);
 
+/**
+ * @brief Mengalokasikan workspace training yang dipakai ulang setiap mini-batch
+ * @param arena_ptr Arena untuk alokasi memori
+ * @param network Neural network yang akan dilatih
+ * @param batch_capacity Jumlah baris maksimum per batch
+ * @return Workspace yang siap digunakan
+ */
+struct TrainingWorkspace training_workspace_allocate(struct MemoryArena *arena_ptr,
+                                                     struct NeuralNetwork network,
+                                                     size_t batch_capacity);
+
+/**
+ * @brief Menghitung gradient satu batch memakai workspace yang sudah dialokasikan
+ *
+ * Tidak ada alokasi; gradient weights ditimpa langsung dan hanya gradient
+ * bias yang direset. Paralelisasi sama dengan neural_network_compute_gradients.
+ *
+ * @param training_workspace Workspace dari training_workspace_allocate
+ * @param network Neural network
+ * @param training_data Matrix berisi data training (maksimal batch_capacity baris)
+ * @return Neural network berisi gradient (milik workspace, ditimpa pemanggilan berikutnya)
+ */
+struct NeuralNetwork training_workspace_compute_gradients(struct TrainingWorkspace training_workspace,
+                                                          struct NeuralNetwork network,
+                                                          struct Matrix training_data);
+
+/**
+ * @brief Mengambil cost (mean squared error) batch terakhir
+ *
+ * Diisi oleh training_workspace_compute_gradients dari forward pass yang sudah
+ * dijalankan untuk gradient (sebelum parameter diupdate), tanpa alokasi.
+ *
+ * @param training_workspace Workspace yang sudah dipakai training_workspace_compute_gradients
+ * @return Nilai cost rata-rata batch terakhir
+ */
+float training_workspace_get_batch_cost(struct TrainingWorkspace training_workspace);
+
 /**
  * @brief Melakukan backpropagation dan menghitung gradient
+ *
+ * Jika dibangun dengan OpenMP, batch dibagi ke beberapa thread (jumlahnya
+ * mengikuti OMP_NUM_THREADS) dan gradient digabung dengan reduksi pohon
+ * yang deterministik untuk jumlah thread yang sama.
+ *
  * @param arena_ptr Arena untuk alokasi temporary
  * @param network Neural network
  * @param training_data Matrix berisi data training (input + output)
@@ -363,6 +1415,17 @@ void neural_network_apply_gradients(struct NeuralNetwork network,
                                     struct NeuralNetwork gradient_network,
                                     float learning_rate);
 
+/**
+ * @brief Menyalin semua weights dan biases (snapshot model)
+ *
+ * Network dengan buffer parameter flat disalin dengan satu memcpy.
+ *
+ * @param destination_network Network tujuan (arsitektur sama dengan source)
+ * @param source_network Network sumber
+ */
+void neural_network_copy_parameters(struct NeuralNetwork destination_network,
+                                    struct NeuralNetwork source_network);
+
 /**
  * @brief Melatih neural network dengan dataset
  * @param network Neural network yang akan dilatih
@@ -379,6 +1442,47 @@ void neural_network_train(struct NeuralNetwork network,
                           float learning_rate,
                           size_t num_epochs);
 
+/**
+ * @brief Melatih neural network dengan SGD asinkron tanpa lock (Hogwild)
+ *
+ * Beberapa worker thread OpenMP masing-masing mengambil mini-batch, menghitung
+ * gradient dengan workspace sendiri, lalu langsung memperbarui weights dan
+ * biases bersama tanpa lock, barrier, maupun reduksi. Setiap tugas memilih
+ * batch secara acak (dengan pengembalian) dari stream random milik worker,
+ * jadi satu epoch berarti jumlah batch yang sama dengan dataset, bukan urutan
+ * tetap. Urutan update tidak deterministik; tanpa OpenMP fungsi ini berjalan
+ * seperti SGD biasa.
+ *
+ * @param network Neural network yang akan dilatih
+ * @param training_dataset Matrix berisi data training
+ * @param batch_size Ukuran batch untuk training
+ * @param learning_rate Learning rate
+ * @param num_epochs Jumlah epoch training
+ * @param worker_count Jumlah worker thread (0 untuk memakai semua thread OpenMP)
+ */
+void neural_network_train_hogwild(struct NeuralNetwork network,
+                                  struct Matrix training_dataset,
+                                  size_t batch_size,
+                                  float learning_rate,
+                                  size_t num_epochs,
+                                  size_t worker_count);
+
+/**
+ * @brief Melakukan prediksi untuk banyak baris input sekaligus (multi-thread)
+ *
+ * Baris input dibagi ke thread OpenMP dan diproses dengan forward pass batch.
+ * Network hanya dibaca, sehingga aman dipanggil bersamaan dari beberapa thread.
+ *
+ * @param network Neural network yang dipakai
+ * @param input_batch Matrix input (minimal ukuran input layer kolom; kolom lain diabaikan)
+ * @param output_scores Matrix hasil skor kelas (baris = input_batch.num_rows, kolom = ukuran output layer)
+ * @param output_labels Array hasil indeks kelas terbesar untuk setiap baris (boleh NULL)
+ */
+void neural_network_predict_batch(struct NeuralNetwork network,
+                                  struct Matrix input_batch,
+                                  struct Matrix output_scores,
+                                  size_t *output_labels);
+
 /**
  * @brief Menghitung akurasi neural network pada dataset
  * @param network Neural network yang akan dievaluasi
@@ -403,24 +1507,334 @@ float neural_network_calculate_cost(struct NeuralNetwork network, struct Matrix
  */
 void neural_network_randomize_weights(struct NeuralNetwork network, float min_weight, float max_weight);
 
+// ================================[ OPTIMIZER ]================================
+
+/**
+ * @brief Membuat optimizer untuk network dengan buffer parameter flat
+ *
+ * Hyperparameter default: momentum 0.9; RMSProp decay 0.9; Adam beta1 0.9,
+ * beta2 0.999; epsilon 1e-8.
+ *
+ * @param arena_ptr Arena untuk alokasi state optimizer
+ * @param network Neural network yang akan dioptimasi
+ * @param optimizer_type Algoritma optimizer
+ * @param learning_rate Learning rate
+ * @return Optimizer yang siap digunakan
+ */
+struct Optimizer optimizer_create(struct MemoryArena *arena_ptr,
+                                  struct NeuralNetwork network,
+                                  enum OptimizerType optimizer_type,
+                                  float learning_rate);
+
+/**
+ * @brief Memperbarui parameter network dengan satu step optimizer
+ *
+ * Parameter, gradient, dan state dibaca sekali dan ditulis sekali dalam satu
+ * pass SIMD yang dibagi ke thread OpenMP.
+ *
+ * @param optimizer Optimizer (state diperbarui)
+ * @param network Neural network yang akan diupdate
+ * @param gradient_network Neural network berisi gradient (layout parameter sama)
+ */
+void optimizer_step(struct Optimizer *optimizer,
+                    struct NeuralNetwork network,
+                    struct NeuralNetwork gradient_network);
+
+// ============================[ MODEL PERSISTENCE ]============================
+
+/**
+ * @brief Versi format file model biner yang ditulis neural_network_save_model
+ */
+#define NEURAL_NETWORK_MODEL_FORMAT_VERSION 1
+
+/**
+ * @brief Menyimpan model ke file biner berversi
+ *
+ * Isi file: header (magic, versi, penanda endian, jumlah layer, jumlah dan
+ * offset parameter, checksum FNV-1a 64), layer_sizes, activation_types, lalu
+ * blok parameter dengan layout yang sama seperti buffer parameter
+ * neural_network_allocate (setiap blok W/b dimulai di batas 64 byte).
+ *
+ * @param network Neural network yang akan disimpan
+ * @param model_filename Path file tujuan
+ * @return true jika berhasil ditulis
+ */
+bool neural_network_save_model(struct NeuralNetwork network, const char *model_filename);
+
+/**
+ * @brief Memuat model dari file biner tanpa menyalin weights
+ *
+ * Weights dan biases menunjuk langsung ke halaman file yang di-mmap, sehingga
+ * startup tidak bergantung pada ukuran model dan banyak proses berbagi satu
+ * salinan di page cache. Mapping bersifat read-only: pakai model untuk
+ * inference, atau salin ke network dari neural_network_allocate dengan
+ * neural_network_copy_parameters sebelum training.
+ *
+ * @param arena_ptr Arena untuk layer_sizes, activation_types, dan view
+ * @param model_filename Path file model
+ * @param verify_checksum true untuk memverifikasi checksum (membaca seluruh file)
+ * @param network_output Network hasil load
+ * @param mapping_output Mapping yang harus dilepas dengan neural_network_unload_model
+ * @return true jika file valid dan berhasil dimuat
+ */
+bool neural_network_load_model(struct MemoryArena *arena_ptr,
+                               const char *model_filename,
+                               bool verify_checksum,
+                               struct NeuralNetwork *network_output,
+                               struct MappedFile *mapping_output);
+
+/**
+ * @brief Melepas mapping model (network yang dimuat tidak boleh dipakai lagi)
+ * @param mapping Mapping dari neural_network_load_model
+ */
+void neural_network_unload_model(struct MappedFile *mapping);
+
+// ===========================[ QUANTIZED INFERENCE ]===========================
+
+/**
+ * @brief Mengkuantisasi network terlatih menjadi weights int8 (post-training)
+ *
+ * Setiap kolom output memakai skala max|W[:, j]| / 127 (simetris). Bias dan
+ * tipe aktivasi disalin; network asal tidak diubah dan tidak dirujuk lagi.
+ *
+ * @param arena_ptr Arena untuk alokasi network terkuantisasi
+ * @param network Neural network sumber
+ * @return Network terkuantisasi
+ */
+struct QuantizedNeuralNetwork neural_network_quantize(struct MemoryArena *arena_ptr, struct NeuralNetwork network);
+
+/**
+ * @brief Melakukan prediksi int8 untuk banyak baris input sekaligus (multi-thread)
+ *
+ * Sama seperti neural_network_predict_batch, tetapi setiap layer memakai
+ * GEMM int8 dengan aktivasi yang dikuantisasi per baris.
+ *
+ * @param quantized_network Network terkuantisasi
+ * @param input_batch Matrix input (minimal ukuran input layer kolom; kolom lain diabaikan)
+ * @param output_scores Matrix hasil skor kelas (baris = input_batch.num_rows, kolom = ukuran output layer)
+ * @param output_labels Array hasil indeks kelas terbesar untuk setiap baris (boleh NULL)
+ */
+void quantized_network_predict_batch(struct QuantizedNeuralNetwork quantized_network,
+                                     struct Matrix input_batch,
+                                     struct Matrix output_scores,
+                                     size_t *output_labels);
+
+/**
+ * @brief Menghitung akurasi klasifikasi network terkuantisasi pada dataset
+ * @param quantized_network Network terkuantisasi
+ * @param test_dataset Dataset untuk evaluasi
+ * @return Akurasi antara 0.0 hingga 1.0
+ */
+float quantized_network_calculate_accuracy(struct QuantizedNeuralNetwork quantized_network,
+                                           struct Matrix test_dataset);
+
+// =========================[ HALF PRECISION INFERENCE ]========================
+
+/**
+ * @brief Membuat salinan network dengan weights 16-bit
+ *
+ * Network asal tetap menjadi master weights fp32 dan tidak dirujuk oleh
+ * salinan ini, sehingga host scoring cukup menyimpan salinan 16-bit.
+ *
+ * @param arena_ptr Arena untuk alokasi network 16-bit
+ * @param network Neural network sumber
+ * @param format Format weights (fp16 atau bf16)
+ * @return Network dengan weights 16-bit
+ */
+struct HalfPrecisionNeuralNetwork neural_network_convert_half_precision(struct MemoryArena *arena_ptr,
+                                                                        struct NeuralNetwork network,
+                                                                        enum HalfPrecisionFormat format);
+
+/**
+ * @brief Memperbarui weights 16-bit dan bias dari master weights fp32
+ *
+ * Dipanggil setelah optimizer memperbarui network fp32 (misalnya setiap
+ * epoch), sehingga update kecil tetap terakumulasi di master weights.
+ *
+ * @param half_network Network 16-bit
+ * @param network Neural network master dengan arsitektur yang sama
+ */
+void half_precision_network_update_weights(struct HalfPrecisionNeuralNetwork half_network,
+                                           struct NeuralNetwork network);
+
+/**
+ * @brief Melakukan prediksi dengan weights 16-bit untuk banyak baris input (multi-thread)
+ * @param half_network Network 16-bit
+ * @param input_batch Matrix input (minimal ukuran input layer kolom; kolom lain diabaikan)
+ * @param output_scores Matrix hasil skor kelas (baris = input_batch.num_rows, kolom = ukuran output layer)
+ * @param output_labels Array hasil indeks kelas terbesar untuk setiap baris (boleh NULL)
+ */
+void half_precision_network_predict_batch(struct HalfPrecisionNeuralNetwork half_network,
+                                          struct Matrix input_batch,
+                                          struct Matrix output_scores,
+                                          size_t *output_labels);
+
+/**
+ * @brief Menghitung akurasi klasifikasi network 16-bit pada dataset
+ * @param half_network Network 16-bit
+ * @param test_dataset Dataset untuk evaluasi
+ * @return Akurasi antara 0.0 hingga 1.0
+ */
+float half_precision_network_calculate_accuracy(struct HalfPrecisionNeuralNetwork half_network,
+                                                struct Matrix test_dataset);
+
+// ======================[ PRUNING AND SPARSE INFERENCE ]=======================
+
+/**
+ * @brief Memangkas weights dengan magnitude terkecil di setiap layer
+ *
+ * Di setiap weight_matrices[i], round(target_sparsity * jumlah weights)
+ * weights dengan |w| terkecil dijadikan nol; bias tidak dipangkas. Untuk
+ * fine-tuning, isi optimizer.parameter_mask dengan mask.parameter_mask agar
+ * weights yang dipangkas tetap nol selama training.
+ *
+ * @param arena_ptr Arena untuk alokasi mask
+ * @param network Neural network (harus memiliki parameter_buffer)
+ * @param target_sparsity Fraksi weights yang dipangkas per layer (0.0 - 1.0)
+ * @return Mask pruning
+ */
+struct PruningMask neural_network_prune_magnitude(struct MemoryArena *arena_ptr,
+                                                  struct NeuralNetwork network,
+                                                  float target_sparsity);
+
+/**
+ * @brief Menghitung fraksi weights yang bernilai nol di seluruh layer
+ * @param network Neural network
+ * @return Sparsity antara 0.0 hingga 1.0
+ */
+float neural_network_get_weight_sparsity(struct NeuralNetwork network);
+
+/**
+ * @brief Membuat network inferensi sparse dari network (biasanya hasil pruning)
+ *
+ * Layer dengan density <= SPARSE_KERNEL_MAX_DENSITY disimpan dalam CSR dan
+ * memakai kernel sparse x dense; layer lain tetap memakai GEMM dense.
+ * Network asal tidak dirujuk lagi.
+ *
+ * @param arena_ptr Arena untuk alokasi
+ * @param network Neural network sumber
+ * @return Network sparse
+ */
+struct SparseNeuralNetwork neural_network_create_sparse(struct MemoryArena *arena_ptr, struct NeuralNetwork network);
+
+/**
+ * @brief Melakukan prediksi dengan network sparse untuk banyak baris input (multi-thread)
+ * @param sparse_network Network sparse
+ * @param input_batch Matrix input (minimal ukuran input layer kolom; kolom lain diabaikan)
+ * @param output_scores Matrix hasil skor kelas (baris = input_batch.num_rows, kolom = ukuran output layer)
+ * @param output_labels Array hasil indeks kelas terbesar untuk setiap baris (boleh NULL)
+ */
+void sparse_network_predict_batch(struct SparseNeuralNetwork sparse_network,
+                                  struct Matrix input_batch,
+                                  struct Matrix output_scores,
+                                  size_t *output_labels);
+
+/**
+ * @brief Menghitung akurasi klasifikasi network sparse pada dataset
+ * @param sparse_network Network sparse
+ * @param test_dataset Dataset untuk evaluasi
+ * @return Akurasi antara 0.0 hingga 1.0
+ */
+float sparse_network_calculate_accuracy(struct SparseNeuralNetwork sparse_network, struct Matrix test_dataset);
+
 // =============================[ BATCH PROCESSING ]============================
 
 /**
  * @brief Memproses satu batch data untuk training
- * @param arena_ptr Arena untuk alokasi temporary
+ * @param training_workspace Workspace training (kapasitas minimal batch_size)
  * @param batch_processor Struktur batch yang melacak progress
  * @param batch_size Ukuran batch
  * @param network Neural network yang akan dilatih
  * @param training_dataset Dataset training
  * @param learning_rate Learning rate
  */
-void batch_process_training_data(struct MemoryArena *arena_ptr,
+void batch_process_training_data(struct TrainingWorkspace training_workspace,
                                  struct BatchProcessor *batch_processor,
                                  size_t batch_size,
                                  struct NeuralNetwork network,
                                  struct Matrix training_dataset,
                                  float learning_rate);
 
+/**
+ * @brief Memproses satu batch data untuk training dengan optimizer
+ * @param training_workspace Workspace training (kapasitas minimal batch_size)
+ * @param optimizer Optimizer yang memperbarui parameter
+ * @param batch_processor Struktur batch yang melacak progress
+ * @param batch_size Ukuran batch
+ * @param network Neural network yang akan dilatih
+ * @param training_dataset Dataset training
+ */
+void batch_process_training_data_with_optimizer(struct TrainingWorkspace training_workspace,
+                                                struct Optimizer *optimizer,
+                                                struct BatchProcessor *batch_processor,
+                                                size_t batch_size,
+                                                struct NeuralNetwork network,
+                                                struct Matrix training_dataset);
+
+/**
+ * @brief Melatih network satu epoch dari stream dataset
+ * @param training_workspace Workspace training (kapasitas minimal batch_size)
+ * @param optimizer Optimizer yang memperbarui parameter
+ * @param batch_size Ukuran batch
+ * @param network Neural network yang akan dilatih
+ * @param dataset_stream Stream dataset
+ * @return Jumlah baris yang dilatih
+ */
+size_t batch_process_training_stream(struct TrainingWorkspace training_workspace,
+                                     struct Optimizer *optimizer,
+                                     size_t batch_size,
+                                     struct NeuralNetwork network,
+                                     struct DatasetStream *dataset_stream);
+
+/**
+ * @brief Membuat sampler mini-batch untuk dataset
+ * @param arena_ptr Arena untuk permutasi dan buffer batch
+ * @param training_dataset Dataset yang akan disampling (maksimal UINT32_MAX baris)
+ * @param batch_size Jumlah baris per batch
+ * @return Sampler dengan permutasi identitas
+ */
+struct BatchSampler batch_sampler_create(struct MemoryArena *arena_ptr,
+                                         struct Matrix training_dataset,
+                                         size_t batch_size);
+
+/**
+ * @brief Mengacak permutasi indeks (Fisher-Yates) dan memulai epoch baru
+ *
+ * Memakai stream random milik sampler, sehingga beberapa sampler dapat
+ * diacak bersamaan dari thread berbeda.
+ *
+ * @param sampler Sampler
+ */
+void batch_sampler_shuffle(struct BatchSampler *sampler);
+
+/**
+ * @brief Mengumpulkan batch berikutnya ke buffer batch sampler
+ * @param sampler Sampler
+ * @param training_dataset Dataset yang sama dengan saat sampler dibuat
+ * @param batch_output Batch (view ke buffer sampler, valid sampai pemanggilan berikutnya)
+ * @return false jika epoch selesai (posisi kembali ke awal permutasi)
+ */
+bool batch_sampler_next_batch(struct BatchSampler *sampler,
+                              struct Matrix training_dataset,
+                              struct Matrix *batch_output);
+
+/**
+ * @brief Melatih network satu epoch dengan batch dari sampler
+ *
+ * Permutasi diacak di awal epoch; dataset tidak diubah.
+ *
+ * @param training_workspace Workspace training (kapasitas minimal sampler->batch_size)
+ * @param optimizer Optimizer yang memperbarui parameter
+ * @param sampler Sampler untuk training_dataset
+ * @param network Neural network yang akan dilatih
+ * @param training_dataset Dataset training
+ */
+void batch_process_training_epoch_sampled(struct TrainingWorkspace training_workspace,
+                                          struct Optimizer *optimizer,
+                                          struct BatchSampler *sampler,
+                                          struct NeuralNetwork network,
+                                          struct Matrix training_dataset);
+
 // ==============================[ ROW OPERATIONS ]=============================
 
 /**
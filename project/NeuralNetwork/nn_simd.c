@@ -0,0 +1,2053 @@
+/**
+ * @file nn_simd.c
+ * @brief Implementasi kernel SIMD (scalar, SSE2, AVX2, AVX-512) dan dispatch runtime
+ * @author 0xfa99
+ * @version 1.0
+ *
+ * Setiap kernel x86 dikompilasi dengan atribut target per fungsi, sehingga
+ * tidak perlu flag -march=native: binary tetap berjalan di CPU lama dan
+ * kernel yang lebih lebar hanya dipanggil jika CPUID menyatakan didukung.
+ */
+
+#include "nn_simd.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NN_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// =========================[ SCALAR - IMPLEMENTATION ]=========================
+
+static void
+scalar_vector_add(float *destination, const float *source, size_t count)
+{
+    for (size_t idx = 0; idx < count; ++idx) destination[idx] += source[idx];
+}
+
+static void
+scalar_vector_copy(float *destination, const float *source, size_t count)
+{
+    memmove(destination, source, sizeof(*destination) * count);
+}
+
+static void
+scalar_vector_fill(float *destination, float value, size_t count)
+{
+    for (size_t idx = 0; idx < count; ++idx) destination[idx] = value;
+}
+
+/**
+ * @brief Hash integer 32-bit dengan avalanche baik (xorshift-multiply "lowbias32")
+ */
+static inline uint32_t
+scalar_random_hash(uint32_t value)
+{
+    value ^= value >> 16;
+    value *= 0x7feb352du;
+    value ^= value >> 15;
+    value *= 0x846ca68bu;
+    value ^= value >> 16;
+    return value;
+}
+
+/*
+ * Generator berbasis counter: elemen ke-i adalah hash(hash((counter + i) ^ key_a) + key_b).
+ * 24 bit teratas dikonversi exact ke float, lalu diskalakan dengan satu perkalian dan satu
+ * penjumlahan (tanpa FMA) sehingga semua instruction set menghasilkan nilai yang identik.
+ */
+static void
+scalar_vector_fill_random(float *destination, size_t count, uint32_t counter, uint32_t key_a, uint32_t key_b,
+                          float min_value, float value_range)
+{
+    float scale = value_range * 0x1p-24f;
+    for (size_t idx = 0; idx < count; ++idx) {
+        uint32_t bits = scalar_random_hash(scalar_random_hash((counter + (uint32_t)idx) ^ key_a) + key_b);
+        float product = (float)(bits >> 8) * scale;
+        destination[idx] = product + min_value;
+    }
+}
+
+/**
+ * @brief Konversi IEEE binary16 ke fp32 (termasuk subnormal, inf, dan NaN)
+ */
+static inline float
+scalar_fp16_to_float(uint16_t value)
+{
+    uint32_t sign = (uint32_t)(value & 0x8000u) << 16;
+    uint32_t exponent = (value >> 10) & 0x1fu;
+    uint32_t mantissa = value & 0x3ffu;
+    uint32_t bits;
+
+    if (exponent == 0x1fu) {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    } else {
+        // Subnormal fp16 = mantissa * 2^-24, selalu normal di fp32
+        float magnitude = (float)mantissa * 0x1p-24f;
+        memcpy(&bits, &magnitude, sizeof(bits));
+        bits |= sign;
+    }
+
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/**
+ * @brief Konversi fp32 ke IEEE binary16 dengan round to nearest even
+ */
+static inline uint16_t
+scalar_float_to_fp16(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = (uint16_t)((bits >> 16) & 0x8000u);
+    uint32_t magnitude = bits & 0x7fffffffu;
+
+    if (magnitude > 0x7f800000u) return sign | 0x7e00u;   // NaN (quiet)
+    if (magnitude >= 0x477ff000u) return sign | 0x7c00u;  // >= 65520 dibulatkan ke inf
+    if (magnitude < 0x38800000u) {
+        // Di bawah 2^-14: subnormal fp16 dalam satuan 2^-24, rintf membulatkan ke genap terdekat
+        float absolute_value;
+        memcpy(&absolute_value, &magnitude, sizeof(absolute_value));
+        return sign | (uint16_t)rintf(absolute_value * 0x1p24f);
+    }
+
+    // Carry pembulatan mantissa boleh merambat ke exponent
+    uint32_t rounded = magnitude + 0xfffu + ((magnitude >> 13) & 1u);
+    return sign | (uint16_t)((rounded - 0x38000000u) >> 13);
+}
+
+/**
+ * @brief Konversi fp32 ke bfloat16 dengan round to nearest even
+ */
+static inline uint16_t
+scalar_float_to_bf16(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    if ((bits & 0x7fffffffu) > 0x7f800000u) return (uint16_t)((bits >> 16) | 0x40u);
+    return (uint16_t)((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+}
+
+static void
+scalar_vector_widen_half(float *destination, const uint16_t *source, size_t count, enum HalfPrecisionFormat format)
+{
+    if (format == HALF_PRECISION_FP16) {
+        for (size_t idx = 0; idx < count; ++idx) destination[idx] = scalar_fp16_to_float(source[idx]);
+    } else {
+        for (size_t idx = 0; idx < count; ++idx) {
+            uint32_t bits = (uint32_t)source[idx] << 16;
+            memcpy(destination + idx, &bits, sizeof(bits));
+        }
+    }
+}
+
+static void
+scalar_vector_narrow_half(uint16_t *destination, const float *source, size_t count, enum HalfPrecisionFormat format)
+{
+    if (format == HALF_PRECISION_FP16) {
+        for (size_t idx = 0; idx < count; ++idx) destination[idx] = scalar_float_to_fp16(source[idx]);
+    } else {
+        for (size_t idx = 0; idx < count; ++idx) destination[idx] = scalar_float_to_bf16(source[idx]);
+    }
+}
+
+static void
+scalar_vector_activation(float *values, size_t count, enum ActivationType activation_type)
+{
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (size_t idx = 0; idx < count; ++idx) values[idx] = activation_sigmoid(values[idx]);
+            return;
+        case ACTIVATION_TANH:
+            for (size_t idx = 0; idx < count; ++idx) values[idx] = activation_tanh(values[idx]);
+            return;
+        case ACTIVATION_RELU:
+            for (size_t idx = 0; idx < count; ++idx) values[idx] = activation_relu(values[idx]);
+            return;
+        case ACTIVATION_NONE:
+            return;
+    }
+
+    assert(0 && "Unknown activation type");
+}
+
+/*
+ * Aproksimasi exp(x) (mengikuti expf Cephes):
+ *   exp(x) = 2^n * exp(r),  n = round(x / ln 2),  |r| <= ln(2) / 2
+ * exp(r) dihitung dengan polinomial derajat 6 (bentuk Horner), lalu 2^n
+ * disusun langsung di bit exponent float. Input di-clamp ke [-87, 88]
+ * agar 2^n tetap berupa float normal.
+ *
+ * Error maksimum terukur terhadap referensi double pada [-20, 20]
+ * (benchmark/bench_activation.c), sama untuk semua instruction set:
+ *   sigmoid : absolut 9.0e-8, relatif 1.9e-7
+ *   tanh    : absolut 7.9e-8, relatif 1.5e-7 (|x| < 0.625 memakai polinomial ganjil tanh)
+ */
+#define FAST_EXP_INPUT_MIN   -87.0f
+#define FAST_EXP_INPUT_MAX    88.0f
+#define FAST_EXP_LOG2E        1.44269504088896341f
+#define FAST_EXP_LN2_HIGH     0.693359375f
+#define FAST_EXP_LN2_LOW     -2.12194440e-4f
+#define FAST_EXP_C0           1.9875691500e-4f
+#define FAST_EXP_C1           1.3981999507e-3f
+#define FAST_EXP_C2           8.3334519073e-3f
+#define FAST_EXP_C3           4.1665795894e-2f
+#define FAST_EXP_C4           1.6666665459e-1f
+#define FAST_EXP_C5           5.0000001201e-1f
+
+#define FAST_TANH_SMALL_LIMIT 0.625f
+#define FAST_TANH_C0         -5.70498872745e-3f
+#define FAST_TANH_C1          2.06390887954e-2f
+#define FAST_TANH_C2         -5.37397155531e-2f
+#define FAST_TANH_C3          1.33314422036e-1f
+#define FAST_TANH_C4         -3.33332819422e-1f
+
+/**
+ * @brief Aproksimasi exp(x) scalar dengan polinomial (tanpa memanggil libm)
+ */
+static inline float
+scalar_fast_exp(float input_value)
+{
+    float x = input_value < FAST_EXP_INPUT_MIN ? FAST_EXP_INPUT_MIN
+            : (input_value > FAST_EXP_INPUT_MAX ? FAST_EXP_INPUT_MAX : input_value);
+    float scaled = x * FAST_EXP_LOG2E;
+    int32_t exponent = (int32_t)(scaled + (scaled >= 0.0f ? 0.5f : -0.5f));
+    float exponent_value = (float)exponent;
+    float r = x - exponent_value * FAST_EXP_LN2_HIGH - exponent_value * FAST_EXP_LN2_LOW;
+
+    float polynomial = FAST_EXP_C0;
+    polynomial = polynomial * r + FAST_EXP_C1;
+    polynomial = polynomial * r + FAST_EXP_C2;
+    polynomial = polynomial * r + FAST_EXP_C3;
+    polynomial = polynomial * r + FAST_EXP_C4;
+    polynomial = polynomial * r + FAST_EXP_C5;
+    polynomial = polynomial * r * r + r + 1.0f;
+
+    uint32_t scale_bits = (uint32_t)(exponent + 127) << 23;
+    float scale;
+    memcpy(&scale, &scale_bits, sizeof(scale));
+
+    return polynomial * scale;
+}
+
+/**
+ * @brief Aproksimasi tanh(x) scalar: polinomial ganjil untuk |x| kecil, 1 - 2 / (exp(2|x|) + 1) selainnya
+ */
+static inline float
+scalar_fast_tanh(float input_value)
+{
+    float absolute_value = fabsf(input_value);
+
+    if (absolute_value < FAST_TANH_SMALL_LIMIT) {
+        float z = input_value * input_value;
+        float polynomial = FAST_TANH_C0;
+        polynomial = polynomial * z + FAST_TANH_C1;
+        polynomial = polynomial * z + FAST_TANH_C2;
+        polynomial = polynomial * z + FAST_TANH_C3;
+        polynomial = polynomial * z + FAST_TANH_C4;
+        return polynomial * z * input_value + input_value;
+    }
+
+    float result = 1.0f - 2.0f / (scalar_fast_exp(2.0f * absolute_value) + 1.0f);
+    return input_value < 0.0f ? -result : result;
+}
+
+static void
+scalar_vector_activation_fast(float *values, size_t count, enum ActivationType activation_type)
+{
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (size_t idx = 0; idx < count; ++idx) values[idx] = 1.0f / (1.0f + scalar_fast_exp(-values[idx]));
+            return;
+        case ACTIVATION_TANH:
+            for (size_t idx = 0; idx < count; ++idx) values[idx] = scalar_fast_tanh(values[idx]);
+            return;
+        case ACTIVATION_RELU:
+        case ACTIVATION_NONE:
+            scalar_vector_activation(values, count, activation_type);
+            return;
+    }
+
+    assert(0 && "Unknown activation type");
+}
+
+static void
+scalar_vector_activation_derivative(float *gradient_values, const float *activated_values,
+                                    size_t count, enum ActivationType activation_type)
+{
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (size_t idx = 0; idx < count; ++idx)
+                gradient_values[idx] *= activated_values[idx] * (1.0f - activated_values[idx]);
+            return;
+        case ACTIVATION_TANH:
+            for (size_t idx = 0; idx < count; ++idx)
+                gradient_values[idx] *= 1.0f - activated_values[idx] * activated_values[idx];
+            return;
+        case ACTIVATION_RELU:
+            for (size_t idx = 0; idx < count; ++idx)
+                if (!(activated_values[idx] >= 0.0f)) gradient_values[idx] = 0.0f;
+            return;
+        case ACTIVATION_NONE:
+            return;
+    }
+
+    assert(0 && "Unknown activation type");
+}
+
+/**
+ * @brief Menyiapkan tile sementara untuk tile di tepi matrix
+ *
+ * Tile diisi nol, lalu jika accumulate, nilai C yang valid disalin ke tile
+ * sehingga micro-kernel bisa memperlakukannya seperti tile penuh.
+ */
+static void
+simd_load_partial_tile(float *tile, size_t tile_row_stride, size_t tile_rows,
+                       const float *c, size_t c_row_stride, size_t rows, size_t columns, bool accumulate)
+{
+    memset(tile, 0, sizeof(*tile) * tile_rows * tile_row_stride);
+    if (!accumulate) return;
+
+    for (size_t row = 0; row < rows; ++row)
+        memcpy(tile + row * tile_row_stride, c + row * c_row_stride, sizeof(*tile) * columns);
+}
+
+/**
+ * @brief Menyalin bagian valid tile sementara ke C (untuk tile di tepi matrix)
+ */
+static void
+simd_store_partial_tile(const float *tile, size_t tile_row_stride,
+                        float *c, size_t c_row_stride, size_t rows, size_t columns)
+{
+    for (size_t row = 0; row < rows; ++row)
+        memcpy(c + row * c_row_stride, tile + row * tile_row_stride, sizeof(*tile) * columns);
+}
+
+/**
+ * @brief Mendapatkan pointer bias sepanjang NR untuk satu tile
+ *
+ * Untuk tile di tepi, bias yang valid disalin ke padded_bias (sisanya nol)
+ * agar load vektor tidak membaca di luar array bias.
+ *
+ * @return Pointer ke NR nilai bias, atau NULL jika epilogue tidak memiliki bias
+ */
+static const float *
+simd_epilogue_bias(const struct GemmEpilogue *epilogue, size_t columns, size_t nr, float *padded_bias)
+{
+    if (epilogue == NULL || epilogue->bias == NULL) return NULL;
+    if (columns == nr) return epilogue->bias;
+
+    memset(padded_bias, 0, sizeof(*padded_bias) * nr);
+    memcpy(padded_bias, epilogue->bias, sizeof(*padded_bias) * columns);
+    return padded_bias;
+}
+
+/**
+ * @brief Apakah aktivasi epilogue harus dihitung dengan libm setelah tile disimpan
+ *
+ * Aktivasi exact (expf/tanhf) tidak tersedia dalam bentuk vektor, sehingga
+ * diterapkan pada tile di C yang masih berada di L1.
+ */
+static bool
+simd_epilogue_needs_exact(const struct GemmEpilogue *epilogue)
+{
+    return epilogue != NULL && !epilogue->use_fast_activation &&
+           (epilogue->activation_type == ACTIVATION_SIGMOID || epilogue->activation_type == ACTIVATION_TANH);
+}
+
+/**
+ * @brief Menerapkan aktivasi exact pada tile yang sudah disimpan di C
+ */
+static void
+simd_epilogue_finish(const struct GemmEpilogue *epilogue, float *c, size_t c_row_stride, size_t rows, size_t columns)
+{
+    if (!simd_epilogue_needs_exact(epilogue)) return;
+
+    for (size_t row = 0; row < rows; ++row)
+        scalar_vector_activation(c + row * c_row_stride, columns, epilogue->activation_type);
+}
+
+/**
+ * @brief Micro-kernel GEMM scalar 4x8 (fallback untuk semua CPU)
+ */
+static void
+scalar_gemm_micro_kernel(size_t kc, const float *packed_a, const float *packed_b,
+                         float *c, size_t c_row_stride, size_t rows, size_t columns, bool accumulate,
+                         const struct GemmEpilogue *epilogue)
+{
+    enum { MR = 4, NR = 8 };
+    float accumulator[MR][NR] = {{0.0f}};
+
+    for (size_t k_idx = 0; k_idx < kc; ++k_idx) {
+        for (size_t row = 0; row < MR; ++row) {
+            float a_value = packed_a[row];
+
+            for (size_t column = 0; column < NR; ++column)
+                accumulator[row][column] += a_value * packed_b[column];
+        }
+
+        packed_a += MR;
+        packed_b += NR;
+    }
+
+    const float *bias = epilogue != NULL ? epilogue->bias : NULL;
+
+    for (size_t row = 0; row < rows; ++row) {
+        float *c_row = c + row * c_row_stride;
+
+        for (size_t column = 0; column < columns; ++column) {
+            float value = accumulator[row][column];
+            if (accumulate) value += c_row[column];
+            if (bias != NULL) value += bias[column];
+            c_row[column] = value;
+        }
+
+        // Baris tile masih di L1, aktivasi langsung diterapkan sebelum pindah ke baris berikutnya
+        if (epilogue != NULL) {
+            if (epilogue->use_fast_activation)
+                scalar_vector_activation_fast(c_row, columns, epilogue->activation_type);
+            else
+                scalar_vector_activation(c_row, columns, epilogue->activation_type);
+        }
+    }
+}
+
+static void
+scalar_vector_axpy(float *destination, const float *source, float alpha, size_t count)
+{
+    for (size_t idx = 0; idx < count; ++idx) destination[idx] += alpha * source[idx];
+}
+
+/**
+ * @brief Update SGD momentum: velocity = momentum * velocity + g; parameter -= lr * velocity
+ */
+static void
+scalar_optimizer_momentum(float *parameters, const float *gradients, float *velocity, size_t count,
+                          float learning_rate, float momentum)
+{
+    for (size_t idx = 0; idx < count; ++idx) {
+        float new_velocity = momentum * velocity[idx] + gradients[idx];
+        velocity[idx] = new_velocity;
+        parameters[idx] -= learning_rate * new_velocity;
+    }
+}
+
+/**
+ * @brief Update RMSProp: mean_square = decay * mean_square + (1 - decay) * g^2;
+ *        parameter -= lr * g / (sqrt(mean_square) + epsilon)
+ */
+static void
+scalar_optimizer_rmsprop(float *parameters, const float *gradients, float *mean_square, size_t count,
+                         float learning_rate, float decay, float epsilon)
+{
+    for (size_t idx = 0; idx < count; ++idx) {
+        float gradient = gradients[idx];
+        float new_mean_square = decay * mean_square[idx] + (1.0f - decay) * gradient * gradient;
+        mean_square[idx] = new_mean_square;
+        parameters[idx] -= learning_rate * gradient / (sqrtf(new_mean_square) + epsilon);
+    }
+}
+
+/**
+ * @brief Update Adam dengan koreksi bias yang sudah dilipat ke step_size dan epsilon
+ */
+static void
+scalar_optimizer_adam(float *parameters, const float *gradients, float *first_moment, float *second_moment,
+                      size_t count, float step_size, float beta1, float beta2, float epsilon)
+{
+    for (size_t idx = 0; idx < count; ++idx) {
+        float gradient = gradients[idx];
+        float new_first = beta1 * first_moment[idx] + (1.0f - beta1) * gradient;
+        float new_second = beta2 * second_moment[idx] + (1.0f - beta2) * gradient * gradient;
+
+        first_moment[idx] = new_first;
+        second_moment[idx] = new_second;
+        parameters[idx] -= step_size * new_first / (sqrtf(new_second) + epsilon);
+    }
+}
+
+/**
+ * @brief Menerapkan aktivasi epilogue int8 pada satu baris output
+ */
+static void
+scalar_quantized_epilogue_activation(float *c_row, size_t columns, const struct QuantizedGemmEpilogue *epilogue)
+{
+    if (epilogue->use_fast_activation)
+        scalar_vector_activation_fast(c_row, columns, epilogue->activation_type);
+    else
+        scalar_vector_activation(c_row, columns, epilogue->activation_type);
+}
+
+/**
+ * @brief GEMM int8 scalar 4x16 dengan akumulator int32 (fallback untuk semua CPU)
+ */
+static void
+scalar_gemm_int8_kernel(size_t k_groups, const uint8_t *a, size_t a_row_stride, const int8_t *packed_b,
+                        float *c, size_t c_row_stride, size_t rows, size_t columns,
+                        const struct QuantizedGemmEpilogue *epilogue)
+{
+    enum { MR = SIMD_INT8_GEMM_MR, NR = SIMD_INT8_GEMM_NR };
+    int32_t accumulator[MR][NR] = {{0}};
+
+    for (size_t group_idx = 0; group_idx < k_groups; ++group_idx) {
+        const int8_t *b_group = packed_b + group_idx * NR * 4;
+
+        for (size_t row = 0; row < rows; ++row) {
+            const uint8_t *a_group = a + row * a_row_stride + group_idx * 4;
+
+            for (size_t column = 0; column < NR; ++column) {
+                const int8_t *b_column = b_group + column * 4;
+                accumulator[row][column] += a_group[0] * b_column[0] + a_group[1] * b_column[1]
+                                          + a_group[2] * b_column[2] + a_group[3] * b_column[3];
+            }
+        }
+    }
+
+    for (size_t row = 0; row < rows; ++row) {
+        float *c_row = c + row * c_row_stride;
+        float row_scale = epilogue->row_scales[row];
+
+        for (size_t column = 0; column < columns; ++column) {
+            float value = (float)(accumulator[row][column] - epilogue->column_offsets[column]);
+            c_row[column] = value * (row_scale * epilogue->column_scales[column]) + epilogue->bias[column];
+        }
+
+        scalar_quantized_epilogue_activation(c_row, columns, epilogue);
+    }
+}
+
+/**
+ * @brief Baris CSR x blok dense (scalar)
+ */
+static void
+scalar_sparse_row_kernel(float *destination, const float *values, const uint32_t *indexes,
+                         size_t nonzero_count, const float *dense, size_t dense_stride, size_t lanes)
+{
+    float accumulator[SIMD_SPARSE_MAX_LANES] = {0.0f};
+
+    for (size_t nonzero_idx = 0; nonzero_idx < nonzero_count; ++nonzero_idx) {
+        float value = values[nonzero_idx];
+        const float *dense_row = dense + (size_t)indexes[nonzero_idx] * dense_stride;
+
+        for (size_t lane = 0; lane < lanes; ++lane) accumulator[lane] += value * dense_row[lane];
+    }
+
+    memcpy(destination, accumulator, sizeof(float) * lanes);
+}
+
+#if defined(NN_SIMD_X86)
+
+// ==========================[ SSE2 - IMPLEMENTATION ]==========================
+
+__attribute__((target("sse2"))) static void
+sse2_vector_add(float *destination, const float *source, size_t count)
+{
+    size_t idx = 0;
+    for (; idx + 4 <= count; idx += 4)
+        _mm_storeu_ps(destination + idx, _mm_add_ps(_mm_loadu_ps(destination + idx), _mm_loadu_ps(source + idx)));
+    for (; idx < count; ++idx) destination[idx] += source[idx];
+}
+
+__attribute__((target("sse2"))) static void
+sse2_vector_copy(float *destination, const float *source, size_t count)
+{
+    size_t idx = 0;
+    for (; idx + 4 <= count; idx += 4) _mm_storeu_ps(destination + idx, _mm_loadu_ps(source + idx));
+    for (; idx < count; ++idx) destination[idx] = source[idx];
+}
+
+__attribute__((target("sse2"))) static void
+sse2_vector_fill(float *destination, float value, size_t count)
+{
+    __m128 fill_vector = _mm_set1_ps(value);
+    size_t idx = 0;
+    for (; idx + 4 <= count; idx += 4) _mm_storeu_ps(destination + idx, fill_vector);
+    for (; idx < count; ++idx) destination[idx] = value;
+}
+
+__attribute__((target("sse2"))) static void
+sse2_vector_activation(float *values, size_t count, enum ActivationType activation_type)
+{
+    if (activation_type != ACTIVATION_RELU) {
+        scalar_vector_activation(values, count, activation_type);
+        return;
+    }
+
+    __m128 zero = _mm_setzero_ps();
+    size_t idx = 0;
+    for (; idx + 4 <= count; idx += 4) _mm_storeu_ps(values + idx, _mm_max_ps(_mm_loadu_ps(values + idx), zero));
+    for (; idx < count; ++idx) values[idx] = activation_relu(values[idx]);
+}
+
+/**
+ * @brief Aproksimasi exp untuk 4 float sekaligus (SSE2)
+ */
+__attribute__((target("sse2"))) static inline __m128
+sse2_fast_exp(__m128 x)
+{
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(FAST_EXP_INPUT_MIN)), _mm_set1_ps(FAST_EXP_INPUT_MAX));
+
+    __m128i exponent = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(FAST_EXP_LOG2E)));
+    __m128 exponent_value = _mm_cvtepi32_ps(exponent);
+    __m128 r = _mm_sub_ps(x, _mm_mul_ps(exponent_value, _mm_set1_ps(FAST_EXP_LN2_HIGH)));
+    r = _mm_sub_ps(r, _mm_mul_ps(exponent_value, _mm_set1_ps(FAST_EXP_LN2_LOW)));
+
+    __m128 polynomial = _mm_set1_ps(FAST_EXP_C0);
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, r), _mm_set1_ps(FAST_EXP_C1));
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, r), _mm_set1_ps(FAST_EXP_C2));
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, r), _mm_set1_ps(FAST_EXP_C3));
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, r), _mm_set1_ps(FAST_EXP_C4));
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, r), _mm_set1_ps(FAST_EXP_C5));
+    polynomial = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(polynomial, r), r), r), _mm_set1_ps(1.0f));
+
+    __m128i scale_bits = _mm_slli_epi32(_mm_add_epi32(exponent, _mm_set1_epi32(127)), 23);
+    return _mm_mul_ps(polynomial, _mm_castsi128_ps(scale_bits));
+}
+
+__attribute__((target("sse2"))) static inline __m128
+sse2_fast_sigmoid(__m128 x)
+{
+    __m128 one = _mm_set1_ps(1.0f);
+    return _mm_div_ps(one, _mm_add_ps(one, sse2_fast_exp(_mm_sub_ps(_mm_setzero_ps(), x))));
+}
+
+__attribute__((target("sse2"))) static inline __m128
+sse2_fast_tanh(__m128 x)
+{
+    __m128 sign_mask = _mm_set1_ps(-0.0f);
+    __m128 sign_bits = _mm_and_ps(x, sign_mask);
+    __m128 absolute_value = _mm_andnot_ps(sign_mask, x);
+    __m128 one = _mm_set1_ps(1.0f);
+
+    // Cabang |x| besar: 1 - 2 / (exp(2|x|) + 1), tanda dikembalikan di akhir
+    __m128 exp_value = sse2_fast_exp(_mm_add_ps(absolute_value, absolute_value));
+    __m128 large_result = _mm_sub_ps(one, _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(exp_value, one)));
+    large_result = _mm_or_ps(large_result, sign_bits);
+
+    // Cabang |x| kecil: polinomial ganjil
+    __m128 z = _mm_mul_ps(x, x);
+    __m128 polynomial = _mm_set1_ps(FAST_TANH_C0);
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, z), _mm_set1_ps(FAST_TANH_C1));
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, z), _mm_set1_ps(FAST_TANH_C2));
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, z), _mm_set1_ps(FAST_TANH_C3));
+    polynomial = _mm_add_ps(_mm_mul_ps(polynomial, z), _mm_set1_ps(FAST_TANH_C4));
+    __m128 small_result = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(polynomial, z), x), x);
+
+    __m128 is_small = _mm_cmplt_ps(absolute_value, _mm_set1_ps(FAST_TANH_SMALL_LIMIT));
+    return _mm_or_ps(_mm_and_ps(is_small, small_result), _mm_andnot_ps(is_small, large_result));
+}
+
+__attribute__((target("sse2"))) static void
+sse2_vector_activation_fast(float *values, size_t count, enum ActivationType activation_type)
+{
+    size_t idx = 0;
+
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (; idx + 4 <= count; idx += 4) _mm_storeu_ps(values + idx, sse2_fast_sigmoid(_mm_loadu_ps(values + idx)));
+            break;
+        case ACTIVATION_TANH:
+            for (; idx + 4 <= count; idx += 4) _mm_storeu_ps(values + idx, sse2_fast_tanh(_mm_loadu_ps(values + idx)));
+            break;
+        case ACTIVATION_RELU:
+        case ACTIVATION_NONE:
+            sse2_vector_activation(values, count, activation_type);
+            return;
+    }
+
+    scalar_vector_activation_fast(values + idx, count - idx, activation_type);
+}
+
+__attribute__((target("sse2"))) static void
+sse2_vector_activation_derivative(float *gradient_values, const float *activated_values,
+                                  size_t count, enum ActivationType activation_type)
+{
+    __m128 one = _mm_set1_ps(1.0f);
+    size_t idx = 0;
+
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (; idx + 4 <= count; idx += 4) {
+                __m128 activated = _mm_loadu_ps(activated_values + idx);
+                __m128 derivative = _mm_mul_ps(activated, _mm_sub_ps(one, activated));
+                _mm_storeu_ps(gradient_values + idx, _mm_mul_ps(_mm_loadu_ps(gradient_values + idx), derivative));
+            }
+            break;
+        case ACTIVATION_TANH:
+            for (; idx + 4 <= count; idx += 4) {
+                __m128 activated = _mm_loadu_ps(activated_values + idx);
+                __m128 derivative = _mm_sub_ps(one, _mm_mul_ps(activated, activated));
+                _mm_storeu_ps(gradient_values + idx, _mm_mul_ps(_mm_loadu_ps(gradient_values + idx), derivative));
+            }
+            break;
+        case ACTIVATION_RELU:
+            for (; idx + 4 <= count; idx += 4) {
+                __m128 is_active = _mm_cmpge_ps(_mm_loadu_ps(activated_values + idx), _mm_setzero_ps());
+                _mm_storeu_ps(gradient_values + idx, _mm_and_ps(_mm_loadu_ps(gradient_values + idx), is_active));
+            }
+            break;
+        case ACTIVATION_NONE:
+            return;
+    }
+
+    scalar_vector_activation_derivative(gradient_values + idx, activated_values + idx, count - idx, activation_type);
+}
+
+/**
+ * @brief Aktivasi epilogue di register (exact sigmoid/tanh ditunda ke simd_epilogue_finish)
+ */
+__attribute__((target("sse2"))) static inline __m128
+sse2_epilogue_activation(__m128 x, const struct GemmEpilogue *epilogue)
+{
+    switch (epilogue->activation_type) {
+        case ACTIVATION_RELU: return _mm_max_ps(x, _mm_setzero_ps());
+        case ACTIVATION_SIGMOID: return epilogue->use_fast_activation ? sse2_fast_sigmoid(x) : x;
+        case ACTIVATION_TANH: return epilogue->use_fast_activation ? sse2_fast_tanh(x) : x;
+        case ACTIVATION_NONE: return x;
+    }
+    return x;
+}
+
+__attribute__((target("sse2"))) static void
+sse2_vector_axpy(float *destination, const float *source, float alpha, size_t count)
+{
+    __m128 alpha_vector = _mm_set1_ps(alpha);
+    size_t idx = 0;
+    for (; idx + 4 <= count; idx += 4)
+        _mm_storeu_ps(destination + idx, _mm_add_ps(_mm_loadu_ps(destination + idx),
+                                                    _mm_mul_ps(alpha_vector, _mm_loadu_ps(source + idx))));
+    for (; idx < count; ++idx) destination[idx] += alpha * source[idx];
+}
+
+/**
+ * @brief Micro-kernel GEMM SSE2 4x8 (8 akumulator) dengan epilogue bias + aktivasi
+ */
+__attribute__((target("sse2"))) static void
+sse2_gemm_micro_kernel(size_t kc, const float *packed_a, const float *packed_b,
+                      float *c, size_t c_row_stride, size_t rows, size_t columns, bool accumulate,
+                      const struct GemmEpilogue *epilogue)
+{
+    enum { MR = 4, NR = 8 };
+    __m128 accumulator[MR][2];
+
+    for (size_t row = 0; row < MR; ++row) {
+        accumulator[row][0] = _mm_setzero_ps();
+        accumulator[row][1] = _mm_setzero_ps();
+    }
+
+    for (size_t k_idx = 0; k_idx < kc; ++k_idx) {
+        __m128 b0 = _mm_load_ps(packed_b + 0);
+        __m128 b1 = _mm_load_ps(packed_b + 4);
+
+        for (size_t row = 0; row < MR; ++row) {
+            __m128 a_value = _mm_set1_ps(packed_a[row]);
+            accumulator[row][0] = _mm_add_ps(accumulator[row][0], _mm_mul_ps(a_value, b0));
+            accumulator[row][1] = _mm_add_ps(accumulator[row][1], _mm_mul_ps(a_value, b1));
+        }
+
+        packed_a += MR;
+        packed_b += NR;
+    }
+
+    float tile[MR * NR];
+    float padded_bias[NR];
+    float *destination = c;
+    size_t destination_stride = c_row_stride;
+    bool is_full_tile = rows == MR && columns == NR;
+
+    if (!is_full_tile) {
+        simd_load_partial_tile(tile, NR, MR, c, c_row_stride, rows, columns, accumulate);
+        destination = tile;
+        destination_stride = NR;
+    }
+
+    const float *bias = simd_epilogue_bias(epilogue, columns, NR, padded_bias);
+    __m128 bias0 = bias != NULL ? _mm_loadu_ps(bias + 0) : _mm_setzero_ps();
+    __m128 bias1 = bias != NULL ? _mm_loadu_ps(bias + 4) : _mm_setzero_ps();
+
+    for (size_t row = 0; row < MR; ++row) {
+        float *destination_row = destination + row * destination_stride;
+
+        if (accumulate) {
+            accumulator[row][0] = _mm_add_ps(accumulator[row][0], _mm_loadu_ps(destination_row + 0));
+            accumulator[row][1] = _mm_add_ps(accumulator[row][1], _mm_loadu_ps(destination_row + 4));
+        }
+        if (epilogue != NULL) {
+            accumulator[row][0] = sse2_epilogue_activation(_mm_add_ps(accumulator[row][0], bias0), epilogue);
+            accumulator[row][1] = sse2_epilogue_activation(_mm_add_ps(accumulator[row][1], bias1), epilogue);
+        }
+        _mm_storeu_ps(destination_row + 0, accumulator[row][0]);
+        _mm_storeu_ps(destination_row + 4, accumulator[row][1]);
+    }
+
+    if (!is_full_tile) simd_store_partial_tile(tile, NR, c, c_row_stride, rows, columns);
+    simd_epilogue_finish(epilogue, c, c_row_stride, rows, columns);
+}
+
+__attribute__((target("sse2"))) static void
+sse2_optimizer_momentum(float *parameters, const float *gradients, float *velocity, size_t count,
+                        float learning_rate, float momentum)
+{
+    __m128 learning_rate_vector = _mm_set1_ps(learning_rate);
+    __m128 momentum_vector = _mm_set1_ps(momentum);
+
+    size_t idx = 0;
+    for (; idx + 4 <= count; idx += 4) {
+        __m128 gradient = _mm_loadu_ps(gradients + idx);
+        __m128 parameter = _mm_loadu_ps(parameters + idx);
+        __m128 new_velocity = _mm_add_ps(_mm_mul_ps(momentum_vector, _mm_loadu_ps(velocity + idx)), gradient);
+
+        _mm_storeu_ps(velocity + idx, new_velocity);
+        _mm_storeu_ps(parameters + idx, _mm_sub_ps(parameter, _mm_mul_ps(learning_rate_vector, new_velocity)));
+    }
+
+    scalar_optimizer_momentum(parameters + idx, gradients + idx, velocity + idx, count - idx,
+                              learning_rate, momentum);
+}
+
+__attribute__((target("sse2"))) static void
+sse2_optimizer_rmsprop(float *parameters, const float *gradients, float *mean_square, size_t count,
+                       float learning_rate, float decay, float epsilon)
+{
+    __m128 learning_rate_vector = _mm_set1_ps(learning_rate);
+    __m128 decay_vector = _mm_set1_ps(decay);
+    __m128 one_minus_decay = _mm_set1_ps(1.0f - decay);
+    __m128 epsilon_vector = _mm_set1_ps(epsilon);
+
+    size_t idx = 0;
+    for (; idx + 4 <= count; idx += 4) {
+        __m128 gradient = _mm_loadu_ps(gradients + idx);
+        __m128 parameter = _mm_loadu_ps(parameters + idx);
+        __m128 old_mean_square = _mm_loadu_ps(mean_square + idx);
+
+        __m128 new_mean_square = _mm_add_ps(_mm_mul_ps(one_minus_decay, _mm_mul_ps(gradient, gradient)),
+                                            _mm_mul_ps(decay_vector, old_mean_square));
+        __m128 step = _mm_div_ps(_mm_mul_ps(learning_rate_vector, gradient),
+                                 _mm_add_ps(_mm_sqrt_ps(new_mean_square), epsilon_vector));
+
+        _mm_storeu_ps(mean_square + idx, new_mean_square);
+        _mm_storeu_ps(parameters + idx, _mm_sub_ps(parameter, step));
+    }
+
+    scalar_optimizer_rmsprop(parameters + idx, gradients + idx, mean_square + idx, count - idx,
+                             learning_rate, decay, epsilon);
+}
+
+__attribute__((target("sse2"))) static void
+sse2_optimizer_adam(float *parameters, const float *gradients, float *first_moment, float *second_moment,
+                    size_t count, float step_size, float beta1, float beta2, float epsilon)
+{
+    __m128 step_size_vector = _mm_set1_ps(step_size);
+    __m128 beta1_vector = _mm_set1_ps(beta1);
+    __m128 beta2_vector = _mm_set1_ps(beta2);
+    __m128 one_minus_beta1 = _mm_set1_ps(1.0f - beta1);
+    __m128 one_minus_beta2 = _mm_set1_ps(1.0f - beta2);
+    __m128 epsilon_vector = _mm_set1_ps(epsilon);
+
+    size_t idx = 0;
+    for (; idx + 4 <= count; idx += 4) {
+        __m128 gradient = _mm_loadu_ps(gradients + idx);
+        __m128 parameter = _mm_loadu_ps(parameters + idx);
+        __m128 old_first = _mm_loadu_ps(first_moment + idx);
+        __m128 old_second = _mm_loadu_ps(second_moment + idx);
+
+        __m128 new_first = _mm_add_ps(_mm_mul_ps(one_minus_beta1, gradient), _mm_mul_ps(beta1_vector, old_first));
+        __m128 new_second = _mm_add_ps(_mm_mul_ps(one_minus_beta2, _mm_mul_ps(gradient, gradient)),
+                                       _mm_mul_ps(beta2_vector, old_second));
+        __m128 step = _mm_div_ps(_mm_mul_ps(step_size_vector, new_first),
+                                 _mm_add_ps(_mm_sqrt_ps(new_second), epsilon_vector));
+
+        _mm_storeu_ps(first_moment + idx, new_first);
+        _mm_storeu_ps(second_moment + idx, new_second);
+        _mm_storeu_ps(parameters + idx, _mm_sub_ps(parameter, step));
+    }
+
+    scalar_optimizer_adam(parameters + idx, gradients + idx, first_moment + idx, second_moment + idx,
+                          count - idx, step_size, beta1, beta2, epsilon);
+}
+
+// ==========================[ AVX2 - IMPLEMENTATION ]==========================
+
+__attribute__((target("avx2"))) static void
+avx2_vector_add(float *destination, const float *source, size_t count)
+{
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8)
+        _mm256_storeu_ps(destination + idx,
+                         _mm256_add_ps(_mm256_loadu_ps(destination + idx), _mm256_loadu_ps(source + idx)));
+    for (; idx < count; ++idx) destination[idx] += source[idx];
+}
+
+__attribute__((target("avx2"))) static void
+avx2_vector_copy(float *destination, const float *source, size_t count)
+{
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8) _mm256_storeu_ps(destination + idx, _mm256_loadu_ps(source + idx));
+    for (; idx < count; ++idx) destination[idx] = source[idx];
+}
+
+__attribute__((target("avx2"))) static void
+avx2_vector_fill(float *destination, float value, size_t count)
+{
+    __m256 fill_vector = _mm256_set1_ps(value);
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8) _mm256_storeu_ps(destination + idx, fill_vector);
+    for (; idx < count; ++idx) destination[idx] = value;
+}
+
+__attribute__((target("avx2"))) static inline __m256i
+avx2_random_hash(__m256i value)
+{
+    value = _mm256_xor_si256(value, _mm256_srli_epi32(value, 16));
+    value = _mm256_mullo_epi32(value, _mm256_set1_epi32(0x7feb352d));
+    value = _mm256_xor_si256(value, _mm256_srli_epi32(value, 15));
+    value = _mm256_mullo_epi32(value, _mm256_set1_epi32((int)0x846ca68bu));
+    value = _mm256_xor_si256(value, _mm256_srli_epi32(value, 16));
+    return value;
+}
+
+/*
+ * Sengaja target("avx2") tanpa "fma": perkalian dan penjumlahan tidak boleh
+ * digabung agar hasil identik dengan versi scalar.
+ */
+__attribute__((target("avx2"))) static void
+avx2_vector_fill_random(float *destination, size_t count, uint32_t counter, uint32_t key_a, uint32_t key_b,
+                        float min_value, float value_range)
+{
+    __m256i lane_offsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i key_a_vector = _mm256_set1_epi32((int)key_a);
+    __m256i key_b_vector = _mm256_set1_epi32((int)key_b);
+    __m256 scale_vector = _mm256_set1_ps(value_range * 0x1p-24f);
+    __m256 min_vector = _mm256_set1_ps(min_value);
+
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8) {
+        __m256i counters = _mm256_add_epi32(_mm256_set1_epi32((int)(counter + (uint32_t)idx)), lane_offsets);
+        __m256i bits = avx2_random_hash(_mm256_add_epi32(avx2_random_hash(_mm256_xor_si256(counters, key_a_vector)),
+                                                         key_b_vector));
+        __m256 product = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 8)), scale_vector);
+        _mm256_storeu_ps(destination + idx, _mm256_add_ps(product, min_vector));
+    }
+    scalar_vector_fill_random(destination + idx, count - idx, counter + (uint32_t)idx, key_a, key_b,
+                              min_value, value_range);
+}
+
+/**
+ * @brief Pelebaran 16-bit ke fp32: vcvtph2ps (F16C) untuk fp16, geser 16 bit untuk bf16
+ */
+__attribute__((target("avx2,f16c"))) static void
+avx2_vector_widen_half(float *destination, const uint16_t *source, size_t count, enum HalfPrecisionFormat format)
+{
+    size_t idx = 0;
+    if (format == HALF_PRECISION_FP16) {
+        for (; idx + 8 <= count; idx += 8)
+            _mm256_storeu_ps(destination + idx, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(source + idx))));
+    } else {
+        for (; idx + 8 <= count; idx += 8) {
+            __m256i widened = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(source + idx)));
+            _mm256_storeu_ps(destination + idx, _mm256_castsi256_ps(_mm256_slli_epi32(widened, 16)));
+        }
+    }
+    scalar_vector_widen_half(destination + idx, source + idx, count - idx, format);
+}
+
+__attribute__((target("avx2,f16c"))) static void
+avx2_vector_narrow_half(uint16_t *destination, const float *source, size_t count, enum HalfPrecisionFormat format)
+{
+    size_t idx = 0;
+    // bf16 hanya dikonversi saat weights diperbarui, cukup versi scalar
+    if (format == HALF_PRECISION_FP16) {
+        for (; idx + 8 <= count; idx += 8)
+            _mm_storeu_si128((__m128i *)(destination + idx),
+                             _mm256_cvtps_ph(_mm256_loadu_ps(source + idx), _MM_FROUND_TO_NEAREST_INT));
+    }
+    scalar_vector_narrow_half(destination + idx, source + idx, count - idx, format);
+}
+
+__attribute__((target("avx2"))) static void
+avx2_vector_activation(float *values, size_t count, enum ActivationType activation_type)
+{
+    if (activation_type != ACTIVATION_RELU) {
+        scalar_vector_activation(values, count, activation_type);
+        return;
+    }
+
+    __m256 zero = _mm256_setzero_ps();
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8)
+        _mm256_storeu_ps(values + idx, _mm256_max_ps(_mm256_loadu_ps(values + idx), zero));
+    for (; idx < count; ++idx) values[idx] = activation_relu(values[idx]);
+}
+
+/**
+ * @brief Aproksimasi exp untuk 8 float sekaligus (AVX2 + FMA)
+ */
+__attribute__((target("avx2,fma"))) static inline __m256
+avx2_fast_exp(__m256 x)
+{
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(FAST_EXP_INPUT_MIN)), _mm256_set1_ps(FAST_EXP_INPUT_MAX));
+
+    __m256 exponent_value = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(FAST_EXP_LOG2E)),
+                                            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(exponent_value, _mm256_set1_ps(FAST_EXP_LN2_HIGH), x);
+    r = _mm256_fnmadd_ps(exponent_value, _mm256_set1_ps(FAST_EXP_LN2_LOW), r);
+
+    __m256 polynomial = _mm256_set1_ps(FAST_EXP_C0);
+    polynomial = _mm256_fmadd_ps(polynomial, r, _mm256_set1_ps(FAST_EXP_C1));
+    polynomial = _mm256_fmadd_ps(polynomial, r, _mm256_set1_ps(FAST_EXP_C2));
+    polynomial = _mm256_fmadd_ps(polynomial, r, _mm256_set1_ps(FAST_EXP_C3));
+    polynomial = _mm256_fmadd_ps(polynomial, r, _mm256_set1_ps(FAST_EXP_C4));
+    polynomial = _mm256_fmadd_ps(polynomial, r, _mm256_set1_ps(FAST_EXP_C5));
+    polynomial = _mm256_fmadd_ps(_mm256_mul_ps(polynomial, r), r, _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+
+    __m256i scale_bits = _mm256_slli_epi32(
+            _mm256_add_epi32(_mm256_cvtps_epi32(exponent_value), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(polynomial, _mm256_castsi256_ps(scale_bits));
+}
+
+__attribute__((target("avx2,fma"))) static inline __m256
+avx2_fast_sigmoid(__m256 x)
+{
+    __m256 one = _mm256_set1_ps(1.0f);
+    return _mm256_div_ps(one, _mm256_add_ps(one, avx2_fast_exp(_mm256_sub_ps(_mm256_setzero_ps(), x))));
+}
+
+__attribute__((target("avx2,fma"))) static inline __m256
+avx2_fast_tanh(__m256 x)
+{
+    __m256 sign_mask = _mm256_set1_ps(-0.0f);
+    __m256 sign_bits = _mm256_and_ps(x, sign_mask);
+    __m256 absolute_value = _mm256_andnot_ps(sign_mask, x);
+    __m256 one = _mm256_set1_ps(1.0f);
+
+    __m256 exp_value = avx2_fast_exp(_mm256_add_ps(absolute_value, absolute_value));
+    __m256 large_result = _mm256_sub_ps(one, _mm256_div_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(exp_value, one)));
+    large_result = _mm256_or_ps(large_result, sign_bits);
+
+    __m256 z = _mm256_mul_ps(x, x);
+    __m256 polynomial = _mm256_set1_ps(FAST_TANH_C0);
+    polynomial = _mm256_fmadd_ps(polynomial, z, _mm256_set1_ps(FAST_TANH_C1));
+    polynomial = _mm256_fmadd_ps(polynomial, z, _mm256_set1_ps(FAST_TANH_C2));
+    polynomial = _mm256_fmadd_ps(polynomial, z, _mm256_set1_ps(FAST_TANH_C3));
+    polynomial = _mm256_fmadd_ps(polynomial, z, _mm256_set1_ps(FAST_TANH_C4));
+    __m256 small_result = _mm256_fmadd_ps(_mm256_mul_ps(polynomial, z), x, x);
+
+    __m256 is_small = _mm256_cmp_ps(absolute_value, _mm256_set1_ps(FAST_TANH_SMALL_LIMIT), _CMP_LT_OQ);
+    return _mm256_blendv_ps(large_result, small_result, is_small);
+}
+
+__attribute__((target("avx2,fma"))) static void
+avx2_vector_activation_fast(float *values, size_t count, enum ActivationType activation_type)
+{
+    size_t idx = 0;
+
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (; idx + 8 <= count; idx += 8)
+                _mm256_storeu_ps(values + idx, avx2_fast_sigmoid(_mm256_loadu_ps(values + idx)));
+            break;
+        case ACTIVATION_TANH:
+            for (; idx + 8 <= count; idx += 8)
+                _mm256_storeu_ps(values + idx, avx2_fast_tanh(_mm256_loadu_ps(values + idx)));
+            break;
+        case ACTIVATION_RELU:
+        case ACTIVATION_NONE:
+            avx2_vector_activation(values, count, activation_type);
+            return;
+    }
+
+    scalar_vector_activation_fast(values + idx, count - idx, activation_type);
+}
+
+__attribute__((target("avx2,fma"))) static void
+avx2_vector_activation_derivative(float *gradient_values, const float *activated_values,
+                                  size_t count, enum ActivationType activation_type)
+{
+    __m256 one = _mm256_set1_ps(1.0f);
+    size_t idx = 0;
+
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (; idx + 8 <= count; idx += 8) {
+                __m256 activated = _mm256_loadu_ps(activated_values + idx);
+                __m256 derivative = _mm256_mul_ps(activated, _mm256_sub_ps(one, activated));
+                _mm256_storeu_ps(gradient_values + idx,
+                                 _mm256_mul_ps(_mm256_loadu_ps(gradient_values + idx), derivative));
+            }
+            break;
+        case ACTIVATION_TANH:
+            for (; idx + 8 <= count; idx += 8) {
+                __m256 activated = _mm256_loadu_ps(activated_values + idx);
+                __m256 derivative = _mm256_fnmadd_ps(activated, activated, one);
+                _mm256_storeu_ps(gradient_values + idx,
+                                 _mm256_mul_ps(_mm256_loadu_ps(gradient_values + idx), derivative));
+            }
+            break;
+        case ACTIVATION_RELU:
+            for (; idx + 8 <= count; idx += 8) {
+                __m256 is_active = _mm256_cmp_ps(_mm256_loadu_ps(activated_values + idx),
+                                                 _mm256_setzero_ps(), _CMP_GE_OQ);
+                _mm256_storeu_ps(gradient_values + idx,
+                                 _mm256_and_ps(_mm256_loadu_ps(gradient_values + idx), is_active));
+            }
+            break;
+        case ACTIVATION_NONE:
+            return;
+    }
+
+    scalar_vector_activation_derivative(gradient_values + idx, activated_values + idx, count - idx, activation_type);
+}
+
+/**
+ * @brief Aktivasi epilogue di register (exact sigmoid/tanh ditunda ke simd_epilogue_finish)
+ */
+__attribute__((target("avx2,fma"))) static inline __m256
+avx2_epilogue_activation(__m256 x, const struct GemmEpilogue *epilogue)
+{
+    switch (epilogue->activation_type) {
+        case ACTIVATION_RELU: return _mm256_max_ps(x, _mm256_setzero_ps());
+        case ACTIVATION_SIGMOID: return epilogue->use_fast_activation ? avx2_fast_sigmoid(x) : x;
+        case ACTIVATION_TANH: return epilogue->use_fast_activation ? avx2_fast_tanh(x) : x;
+        case ACTIVATION_NONE: return x;
+    }
+    return x;
+}
+
+__attribute__((target("avx2,fma"))) static void
+avx2_vector_axpy(float *destination, const float *source, float alpha, size_t count)
+{
+    __m256 alpha_vector = _mm256_set1_ps(alpha);
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8)
+        _mm256_storeu_ps(destination + idx,
+                         _mm256_fmadd_ps(alpha_vector, _mm256_loadu_ps(source + idx), _mm256_loadu_ps(destination + idx)));
+    for (; idx < count; ++idx) destination[idx] += alpha * source[idx];
+}
+
+/**
+ * @brief Micro-kernel GEMM AVX2 6x16 (12 akumulator) dengan epilogue bias + aktivasi
+ */
+__attribute__((target("avx2,fma"))) static void
+avx2_gemm_micro_kernel(size_t kc, const float *packed_a, const float *packed_b,
+                      float *c, size_t c_row_stride, size_t rows, size_t columns, bool accumulate,
+                      const struct GemmEpilogue *epilogue)
+{
+    enum { MR = 6, NR = 16 };
+    __m256 accumulator[MR][2];
+
+    for (size_t row = 0; row < MR; ++row) {
+        accumulator[row][0] = _mm256_setzero_ps();
+        accumulator[row][1] = _mm256_setzero_ps();
+    }
+
+    for (size_t k_idx = 0; k_idx < kc; ++k_idx) {
+        __m256 b0 = _mm256_load_ps(packed_b + 0);
+        __m256 b1 = _mm256_load_ps(packed_b + 8);
+
+        for (size_t row = 0; row < MR; ++row) {
+            __m256 a_value = _mm256_broadcast_ss(packed_a + row);
+            accumulator[row][0] = _mm256_fmadd_ps(a_value, b0, accumulator[row][0]);
+            accumulator[row][1] = _mm256_fmadd_ps(a_value, b1, accumulator[row][1]);
+        }
+
+        packed_a += MR;
+        packed_b += NR;
+    }
+
+    float tile[MR * NR];
+    float padded_bias[NR];
+    float *destination = c;
+    size_t destination_stride = c_row_stride;
+    bool is_full_tile = rows == MR && columns == NR;
+
+    if (!is_full_tile) {
+        simd_load_partial_tile(tile, NR, MR, c, c_row_stride, rows, columns, accumulate);
+        destination = tile;
+        destination_stride = NR;
+    }
+
+    const float *bias = simd_epilogue_bias(epilogue, columns, NR, padded_bias);
+    __m256 bias0 = bias != NULL ? _mm256_loadu_ps(bias + 0) : _mm256_setzero_ps();
+    __m256 bias1 = bias != NULL ? _mm256_loadu_ps(bias + 8) : _mm256_setzero_ps();
+
+    for (size_t row = 0; row < MR; ++row) {
+        float *destination_row = destination + row * destination_stride;
+
+        if (accumulate) {
+            accumulator[row][0] = _mm256_add_ps(accumulator[row][0], _mm256_loadu_ps(destination_row + 0));
+            accumulator[row][1] = _mm256_add_ps(accumulator[row][1], _mm256_loadu_ps(destination_row + 8));
+        }
+        if (epilogue != NULL) {
+            accumulator[row][0] = avx2_epilogue_activation(_mm256_add_ps(accumulator[row][0], bias0), epilogue);
+            accumulator[row][1] = avx2_epilogue_activation(_mm256_add_ps(accumulator[row][1], bias1), epilogue);
+        }
+        _mm256_storeu_ps(destination_row + 0, accumulator[row][0]);
+        _mm256_storeu_ps(destination_row + 8, accumulator[row][1]);
+    }
+
+    if (!is_full_tile) simd_store_partial_tile(tile, NR, c, c_row_stride, rows, columns);
+    simd_epilogue_finish(epilogue, c, c_row_stride, rows, columns);
+}
+
+__attribute__((target("avx2,fma"))) static void
+avx2_optimizer_momentum(float *parameters, const float *gradients, float *velocity, size_t count,
+                        float learning_rate, float momentum)
+{
+    __m256 learning_rate_vector = _mm256_set1_ps(learning_rate);
+    __m256 momentum_vector = _mm256_set1_ps(momentum);
+
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8) {
+        __m256 gradient = _mm256_loadu_ps(gradients + idx);
+        __m256 parameter = _mm256_loadu_ps(parameters + idx);
+        __m256 new_velocity = _mm256_fmadd_ps(momentum_vector, _mm256_loadu_ps(velocity + idx), gradient);
+
+        _mm256_storeu_ps(velocity + idx, new_velocity);
+        _mm256_storeu_ps(parameters + idx, _mm256_fnmadd_ps(learning_rate_vector, new_velocity, parameter));
+    }
+
+    scalar_optimizer_momentum(parameters + idx, gradients + idx, velocity + idx, count - idx,
+                              learning_rate, momentum);
+}
+
+__attribute__((target("avx2,fma"))) static void
+avx2_optimizer_rmsprop(float *parameters, const float *gradients, float *mean_square, size_t count,
+                       float learning_rate, float decay, float epsilon)
+{
+    __m256 learning_rate_vector = _mm256_set1_ps(learning_rate);
+    __m256 decay_vector = _mm256_set1_ps(decay);
+    __m256 one_minus_decay = _mm256_set1_ps(1.0f - decay);
+    __m256 epsilon_vector = _mm256_set1_ps(epsilon);
+
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8) {
+        __m256 gradient = _mm256_loadu_ps(gradients + idx);
+        __m256 parameter = _mm256_loadu_ps(parameters + idx);
+        __m256 old_mean_square = _mm256_loadu_ps(mean_square + idx);
+
+        __m256 new_mean_square = _mm256_fmadd_ps(one_minus_decay,
+                                                 _mm256_mul_ps(gradient, gradient), _mm256_mul_ps(decay_vector, old_mean_square));
+        __m256 step = _mm256_div_ps(_mm256_mul_ps(learning_rate_vector, gradient),
+                                    _mm256_add_ps(_mm256_sqrt_ps(new_mean_square), epsilon_vector));
+
+        _mm256_storeu_ps(mean_square + idx, new_mean_square);
+        _mm256_storeu_ps(parameters + idx, _mm256_sub_ps(parameter, step));
+    }
+
+    scalar_optimizer_rmsprop(parameters + idx, gradients + idx, mean_square + idx, count - idx,
+                             learning_rate, decay, epsilon);
+}
+
+__attribute__((target("avx2,fma"))) static void
+avx2_optimizer_adam(float *parameters, const float *gradients, float *first_moment, float *second_moment,
+                    size_t count, float step_size, float beta1, float beta2, float epsilon)
+{
+    __m256 step_size_vector = _mm256_set1_ps(step_size);
+    __m256 beta1_vector = _mm256_set1_ps(beta1);
+    __m256 beta2_vector = _mm256_set1_ps(beta2);
+    __m256 one_minus_beta1 = _mm256_set1_ps(1.0f - beta1);
+    __m256 one_minus_beta2 = _mm256_set1_ps(1.0f - beta2);
+    __m256 epsilon_vector = _mm256_set1_ps(epsilon);
+
+    size_t idx = 0;
+    for (; idx + 8 <= count; idx += 8) {
+        __m256 gradient = _mm256_loadu_ps(gradients + idx);
+        __m256 parameter = _mm256_loadu_ps(parameters + idx);
+        __m256 old_first = _mm256_loadu_ps(first_moment + idx);
+        __m256 old_second = _mm256_loadu_ps(second_moment + idx);
+
+        __m256 new_first = _mm256_fmadd_ps(one_minus_beta1, gradient, _mm256_mul_ps(beta1_vector, old_first));
+        __m256 new_second = _mm256_fmadd_ps(one_minus_beta2,
+                                            _mm256_mul_ps(gradient, gradient), _mm256_mul_ps(beta2_vector, old_second));
+        __m256 step = _mm256_div_ps(_mm256_mul_ps(step_size_vector, new_first),
+                                    _mm256_add_ps(_mm256_sqrt_ps(new_second), epsilon_vector));
+
+        _mm256_storeu_ps(first_moment + idx, new_first);
+        _mm256_storeu_ps(second_moment + idx, new_second);
+        _mm256_storeu_ps(parameters + idx, _mm256_sub_ps(parameter, step));
+    }
+
+    scalar_optimizer_adam(parameters + idx, gradients + idx, first_moment + idx, second_moment + idx,
+                          count - idx, step_size, beta1, beta2, epsilon);
+}
+
+/**
+ * @brief GEMM int8 AVX2 4x16: vpmaddubsw (u8 x s8 -> s16) lalu vpmaddwd dengan 1 (-> s32)
+ */
+__attribute__((target("avx2,fma"))) static void
+avx2_gemm_int8_kernel(size_t k_groups, const uint8_t *a, size_t a_row_stride, const int8_t *packed_b,
+                      float *c, size_t c_row_stride, size_t rows, size_t columns,
+                      const struct QuantizedGemmEpilogue *epilogue)
+{
+    enum { MR = SIMD_INT8_GEMM_MR, NR = SIMD_INT8_GEMM_NR };
+    const __m256i ones = _mm256_set1_epi16(1);
+    const uint8_t *a_rows[MR];
+    __m256i accumulator[MR][2];
+
+    for (size_t row = 0; row < MR; ++row) {
+        // Baris di luar tile menghitung ulang baris pertama dan tidak disimpan
+        a_rows[row] = a + (row < rows ? row : 0) * a_row_stride;
+        accumulator[row][0] = _mm256_setzero_si256();
+        accumulator[row][1] = _mm256_setzero_si256();
+    }
+
+    for (size_t group_idx = 0; group_idx < k_groups; ++group_idx) {
+        __m256i b0 = _mm256_load_si256((const __m256i *)(packed_b + 0));
+        __m256i b1 = _mm256_load_si256((const __m256i *)(packed_b + 32));
+
+        for (size_t row = 0; row < MR; ++row) {
+            int32_t a_group;
+            memcpy(&a_group, a_rows[row] + group_idx * 4, sizeof(a_group));
+            __m256i a_value = _mm256_set1_epi32(a_group);
+
+            accumulator[row][0] = _mm256_add_epi32(accumulator[row][0],
+                                                   _mm256_madd_epi16(_mm256_maddubs_epi16(a_value, b0), ones));
+            accumulator[row][1] = _mm256_add_epi32(accumulator[row][1],
+                                                   _mm256_madd_epi16(_mm256_maddubs_epi16(a_value, b1), ones));
+        }
+
+        packed_b += NR * 4;
+    }
+
+    __m256i offset0 = _mm256_loadu_si256((const __m256i *)(epilogue->column_offsets + 0));
+    __m256i offset1 = _mm256_loadu_si256((const __m256i *)(epilogue->column_offsets + 8));
+    __m256 scale0 = _mm256_loadu_ps(epilogue->column_scales + 0);
+    __m256 scale1 = _mm256_loadu_ps(epilogue->column_scales + 8);
+    __m256 bias0 = _mm256_loadu_ps(epilogue->bias + 0);
+    __m256 bias1 = _mm256_loadu_ps(epilogue->bias + 8);
+
+    for (size_t row = 0; row < rows; ++row) {
+        __m256 row_scale = _mm256_set1_ps(epilogue->row_scales[row]);
+        __m256 value0 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(accumulator[row][0], offset0)),
+                                        _mm256_mul_ps(row_scale, scale0), bias0);
+        __m256 value1 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(accumulator[row][1], offset1)),
+                                        _mm256_mul_ps(row_scale, scale1), bias1);
+        float *c_row = c + row * c_row_stride;
+
+        if (columns == NR) {
+            _mm256_storeu_ps(c_row + 0, value0);
+            _mm256_storeu_ps(c_row + 8, value1);
+        } else {
+            float tile_row[NR];
+            _mm256_storeu_ps(tile_row + 0, value0);
+            _mm256_storeu_ps(tile_row + 8, value1);
+            memcpy(c_row, tile_row, sizeof(float) * columns);
+        }
+
+        if (epilogue->use_fast_activation)
+            avx2_vector_activation_fast(c_row, columns, epilogue->activation_type);
+        else
+            avx2_vector_activation(c_row, columns, epilogue->activation_type);
+    }
+}
+
+/**
+ * @brief Mask vmaskmovps untuk 8 lane mulai dari lane_start (lane >= lanes dinonaktifkan)
+ */
+__attribute__((target("avx2"))) static inline __m256i
+avx2_lane_mask(size_t lane_start, size_t lanes)
+{
+    __m256i lane_index = _mm256_add_epi32(_mm256_set1_epi32((int)lane_start), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32((int)lanes), lane_index);
+}
+
+/**
+ * @brief Baris CSR x blok dense AVX2: 64 lane dalam 8 akumulator ymm
+ */
+__attribute__((target("avx2,fma"))) static void
+avx2_sparse_row_kernel(float *destination, const float *values, const uint32_t *indexes,
+                       size_t nonzero_count, const float *dense, size_t dense_stride, size_t lanes)
+{
+    enum { VECTOR_COUNT = SIMD_SPARSE_MAX_LANES / 8 };
+    __m256i masks[VECTOR_COUNT];
+    __m256 accumulator[VECTOR_COUNT];
+    size_t vector_count = (lanes + 7) / 8;
+
+    for (size_t vector_idx = 0; vector_idx < VECTOR_COUNT; ++vector_idx) {
+        masks[vector_idx] = avx2_lane_mask(vector_idx * 8, lanes);
+        accumulator[vector_idx] = _mm256_setzero_ps();
+    }
+
+    if (lanes == SIMD_SPARSE_MAX_LANES) {
+        for (size_t nonzero_idx = 0; nonzero_idx < nonzero_count; ++nonzero_idx) {
+            __m256 value = _mm256_set1_ps(values[nonzero_idx]);
+            const float *dense_row = dense + (size_t)indexes[nonzero_idx] * dense_stride;
+
+            for (size_t vector_idx = 0; vector_idx < VECTOR_COUNT; ++vector_idx)
+                accumulator[vector_idx] = _mm256_fmadd_ps(value, _mm256_loadu_ps(dense_row + vector_idx * 8),
+                                                          accumulator[vector_idx]);
+        }
+    } else {
+        for (size_t nonzero_idx = 0; nonzero_idx < nonzero_count; ++nonzero_idx) {
+            __m256 value = _mm256_set1_ps(values[nonzero_idx]);
+            const float *dense_row = dense + (size_t)indexes[nonzero_idx] * dense_stride;
+
+            for (size_t vector_idx = 0; vector_idx < vector_count; ++vector_idx)
+                accumulator[vector_idx] = _mm256_fmadd_ps(
+                    value, _mm256_maskload_ps(dense_row + vector_idx * 8, masks[vector_idx]), accumulator[vector_idx]);
+        }
+    }
+
+    for (size_t vector_idx = 0; vector_idx < vector_count; ++vector_idx)
+        _mm256_maskstore_ps(destination + vector_idx * 8, masks[vector_idx], accumulator[vector_idx]);
+}
+
+// ========================[ AVX-512 - IMPLEMENTATION ]=========================
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_add(float *destination, const float *source, size_t count)
+{
+    size_t idx = 0;
+    for (; idx + 16 <= count; idx += 16)
+        _mm512_storeu_ps(destination + idx,
+                         _mm512_add_ps(_mm512_loadu_ps(destination + idx), _mm512_loadu_ps(source + idx)));
+
+    __mmask16 tail_mask = (__mmask16)((1u << (count - idx)) - 1u);
+    _mm512_mask_storeu_ps(destination + idx, tail_mask,
+                          _mm512_add_ps(_mm512_maskz_loadu_ps(tail_mask, destination + idx),
+                                        _mm512_maskz_loadu_ps(tail_mask, source + idx)));
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_copy(float *destination, const float *source, size_t count)
+{
+    size_t idx = 0;
+    for (; idx + 16 <= count; idx += 16) _mm512_storeu_ps(destination + idx, _mm512_loadu_ps(source + idx));
+
+    __mmask16 tail_mask = (__mmask16)((1u << (count - idx)) - 1u);
+    _mm512_mask_storeu_ps(destination + idx, tail_mask, _mm512_maskz_loadu_ps(tail_mask, source + idx));
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_fill(float *destination, float value, size_t count)
+{
+    __m512 fill_vector = _mm512_set1_ps(value);
+    size_t idx = 0;
+    for (; idx + 16 <= count; idx += 16) _mm512_storeu_ps(destination + idx, fill_vector);
+
+    __mmask16 tail_mask = (__mmask16)((1u << (count - idx)) - 1u);
+    _mm512_mask_storeu_ps(destination + idx, tail_mask, fill_vector);
+}
+
+__attribute__((target("avx512f"))) static inline __m512i
+avx512_random_hash(__m512i value)
+{
+    value = _mm512_xor_si512(value, _mm512_srli_epi32(value, 16));
+    value = _mm512_mullo_epi32(value, _mm512_set1_epi32(0x7feb352d));
+    value = _mm512_xor_si512(value, _mm512_srli_epi32(value, 15));
+    value = _mm512_mullo_epi32(value, _mm512_set1_epi32((int)0x846ca68bu));
+    value = _mm512_xor_si512(value, _mm512_srli_epi32(value, 16));
+    return value;
+}
+
+/*
+ * AVX-512F selalu menyertakan FMA, jadi perkalian dan penjumlahan memakai
+ * varian embedded-rounding yang tidak akan digabung compiler menjadi FMA.
+ */
+__attribute__((target("avx512f"))) static void
+avx512_vector_fill_random(float *destination, size_t count, uint32_t counter, uint32_t key_a, uint32_t key_b,
+                          float min_value, float value_range)
+{
+    __m512i lane_offsets = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m512i key_a_vector = _mm512_set1_epi32((int)key_a);
+    __m512i key_b_vector = _mm512_set1_epi32((int)key_b);
+    __m512 scale_vector = _mm512_set1_ps(value_range * 0x1p-24f);
+    __m512 min_vector = _mm512_set1_ps(min_value);
+
+    for (size_t idx = 0; idx < count; idx += 16) {
+        __mmask16 store_mask = count - idx >= 16 ? (__mmask16)0xffff : (__mmask16)((1u << (count - idx)) - 1u);
+        __m512i counters = _mm512_add_epi32(_mm512_set1_epi32((int)(counter + (uint32_t)idx)), lane_offsets);
+        __m512i bits = avx512_random_hash(
+            _mm512_add_epi32(avx512_random_hash(_mm512_xor_si512(counters, key_a_vector)), key_b_vector));
+        __m512 product = _mm512_mul_round_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(bits, 8)), scale_vector,
+                                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm512_mask_storeu_ps(destination + idx, store_mask,
+                              _mm512_add_round_ps(product, min_vector, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    }
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_widen_half(float *destination, const uint16_t *source, size_t count, enum HalfPrecisionFormat format)
+{
+    size_t idx = 0;
+    if (format == HALF_PRECISION_FP16) {
+        for (; idx + 16 <= count; idx += 16)
+            _mm512_storeu_ps(destination + idx, _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)(source + idx))));
+    } else {
+        for (; idx + 16 <= count; idx += 16) {
+            __m512i widened = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(source + idx)));
+            _mm512_storeu_ps(destination + idx, _mm512_castsi512_ps(_mm512_slli_epi32(widened, 16)));
+        }
+    }
+    scalar_vector_widen_half(destination + idx, source + idx, count - idx, format);
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_narrow_half(uint16_t *destination, const float *source, size_t count, enum HalfPrecisionFormat format)
+{
+    size_t idx = 0;
+    if (format == HALF_PRECISION_FP16) {
+        for (; idx + 16 <= count; idx += 16)
+            _mm256_storeu_si256((__m256i *)(destination + idx),
+                                _mm512_cvtps_ph(_mm512_loadu_ps(source + idx),
+                                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    }
+    scalar_vector_narrow_half(destination + idx, source + idx, count - idx, format);
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_activation(float *values, size_t count, enum ActivationType activation_type)
+{
+    if (activation_type != ACTIVATION_RELU) {
+        scalar_vector_activation(values, count, activation_type);
+        return;
+    }
+
+    __m512 zero = _mm512_setzero_ps();
+    size_t idx = 0;
+    for (; idx + 16 <= count; idx += 16)
+        _mm512_storeu_ps(values + idx, _mm512_max_ps(_mm512_loadu_ps(values + idx), zero));
+
+    __mmask16 tail_mask = (__mmask16)((1u << (count - idx)) - 1u);
+    _mm512_mask_storeu_ps(values + idx, tail_mask,
+                          _mm512_max_ps(_mm512_maskz_loadu_ps(tail_mask, values + idx), zero));
+}
+
+/**
+ * @brief Aproksimasi exp untuk 16 float sekaligus (AVX-512), 2^n melalui vscalefps
+ */
+__attribute__((target("avx512f"))) static inline __m512
+avx512_fast_exp(__m512 x)
+{
+    x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(FAST_EXP_INPUT_MIN)), _mm512_set1_ps(FAST_EXP_INPUT_MAX));
+
+    __m512 exponent_value = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(FAST_EXP_LOG2E)),
+                                                 _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512 r = _mm512_fnmadd_ps(exponent_value, _mm512_set1_ps(FAST_EXP_LN2_HIGH), x);
+    r = _mm512_fnmadd_ps(exponent_value, _mm512_set1_ps(FAST_EXP_LN2_LOW), r);
+
+    __m512 polynomial = _mm512_set1_ps(FAST_EXP_C0);
+    polynomial = _mm512_fmadd_ps(polynomial, r, _mm512_set1_ps(FAST_EXP_C1));
+    polynomial = _mm512_fmadd_ps(polynomial, r, _mm512_set1_ps(FAST_EXP_C2));
+    polynomial = _mm512_fmadd_ps(polynomial, r, _mm512_set1_ps(FAST_EXP_C3));
+    polynomial = _mm512_fmadd_ps(polynomial, r, _mm512_set1_ps(FAST_EXP_C4));
+    polynomial = _mm512_fmadd_ps(polynomial, r, _mm512_set1_ps(FAST_EXP_C5));
+    polynomial = _mm512_fmadd_ps(_mm512_mul_ps(polynomial, r), r, _mm512_add_ps(r, _mm512_set1_ps(1.0f)));
+
+    return _mm512_scalef_ps(polynomial, exponent_value);
+}
+
+__attribute__((target("avx512f"))) static inline __m512
+avx512_fast_sigmoid(__m512 x)
+{
+    __m512 one = _mm512_set1_ps(1.0f);
+    return _mm512_div_ps(one, _mm512_add_ps(one, avx512_fast_exp(_mm512_sub_ps(_mm512_setzero_ps(), x))));
+}
+
+__attribute__((target("avx512f"))) static inline __m512
+avx512_fast_tanh(__m512 x)
+{
+    __m512 absolute_value = _mm512_abs_ps(x);
+    __m512 one = _mm512_set1_ps(1.0f);
+
+    __m512 exp_value = avx512_fast_exp(_mm512_add_ps(absolute_value, absolute_value));
+    __m512 large_result = _mm512_sub_ps(one, _mm512_div_ps(_mm512_set1_ps(2.0f), _mm512_add_ps(exp_value, one)));
+    __mmask16 is_negative = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LT_OQ);
+    large_result = _mm512_mask_sub_ps(large_result, is_negative, _mm512_setzero_ps(), large_result);
+
+    __m512 z = _mm512_mul_ps(x, x);
+    __m512 polynomial = _mm512_set1_ps(FAST_TANH_C0);
+    polynomial = _mm512_fmadd_ps(polynomial, z, _mm512_set1_ps(FAST_TANH_C1));
+    polynomial = _mm512_fmadd_ps(polynomial, z, _mm512_set1_ps(FAST_TANH_C2));
+    polynomial = _mm512_fmadd_ps(polynomial, z, _mm512_set1_ps(FAST_TANH_C3));
+    polynomial = _mm512_fmadd_ps(polynomial, z, _mm512_set1_ps(FAST_TANH_C4));
+    __m512 small_result = _mm512_fmadd_ps(_mm512_mul_ps(polynomial, z), x, x);
+
+    __mmask16 is_small = _mm512_cmp_ps_mask(absolute_value, _mm512_set1_ps(FAST_TANH_SMALL_LIMIT), _CMP_LT_OQ);
+    return _mm512_mask_blend_ps(is_small, large_result, small_result);
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_activation_fast(float *values, size_t count, enum ActivationType activation_type)
+{
+    size_t idx = 0;
+
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (; idx + 16 <= count; idx += 16)
+                _mm512_storeu_ps(values + idx, avx512_fast_sigmoid(_mm512_loadu_ps(values + idx)));
+            break;
+        case ACTIVATION_TANH:
+            for (; idx + 16 <= count; idx += 16)
+                _mm512_storeu_ps(values + idx, avx512_fast_tanh(_mm512_loadu_ps(values + idx)));
+            break;
+        case ACTIVATION_RELU:
+        case ACTIVATION_NONE:
+            avx512_vector_activation(values, count, activation_type);
+            return;
+    }
+
+    scalar_vector_activation_fast(values + idx, count - idx, activation_type);
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_activation_derivative(float *gradient_values, const float *activated_values,
+                                    size_t count, enum ActivationType activation_type)
+{
+    __m512 one = _mm512_set1_ps(1.0f);
+    size_t idx = 0;
+
+    switch (activation_type) {
+        case ACTIVATION_SIGMOID:
+            for (; idx + 16 <= count; idx += 16) {
+                __m512 activated = _mm512_loadu_ps(activated_values + idx);
+                __m512 derivative = _mm512_mul_ps(activated, _mm512_sub_ps(one, activated));
+                _mm512_storeu_ps(gradient_values + idx,
+                                 _mm512_mul_ps(_mm512_loadu_ps(gradient_values + idx), derivative));
+            }
+            break;
+        case ACTIVATION_TANH:
+            for (; idx + 16 <= count; idx += 16) {
+                __m512 activated = _mm512_loadu_ps(activated_values + idx);
+                __m512 derivative = _mm512_fnmadd_ps(activated, activated, one);
+                _mm512_storeu_ps(gradient_values + idx,
+                                 _mm512_mul_ps(_mm512_loadu_ps(gradient_values + idx), derivative));
+            }
+            break;
+        case ACTIVATION_RELU:
+            for (; idx + 16 <= count; idx += 16) {
+                __mmask16 is_active = _mm512_cmp_ps_mask(_mm512_loadu_ps(activated_values + idx),
+                                                         _mm512_setzero_ps(), _CMP_GE_OQ);
+                _mm512_storeu_ps(gradient_values + idx,
+                                 _mm512_maskz_mov_ps(is_active, _mm512_loadu_ps(gradient_values + idx)));
+            }
+            break;
+        case ACTIVATION_NONE:
+            return;
+    }
+
+    scalar_vector_activation_derivative(gradient_values + idx, activated_values + idx, count - idx, activation_type);
+}
+
+/**
+ * @brief Aktivasi epilogue di register (exact sigmoid/tanh ditunda ke simd_epilogue_finish)
+ */
+__attribute__((target("avx512f"))) static inline __m512
+avx512_epilogue_activation(__m512 x, const struct GemmEpilogue *epilogue)
+{
+    switch (epilogue->activation_type) {
+        case ACTIVATION_RELU: return _mm512_max_ps(x, _mm512_setzero_ps());
+        case ACTIVATION_SIGMOID: return epilogue->use_fast_activation ? avx512_fast_sigmoid(x) : x;
+        case ACTIVATION_TANH: return epilogue->use_fast_activation ? avx512_fast_tanh(x) : x;
+        case ACTIVATION_NONE: return x;
+    }
+    return x;
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_vector_axpy(float *destination, const float *source, float alpha, size_t count)
+{
+    __m512 alpha_vector = _mm512_set1_ps(alpha);
+    size_t idx = 0;
+    for (; idx + 16 <= count; idx += 16)
+        _mm512_storeu_ps(destination + idx,
+                         _mm512_fmadd_ps(alpha_vector, _mm512_loadu_ps(source + idx), _mm512_loadu_ps(destination + idx)));
+
+    __mmask16 tail_mask = (__mmask16)((1u << (count - idx)) - 1u);
+    _mm512_mask_storeu_ps(destination + idx, tail_mask,
+                          _mm512_fmadd_ps(alpha_vector, _mm512_maskz_loadu_ps(tail_mask, source + idx),
+                                          _mm512_maskz_loadu_ps(tail_mask, destination + idx)));
+}
+
+/**
+ * @brief Micro-kernel GEMM AVX-512 8x32 (16 akumulator) dengan epilogue bias + aktivasi
+ */
+__attribute__((target("avx512f"))) static void
+avx512_gemm_micro_kernel(size_t kc, const float *packed_a, const float *packed_b,
+                        float *c, size_t c_row_stride, size_t rows, size_t columns, bool accumulate,
+                        const struct GemmEpilogue *epilogue)
+{
+    enum { MR = 8, NR = 32 };
+    __m512 accumulator[MR][2];
+
+    for (size_t row = 0; row < MR; ++row) {
+        accumulator[row][0] = _mm512_setzero_ps();
+        accumulator[row][1] = _mm512_setzero_ps();
+    }
+
+    for (size_t k_idx = 0; k_idx < kc; ++k_idx) {
+        __m512 b0 = _mm512_load_ps(packed_b + 0);
+        __m512 b1 = _mm512_load_ps(packed_b + 16);
+
+        for (size_t row = 0; row < MR; ++row) {
+            __m512 a_value = _mm512_set1_ps(packed_a[row]);
+            accumulator[row][0] = _mm512_fmadd_ps(a_value, b0, accumulator[row][0]);
+            accumulator[row][1] = _mm512_fmadd_ps(a_value, b1, accumulator[row][1]);
+        }
+
+        packed_a += MR;
+        packed_b += NR;
+    }
+
+    float tile[MR * NR];
+    float padded_bias[NR];
+    float *destination = c;
+    size_t destination_stride = c_row_stride;
+    bool is_full_tile = rows == MR && columns == NR;
+
+    if (!is_full_tile) {
+        simd_load_partial_tile(tile, NR, MR, c, c_row_stride, rows, columns, accumulate);
+        destination = tile;
+        destination_stride = NR;
+    }
+
+    const float *bias = simd_epilogue_bias(epilogue, columns, NR, padded_bias);
+    __m512 bias0 = bias != NULL ? _mm512_loadu_ps(bias + 0) : _mm512_setzero_ps();
+    __m512 bias1 = bias != NULL ? _mm512_loadu_ps(bias + 16) : _mm512_setzero_ps();
+
+    for (size_t row = 0; row < MR; ++row) {
+        float *destination_row = destination + row * destination_stride;
+
+        if (accumulate) {
+            accumulator[row][0] = _mm512_add_ps(accumulator[row][0], _mm512_loadu_ps(destination_row + 0));
+            accumulator[row][1] = _mm512_add_ps(accumulator[row][1], _mm512_loadu_ps(destination_row + 16));
+        }
+        if (epilogue != NULL) {
+            accumulator[row][0] = avx512_epilogue_activation(_mm512_add_ps(accumulator[row][0], bias0), epilogue);
+            accumulator[row][1] = avx512_epilogue_activation(_mm512_add_ps(accumulator[row][1], bias1), epilogue);
+        }
+        _mm512_storeu_ps(destination_row + 0, accumulator[row][0]);
+        _mm512_storeu_ps(destination_row + 16, accumulator[row][1]);
+    }
+
+    if (!is_full_tile) simd_store_partial_tile(tile, NR, c, c_row_stride, rows, columns);
+    simd_epilogue_finish(epilogue, c, c_row_stride, rows, columns);
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_optimizer_momentum(float *parameters, const float *gradients, float *velocity, size_t count,
+                          float learning_rate, float momentum)
+{
+    __m512 learning_rate_vector = _mm512_set1_ps(learning_rate);
+    __m512 momentum_vector = _mm512_set1_ps(momentum);
+
+    for (size_t idx = 0; idx < count; idx += 16) {
+        __mmask16 mask = count - idx >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << (count - idx)) - 1u);
+        __m512 gradient = _mm512_maskz_loadu_ps(mask, gradients + idx);
+        __m512 parameter = _mm512_maskz_loadu_ps(mask, parameters + idx);
+        __m512 new_velocity = _mm512_fmadd_ps(momentum_vector,
+                                              _mm512_maskz_loadu_ps(mask, velocity + idx), gradient);
+
+        _mm512_mask_storeu_ps(velocity + idx, mask, new_velocity);
+        _mm512_mask_storeu_ps(parameters + idx,
+                              mask, _mm512_fnmadd_ps(learning_rate_vector, new_velocity, parameter));
+    }
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_optimizer_rmsprop(float *parameters, const float *gradients, float *mean_square, size_t count,
+                         float learning_rate, float decay, float epsilon)
+{
+    __m512 learning_rate_vector = _mm512_set1_ps(learning_rate);
+    __m512 decay_vector = _mm512_set1_ps(decay);
+    __m512 one_minus_decay = _mm512_set1_ps(1.0f - decay);
+    __m512 epsilon_vector = _mm512_set1_ps(epsilon);
+
+    for (size_t idx = 0; idx < count; idx += 16) {
+        __mmask16 mask = count - idx >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << (count - idx)) - 1u);
+        __m512 gradient = _mm512_maskz_loadu_ps(mask, gradients + idx);
+        __m512 parameter = _mm512_maskz_loadu_ps(mask, parameters + idx);
+        __m512 old_mean_square = _mm512_maskz_loadu_ps(mask, mean_square + idx);
+
+        __m512 new_mean_square = _mm512_fmadd_ps(one_minus_decay,
+                                                 _mm512_mul_ps(gradient, gradient), _mm512_mul_ps(decay_vector, old_mean_square));
+        __m512 step = _mm512_div_ps(_mm512_mul_ps(learning_rate_vector, gradient),
+                                    _mm512_add_ps(_mm512_sqrt_ps(new_mean_square), epsilon_vector));
+
+        _mm512_mask_storeu_ps(mean_square + idx, mask, new_mean_square);
+        _mm512_mask_storeu_ps(parameters + idx, mask, _mm512_sub_ps(parameter, step));
+    }
+}
+
+__attribute__((target("avx512f"))) static void
+avx512_optimizer_adam(float *parameters, const float *gradients, float *first_moment, float *second_moment,
+                      size_t count, float step_size, float beta1, float beta2, float epsilon)
+{
+    __m512 step_size_vector = _mm512_set1_ps(step_size);
+    __m512 beta1_vector = _mm512_set1_ps(beta1);
+    __m512 beta2_vector = _mm512_set1_ps(beta2);
+    __m512 one_minus_beta1 = _mm512_set1_ps(1.0f - beta1);
+    __m512 one_minus_beta2 = _mm512_set1_ps(1.0f - beta2);
+    __m512 epsilon_vector = _mm512_set1_ps(epsilon);
+
+    for (size_t idx = 0; idx < count; idx += 16) {
+        __mmask16 mask = count - idx >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << (count - idx)) - 1u);
+        __m512 gradient = _mm512_maskz_loadu_ps(mask, gradients + idx);
+        __m512 parameter = _mm512_maskz_loadu_ps(mask, parameters + idx);
+        __m512 old_first = _mm512_maskz_loadu_ps(mask, first_moment + idx);
+        __m512 old_second = _mm512_maskz_loadu_ps(mask, second_moment + idx);
+
+        __m512 new_first = _mm512_fmadd_ps(one_minus_beta1, gradient, _mm512_mul_ps(beta1_vector, old_first));
+        __m512 new_second = _mm512_fmadd_ps(one_minus_beta2,
+                                            _mm512_mul_ps(gradient, gradient), _mm512_mul_ps(beta2_vector, old_second));
+        __m512 step = _mm512_div_ps(_mm512_mul_ps(step_size_vector, new_first),
+                                    _mm512_add_ps(_mm512_sqrt_ps(new_second), epsilon_vector));
+
+        _mm512_mask_storeu_ps(first_moment + idx, mask, new_first);
+        _mm512_mask_storeu_ps(second_moment + idx, mask, new_second);
+        _mm512_mask_storeu_ps(parameters + idx, mask, _mm512_sub_ps(parameter, step));
+    }
+}
+
+/**
+ * @brief GEMM int8 AVX-512 VNNI 4x16: vpdpbusd (u8 x s8 -> s32) langsung ke akumulator
+ *
+ * Grup K genap dan ganjil memakai akumulator terpisah agar dua rantai
+ * dependensi vpdpbusd berjalan bersamaan, lalu dijumlahkan di akhir.
+ */
+__attribute__((target("avx512f,avx512vnni"))) static void
+avx512vnni_gemm_int8_kernel(size_t k_groups, const uint8_t *a, size_t a_row_stride, const int8_t *packed_b,
+                            float *c, size_t c_row_stride, size_t rows, size_t columns,
+                            const struct QuantizedGemmEpilogue *epilogue)
+{
+    enum { MR = SIMD_INT8_GEMM_MR, NR = SIMD_INT8_GEMM_NR };
+    const uint8_t *a_rows[MR];
+    __m512i accumulator[MR][2];
+
+    for (size_t row = 0; row < MR; ++row) {
+        // Baris di luar tile menghitung ulang baris pertama dan tidak disimpan
+        a_rows[row] = a + (row < rows ? row : 0) * a_row_stride;
+        accumulator[row][0] = _mm512_setzero_si512();
+        accumulator[row][1] = _mm512_setzero_si512();
+    }
+
+    size_t group_idx = 0;
+    for (; group_idx + 2 <= k_groups; group_idx += 2) {
+        __m512i b0 = _mm512_load_si512(packed_b + 0);
+        __m512i b1 = _mm512_load_si512(packed_b + NR * 4);
+
+        for (size_t row = 0; row < MR; ++row) {
+            int32_t a_groups[2];
+            memcpy(a_groups, a_rows[row] + group_idx * 4, sizeof(a_groups));
+
+            accumulator[row][0] = _mm512_dpbusd_epi32(accumulator[row][0], _mm512_set1_epi32(a_groups[0]), b0);
+            accumulator[row][1] = _mm512_dpbusd_epi32(accumulator[row][1], _mm512_set1_epi32(a_groups[1]), b1);
+        }
+
+        packed_b += 2 * NR * 4;
+    }
+
+    if (group_idx < k_groups) {
+        __m512i b0 = _mm512_load_si512(packed_b);
+
+        for (size_t row = 0; row < MR; ++row) {
+            int32_t a_group;
+            memcpy(&a_group, a_rows[row] + group_idx * 4, sizeof(a_group));
+            accumulator[row][0] = _mm512_dpbusd_epi32(accumulator[row][0], _mm512_set1_epi32(a_group), b0);
+        }
+    }
+
+    __mmask16 column_mask = (__mmask16)((1u << columns) - 1u);
+    __m512i offset = _mm512_loadu_si512(epilogue->column_offsets);
+    __m512 scale = _mm512_loadu_ps(epilogue->column_scales);
+    __m512 bias = _mm512_loadu_ps(epilogue->bias);
+
+    for (size_t row = 0; row < rows; ++row) {
+        __m512i sum = _mm512_sub_epi32(_mm512_add_epi32(accumulator[row][0], accumulator[row][1]), offset);
+        __m512 value = _mm512_fmadd_ps(_mm512_cvtepi32_ps(sum),
+                                       _mm512_mul_ps(_mm512_set1_ps(epilogue->row_scales[row]), scale), bias);
+        float *c_row = c + row * c_row_stride;
+
+        _mm512_mask_storeu_ps(c_row, column_mask, value);
+
+        if (epilogue->use_fast_activation)
+            avx512_vector_activation_fast(c_row, columns, epilogue->activation_type);
+        else
+            avx512_vector_activation(c_row, columns, epilogue->activation_type);
+    }
+}
+
+/**
+ * @brief Baris CSR x blok dense AVX-512: 64 lane dalam 4 akumulator zmm
+ *
+ * Nonzero genap dan ganjil memakai akumulator terpisah agar rantai FMA
+ * tidak menunggu latency satu sama lain.
+ */
+__attribute__((target("avx512f"))) static void
+avx512_sparse_row_kernel(float *destination, const float *values, const uint32_t *indexes,
+                         size_t nonzero_count, const float *dense, size_t dense_stride, size_t lanes)
+{
+    enum { VECTOR_COUNT = SIMD_SPARSE_MAX_LANES / 16 };
+    __mmask16 masks[VECTOR_COUNT];
+    __m512 accumulator[2][VECTOR_COUNT];
+
+    for (size_t vector_idx = 0; vector_idx < VECTOR_COUNT; ++vector_idx) {
+        size_t lane_start = vector_idx * 16;
+        size_t active_lanes = lanes > lane_start ? lanes - lane_start : 0;
+        masks[vector_idx] = active_lanes >= 16 ? (__mmask16)0xffff : (__mmask16)((1u << active_lanes) - 1u);
+        accumulator[0][vector_idx] = _mm512_setzero_ps();
+        accumulator[1][vector_idx] = _mm512_setzero_ps();
+    }
+
+    size_t nonzero_idx = 0;
+    for (; nonzero_idx + 2 <= nonzero_count; nonzero_idx += 2) {
+        __m512 value0 = _mm512_set1_ps(values[nonzero_idx]);
+        __m512 value1 = _mm512_set1_ps(values[nonzero_idx + 1]);
+        const float *dense_row0 = dense + (size_t)indexes[nonzero_idx] * dense_stride;
+        const float *dense_row1 = dense + (size_t)indexes[nonzero_idx + 1] * dense_stride;
+
+        for (size_t vector_idx = 0; vector_idx < VECTOR_COUNT; ++vector_idx) {
+            accumulator[0][vector_idx] = _mm512_fmadd_ps(
+                value0, _mm512_maskz_loadu_ps(masks[vector_idx], dense_row0 + vector_idx * 16), accumulator[0][vector_idx]);
+            accumulator[1][vector_idx] = _mm512_fmadd_ps(
+                value1, _mm512_maskz_loadu_ps(masks[vector_idx], dense_row1 + vector_idx * 16), accumulator[1][vector_idx]);
+        }
+    }
+
+    if (nonzero_idx < nonzero_count) {
+        __m512 value = _mm512_set1_ps(values[nonzero_idx]);
+        const float *dense_row = dense + (size_t)indexes[nonzero_idx] * dense_stride;
+
+        for (size_t vector_idx = 0; vector_idx < VECTOR_COUNT; ++vector_idx)
+            accumulator[0][vector_idx] = _mm512_fmadd_ps(
+                value, _mm512_maskz_loadu_ps(masks[vector_idx], dense_row + vector_idx * 16), accumulator[0][vector_idx]);
+    }
+
+    for (size_t vector_idx = 0; vector_idx < VECTOR_COUNT; ++vector_idx)
+        _mm512_mask_storeu_ps(destination + vector_idx * 16, masks[vector_idx],
+                              _mm512_add_ps(accumulator[0][vector_idx], accumulator[1][vector_idx]));
+}
+
+#endif /* NN_SIMD_X86 */
+
+// ==========================[ DISPATCH - IMPLEMENTATION ]======================
+
+static const struct SimdKernelTable scalar_kernel_table = {
+    "scalar", 4, 8,
+    scalar_gemm_micro_kernel,
+    scalar_vector_add, scalar_vector_axpy, scalar_vector_copy, scalar_vector_fill, scalar_vector_fill_random,
+    scalar_vector_widen_half, scalar_vector_narrow_half,
+    scalar_vector_activation, scalar_vector_activation_fast, scalar_vector_activation_derivative,
+    scalar_optimizer_momentum, scalar_optimizer_rmsprop, scalar_optimizer_adam,
+    scalar_sparse_row_kernel, scalar_gemm_int8_kernel
+};
+
+#if defined(NN_SIMD_X86)
+static const struct SimdKernelTable sse2_kernel_table = {
+    "sse2", 4, 8,
+    sse2_gemm_micro_kernel,
+    sse2_vector_add, sse2_vector_axpy, sse2_vector_copy, sse2_vector_fill, scalar_vector_fill_random,
+    scalar_vector_widen_half, scalar_vector_narrow_half,
+    sse2_vector_activation, sse2_vector_activation_fast, sse2_vector_activation_derivative,
+    sse2_optimizer_momentum, sse2_optimizer_rmsprop, sse2_optimizer_adam,
+    scalar_sparse_row_kernel, scalar_gemm_int8_kernel
+};
+
+static const struct SimdKernelTable avx2_kernel_table = {
+    "avx2", 6, 16,
+    avx2_gemm_micro_kernel,
+    avx2_vector_add, avx2_vector_axpy, avx2_vector_copy, avx2_vector_fill, avx2_vector_fill_random,
+    avx2_vector_widen_half, avx2_vector_narrow_half,
+    avx2_vector_activation, avx2_vector_activation_fast, avx2_vector_activation_derivative,
+    avx2_optimizer_momentum, avx2_optimizer_rmsprop, avx2_optimizer_adam,
+    avx2_sparse_row_kernel, avx2_gemm_int8_kernel
+};
+
+// AVX-512F saja tidak menjamin vpmaddubsw 512-bit (AVX512BW), GEMM int8 memakai versi AVX2
+static const struct SimdKernelTable avx512_kernel_table = {
+    "avx512", 8, 32,
+    avx512_gemm_micro_kernel,
+    avx512_vector_add, avx512_vector_axpy, avx512_vector_copy, avx512_vector_fill, avx512_vector_fill_random,
+    avx512_vector_widen_half, avx512_vector_narrow_half,
+    avx512_vector_activation, avx512_vector_activation_fast, avx512_vector_activation_derivative,
+    avx512_optimizer_momentum, avx512_optimizer_rmsprop, avx512_optimizer_adam,
+    avx512_sparse_row_kernel, avx2_gemm_int8_kernel
+};
+
+static const struct SimdKernelTable avx512vnni_kernel_table = {
+    "avx512vnni", 8, 32,
+    avx512_gemm_micro_kernel,
+    avx512_vector_add, avx512_vector_axpy, avx512_vector_copy, avx512_vector_fill, avx512_vector_fill_random,
+    avx512_vector_widen_half, avx512_vector_narrow_half,
+    avx512_vector_activation, avx512_vector_activation_fast, avx512_vector_activation_derivative,
+    avx512_optimizer_momentum, avx512_optimizer_rmsprop, avx512_optimizer_adam,
+    avx512_sparse_row_kernel, avx512vnni_gemm_int8_kernel
+};
+#endif
+
+static const struct SimdKernelTable *active_kernel_table = NULL;
+
+/**
+ * @brief Memilih tabel kernel terlebar yang didukung CPU (dan diizinkan NN_SIMD_ISA)
+ * @return Pointer ke tabel kernel terpilih
+ */
+static const struct SimdKernelTable *
+simd_select_kernels(void)
+{
+    const char *requested_isa = getenv("NN_SIMD_ISA");
+    const struct SimdKernelTable *candidates[5];
+    size_t candidate_count = 0;
+
+#if defined(NN_SIMD_X86)
+    // __builtin_cpu_supports membaca CPUID dan juga memeriksa dukungan OS (XGETBV)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vnni"))
+        candidates[candidate_count++] = &avx512vnni_kernel_table;
+    if (__builtin_cpu_supports("avx512f")) candidates[candidate_count++] = &avx512_kernel_table;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c"))
+        candidates[candidate_count++] = &avx2_kernel_table;
+    if (__builtin_cpu_supports("sse2")) candidates[candidate_count++] = &sse2_kernel_table;
+#endif
+    candidates[candidate_count++] = &scalar_kernel_table;
+
+    if (requested_isa != NULL) {
+        for (size_t candidate_idx = 0; candidate_idx < candidate_count; ++candidate_idx)
+            if (strcmp(candidates[candidate_idx]->isa_name, requested_isa) == 0) return candidates[candidate_idx];
+    }
+
+    return candidates[0];
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+/**
+ * @brief Memilih kernel saat program mulai, sebelum thread apapun dibuat
+ */
+__attribute__((constructor)) static void
+simd_initialize_kernels(void)
+{
+    active_kernel_table = simd_select_kernels();
+}
+#endif
+
+/**
+ * @brief Mendapatkan tabel kernel untuk CPU saat ini
+ * @return Pointer ke tabel kernel yang aktif
+ */
+const struct SimdKernelTable *
+simd_get_kernels(void)
+{
+    if (active_kernel_table == NULL) active_kernel_table = simd_select_kernels();
+    return active_kernel_table;
+}
+
+/**
+ * @brief Mendapatkan nama instruction set yang dipakai kernel matrix
+ * @return Nama instruction set ("scalar", "sse2", "avx2", atau "avx512")
+ */
+const char *
+matrix_get_kernel_isa_name(void)
+{
+    return simd_get_kernels()->isa_name;
+}
+
+/* vim: set ts=4 sw=4 sts=4 et */
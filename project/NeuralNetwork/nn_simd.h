@@ -0,0 +1,182 @@
+/**
+ * @file nn_simd.h
+ * @brief Tabel kernel SIMD yang dipilih saat runtime (internal, tidak untuk pengguna library)
+ * @author 0xfa99
+ * @version 1.0
+ *
+ * Kernel primitif matrix tersedia dalam beberapa versi instruction set
+ * (scalar, SSE2, AVX2, AVX-512). Versi terlebar yang didukung CPU dipilih
+ * sekali melalui CPUID dan disimpan di tabel function pointer, sehingga
+ * satu binary bisa berjalan optimal di berbagai generasi CPU.
+ */
+
+#ifndef NN_SIMD_H
+#define NN_SIMD_H
+
+#include "nn.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * @brief Nilai MR terbesar dari semua micro-kernel (untuk ukuran buffer tile)
+ */
+#define SIMD_GEMM_MAX_MR 8
+
+/**
+ * @brief Nilai NR terbesar dari semua micro-kernel (untuk ukuran buffer tile)
+ */
+#define SIMD_GEMM_MAX_NR 32
+
+/**
+ * @brief Epilogue yang dijalankan micro-kernel GEMM sebelum tile disimpan
+ *
+ * Bias ditambahkan dan aktivasi diterapkan selagi hasil GEMM masih berada
+ * di register, sehingga tidak perlu sapuan tambahan atas matrix hasil.
+ */
+struct GemmEpilogue
+{
+    const float *bias;                      // Bias untuk kolom pertama tile (NULL jika tanpa bias)
+    enum ActivationType activation_type;    // Aktivasi yang diterapkan setelah bias
+    bool use_fast_activation;               // true untuk aproksimasi polinomial sigmoid/tanh
+};
+
+/**
+ * @brief Jumlah baris A per pemanggilan kernel GEMM int8
+ */
+#define SIMD_INT8_GEMM_MR 4
+
+/**
+ * @brief Jumlah kolom per panel B int8 (satu panel = k_groups x 16 kolom x 4 byte)
+ */
+#define SIMD_INT8_GEMM_NR 16
+
+/**
+ * @brief Jumlah lane (baris batch) maksimum per pemanggilan kernel sparse
+ */
+#define SIMD_SPARSE_MAX_LANES 64
+
+/**
+ * @brief Zero point aktivasi int8: nilai q di [-63, 63] disimpan sebagai q + 64
+ *
+ * Aktivasi dibatasi 7 bit agar pasangan hasil kali u8 x s8 tidak pernah
+ * saturasi di vpmaddubsw (2 * 127 * 127 < 32767), sehingga semua instruction
+ * set menghasilkan akumulator int32 yang identik.
+ */
+#define SIMD_INT8_ACTIVATION_ZERO_POINT 64
+
+/**
+ * @brief Epilogue GEMM int8: dequantize, bias, lalu aktivasi
+ *
+ * Semua array kolom berisi minimal SIMD_INT8_GEMM_NR elemen mulai dari kolom
+ * pertama tile. Nilai kolom j baris i:
+ * (acc - column_offsets[j]) * row_scales[i] * column_scales[j] + bias[j].
+ */
+struct QuantizedGemmEpilogue
+{
+    const float *row_scales;                // Skala kuantisasi baris pertama tile A
+    const float *column_scales;             // Skala weights per kolom output
+    const int32_t *column_offsets;          // Zero point * jumlah weights int8 per kolom
+    const float *bias;                      // Bias per kolom output
+    enum ActivationType activation_type;    // Aktivasi yang diterapkan setelah bias
+    bool use_fast_activation;               // true untuk aproksimasi polinomial sigmoid/tanh
+};
+
+/**
+ * @brief Tabel function pointer kernel untuk satu instruction set
+ */
+struct SimdKernelTable
+{
+    const char *isa_name;   // Nama instruction set (untuk logging)
+    size_t gemm_mr;         // Jumlah baris tile micro-kernel GEMM
+    size_t gemm_nr;         // Jumlah kolom tile micro-kernel GEMM
+
+    /**
+     * Micro-kernel GEMM: C = (accumulate ? C : 0) + panel A (kc x MR) * panel B (kc x NR),
+     * lalu epilogue (jika tidak NULL) diterapkan sebelum disimpan.
+     * Hanya rows x columns elemen pertama tile yang ditulis ke C.
+     */
+    void (*gemm_micro_kernel)(size_t kc, const float *packed_a, const float *packed_b,
+                              float *c, size_t c_row_stride,
+                              size_t rows, size_t columns, bool accumulate,
+                              const struct GemmEpilogue *epilogue);
+
+    void (*vector_add)(float *destination, const float *source, size_t count);
+
+    /** destination[i] += alpha * source[i] */
+    void (*vector_axpy)(float *destination, const float *source, float alpha, size_t count);
+
+    void (*vector_copy)(float *destination, const float *source, size_t count);
+    void (*vector_fill)(float *destination, float value, size_t count);
+
+    /**
+     * destination[i] = min_value + U * value_range, dengan U di [0, 1) dari hash counter
+     * (counter + i) dan kunci key_a/key_b. Hasil identik bit-per-bit di semua instruction set.
+     */
+    void (*vector_fill_random)(float *destination, size_t count, uint32_t counter, uint32_t key_a,
+                               uint32_t key_b, float min_value, float value_range);
+
+    /** destination[i] = source[i] (fp16 atau bf16) yang dilebarkan ke fp32 */
+    void (*vector_widen_half)(float *destination, const uint16_t *source, size_t count,
+                              enum HalfPrecisionFormat format);
+
+    /** destination[i] = source[i] dibulatkan ke fp16 atau bf16 (round to nearest even) */
+    void (*vector_narrow_half)(uint16_t *destination, const float *source, size_t count,
+                               enum HalfPrecisionFormat format);
+
+    void (*vector_activation)(float *values, size_t count, enum ActivationType activation_type);
+
+    /** Aktivasi dengan aproksimasi exp polinomial (lihat ACTIVATION_PRECISION_FAST di nn.h) */
+    void (*vector_activation_fast)(float *values, size_t count, enum ActivationType activation_type);
+
+    /** gradient_values[i] *= turunan aktivasi di activated_values[i] */
+    void (*vector_activation_derivative)(float *gradient_values, const float *activated_values,
+                                         size_t count, enum ActivationType activation_type);
+
+    /*
+     * Update optimizer satu pass: parameter, gradient, dan state dibaca sekali
+     * dan ditulis sekali per elemen (lihat optimizer_step di nn.h).
+     */
+    void (*optimizer_momentum)(float *parameters, const float *gradients, float *velocity, size_t count,
+                               float learning_rate, float momentum);
+    void (*optimizer_rmsprop)(float *parameters, const float *gradients, float *mean_square, size_t count,
+                              float learning_rate, float decay, float epsilon);
+    void (*optimizer_adam)(float *parameters, const float *gradients, float *first_moment, float *second_moment,
+                           size_t count, float step_size, float beta1, float beta2, float epsilon);
+
+    /**
+     * Satu baris CSR x blok dense: destination[l] = sum_i values[i] * dense[indexes[i] * dense_stride + l]
+     * untuk l < lanes (lanes <= SIMD_SPARSE_MAX_LANES). Akumulator tetap di register selama nonzero dibaca.
+     */
+    void (*sparse_row_kernel)(float *destination, const float *values, const uint32_t *indexes,
+                              size_t nonzero_count, const float *dense, size_t dense_stride, size_t lanes);
+
+    /**
+     * GEMM int8: C = epilogue(A (rows x 4*k_groups, u8) * panel B (4*k_groups x 16, s8)) dengan
+     * akumulasi int32. rows <= SIMD_INT8_GEMM_MR; hanya rows x columns elemen yang ditulis ke C.
+     * Panel B tersusun [k_groups][16 kolom][4 byte] dan dimulai di batas 64 byte.
+     */
+    void (*gemm_int8_kernel)(size_t k_groups, const uint8_t *a, size_t a_row_stride, const int8_t *packed_b,
+                             float *c, size_t c_row_stride, size_t rows, size_t columns,
+                             const struct QuantizedGemmEpilogue *epilogue);
+};
+
+/**
+ * @brief Mendapatkan tabel kernel untuk CPU saat ini
+ *
+ * Pemilihan dilakukan sekali saat program mulai. Variabel environment
+ * NN_SIMD_ISA (scalar, sse2, avx2, avx512, avx512vnni) dapat membatasi
+ * instruction set yang dipakai, misalnya untuk benchmark atau debugging.
+ *
+ * @return Pointer ke tabel kernel yang aktif
+ */
+const struct SimdKernelTable *simd_get_kernels(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
+
+/* vim: set ts=4 sw=4 sts=4 et */